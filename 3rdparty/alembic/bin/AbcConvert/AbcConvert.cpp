@@ -39,7 +39,49 @@
 #include <Alembic/AbcCoreHDF5/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/time.h>
+#endif
+
+// set up _S_ISDIR()
+#if !defined(S_ISDIR)
+#  if defined( _S_IFDIR) && !defined( __S_IFDIR)
+#    define __S_IFDIR _S_IFDIR
+#  endif
+#  define S_ISDIR(mode)    (mode&__S_IFDIR)
+#endif
+
 typedef Alembic::AbcCoreFactory::IFactory IFactoryNS;
+namespace Abc = ::Alembic::Abc;
+namespace AbcA = ::Alembic::AbcCoreAbstract;
+namespace AbcU = ::Alembic::Util;
+
+// how many array samples of the input may be held between being read and
+// being written, shared by every file being converted at once
+static const size_t kMaxPrefetchBytes = 256 * 1024 * 1024;
+
+// array samples are read and written in runs of at most this many samples
+// of one property
+static const size_t kSamplesPerUnit = 32;
+
+// don't bother a read thread with less than this much
+static const size_t kMinThreadBytes = 256 * 1024;
+
+// HDF5 is only safe to use from one thread at a time.  Readers serialize
+// their own HDF5 calls, writers don't, so every conversion that writes HDF5
+// holds this for its whole length.
+static AbcU::mutex g_hdf5Lock;
 
 enum ArgMode
 {
@@ -56,128 +98,92 @@ public:
     {
         toType = IFactoryNS::kUnknown;
         force = false;
+        instance = false;
+        numThreads = 0;
     }
 
     std::vector<std::string>    inFiles;
     std::string                 outFile;
+    std::string                 inDir;
+    std::string                 outDir;
     IFactoryNS::CoreType        toType;
     bool                        force;
+    bool                        instance;
+    size_t                      numThreads;
 };
 
-void copyProps(Alembic::Abc::ICompoundProperty & iRead,
-    Alembic::Abc::OCompoundProperty & iWrite)
+//-*****************************************************************************
+// What one conversion did, file sizes are in bytes and samples are counted
+// by their decoded size.
+struct ConvertStats
 {
-    std::size_t numChildren = iRead.getNumProperties();
-    for (std::size_t i = 0; i < numChildren; ++i)
-    {
-        Alembic::AbcCoreAbstract::PropertyHeader header =
-            iRead.getPropertyHeader(i);
-        if (header.isArray())
-        {
-            Alembic::Abc::IArrayProperty inProp(iRead, header.getName());
-            Alembic::Abc::OArrayProperty outProp(iWrite, header.getName(),
-                header.getDataType(), header.getMetaData(),
-                header.getTimeSampling());
-
-            std::size_t numSamples = inProp.getNumSamples();
-
-            for (std::size_t j = 0; j < numSamples; ++j)
-            {
-                Alembic::AbcCoreAbstract::ArraySamplePtr samp;
-                Alembic::Abc::ISampleSelector sel(
-                    (Alembic::Abc::index_t) j);
-                inProp.get(samp, sel);
-                outProp.set(*samp);
-            }
-        }
-        else if (header.isScalar())
-        {
-            Alembic::Abc::IScalarProperty inProp(iRead, header.getName());
-            Alembic::Abc::OScalarProperty outProp(iWrite, header.getName(),
-                header.getDataType(), header.getMetaData(),
-                header.getTimeSampling());
-
-            std::size_t numSamples = inProp.getNumSamples();
-            std::vector<std::string> sampStrVec;
-            std::vector<std::wstring> sampWStrVec;
-            if (header.getDataType().getPod() ==
-                Alembic::AbcCoreAbstract::kStringPOD)
-            {
-                sampStrVec.resize(header.getDataType().getExtent());
-            }
-            else if (header.getDataType().getPod() ==
-                     Alembic::AbcCoreAbstract::kWstringPOD)
-            {
-                sampWStrVec.resize(header.getDataType().getExtent());
-            }
-
-            char samp[4096];
+    ConvertStats()
+      : numObjects( 0 )
+      , numProperties( 0 )
+      , numSamples( 0 )
+      , sampleBytes( 0 )
+      , inBytes( 0 )
+      , outBytes( 0 )
+      , seconds( 0.0 )
+      , pipelined( false ) {}
 
-            for (std::size_t j = 0; j < numSamples; ++j)
-            {
-                Alembic::Abc::ISampleSelector sel(
-                    (Alembic::Abc::index_t) j);
-
-                if (header.getDataType().getPod() ==
-                    Alembic::AbcCoreAbstract::kStringPOD)
-                {
-                    inProp.get(&sampStrVec.front(), sel);
-                    outProp.set(&sampStrVec.front());
-                }
-                else if (header.getDataType().getPod() ==
-                    Alembic::AbcCoreAbstract::kWstringPOD)
-                {
-                    inProp.get(&sampWStrVec.front(), sel);
-                    outProp.set(&sampWStrVec.front());
-                }
-                else
-                {
-                    inProp.get(samp, sel);
-                    outProp.set(samp);
-                }
-            }
-        }
-        else if (header.isCompound())
-        {
-            Alembic::Abc::OCompoundProperty outProp(iWrite,
-                header.getName(), header.getMetaData());
-            Alembic::Abc::ICompoundProperty inProp(iRead, header.getName());
-            copyProps(inProp, outProp);
-        }
+    void add( const ConvertStats & iStats )
+    {
+        numObjects += iStats.numObjects;
+        numProperties += iStats.numProperties;
+        numSamples += iStats.numSamples;
+        sampleBytes += iStats.sampleBytes;
+        inBytes += iStats.inBytes;
+        outBytes += iStats.outBytes;
+        pipelined = pipelined || iStats.pipelined;
     }
-}
 
-void copyObject(Alembic::Abc::IObject & iIn,
-    Alembic::Abc::OObject & iOut)
-{
-    std::size_t numChildren = iIn.getNumChildren();
+    size_t numObjects;
+    size_t numProperties;
+    size_t numSamples;
+    AbcU::uint64_t sampleBytes;
+    AbcU::uint64_t inBytes;
+    AbcU::uint64_t outBytes;
+    double seconds;
 
-    Alembic::Abc::ICompoundProperty inProps = iIn.getProperties();
-    Alembic::Abc::OCompoundProperty outProps = iOut.getProperties();
-    copyProps(inProps, outProps);
+    // the properties and samples are only counted by the pipelined copy
+    bool pipelined;
+};
 
-    for (std::size_t i = 0; i < numChildren; ++i)
-    {
-        Alembic::Abc::IObject childIn(iIn.getChild(i));
-        Alembic::Abc::OObject childOut(iOut, childIn.getName(),
-                                       childIn.getMetaData());
-        copyObject(childIn, childOut);
-    }
-}
+enum ConvertResult
+{
+    kConverted,
+    kSkipped,
+    kFailed
+};
 
 void displayHelp()
 {
     printf ("Usage (single file conversion):\n");
-    printf ("abcconvert [-force] OPTION inFile outFile\n");
+    printf ("abcconvert [-force] [-instance] [-j N] OPTION inFile outFile\n");
     printf ("Usage (convert multiple, layered files to single file):\n");
-    printf ("abcconvert OPTION -in inFile1 inFile2 ... -out outFile\n");
+    printf ("abcconvert [-instance] [-j N] OPTION -in inFile1 inFile2 ... -out outFile\n");
+    printf ("Usage (convert every .abc file in a directory):\n");
+    printf ("abcconvert [-force] [-instance] [-j N] OPTION -dir inDir outDir\n");
     printf ("Used to convert an Alembic file from one type to another.\n\n");
     printf ("If -force is not provided and inFile happens to be the same\n");
     printf ("type as OPTION no conversion will be done and a message will\n");
-    printf ("be printed out.\n");
+    printf ("be printed out.  Forcing an Ogawa to Ogawa conversion copies\n");
+    printf ("the array samples as stored, without decoding them.\n");
     printf ("OPTION has to be one of these:\n\n");
     printf ("  -toHDF   Convert to HDF.\n");
-    printf ("  -toOgawa Convert to Ogawa.\n");
+    printf ("  -toOgawa Convert to Ogawa.\n\n");
+    printf ("If -instance is provided, identical hierarchies (found via the\n");
+    printf ("object hashes stored in Ogawa files) are written once and then\n");
+    printf ("referenced as instances.\n\n");
+    printf ("Otherwise the array samples are read ahead of the writer, on\n");
+    printf ("N threads for Ogawa inputs and on one thread for inputs with\n");
+    printf ("HDF5 in them.  Conversions to HDF5 run one at a time, and\n");
+    printf ("HDF5 to HDF5 conversions aren't read ahead.  With -dir, N\n");
+    printf ("files are converted at once into outDir, which has to exist\n");
+    printf ("already.  N defaults to one per core.\n");
+    printf ("A report of how much was read and written, and how fast, is\n");
+    printf ("printed at the end.\n");
 }
 
 bool parseArgs( int iArgc, char *iArgv[], ConversionOptions &oOptions, bool &oDoConversion )
@@ -206,6 +212,19 @@ bool parseArgs( int iArgc, char *iArgv[], ConversionOptions &oOptions, bool &oDo
                 {
                     oOptions.force = true;
                 }
+                else if(arg == "-instance")
+                {
+                    oOptions.instance = true;
+                }
+                else if(arg == "-j" && i + 1 < iArgc)
+                {
+                    oOptions.numThreads = atoi( iArgv[++i] );
+                }
+                else if(arg == "-dir" && i + 2 < iArgc)
+                {
+                    oOptions.inDir = iArgv[++i];
+                    oOptions.outDir = iArgv[++i];
+                }
                 else if(arg == "-in" )
                 {
                     argMode = kInFiles;
@@ -268,8 +287,11 @@ bool parseArgs( int iArgc, char *iArgv[], ConversionOptions &oOptions, bool &oDo
         }
     }
 
-    if( (oOptions.inFiles.size() == 0) ||
-        (oOptions.outFile.length() == 0) ||
+    bool hasFiles = oOptions.inFiles.size() != 0 &&
+        oOptions.outFile.length() != 0;
+    bool hasDirs = oOptions.inDir.length() != 0;
+
+    if( hasFiles == hasDirs ||
         (oOptions.toType == IFactoryNS::kUnknown) )
     {
         printf( "Bad syntax!\n\n");
@@ -281,87 +303,844 @@ bool parseArgs( int iArgc, char *iArgv[], ConversionOptions &oOptions, bool &oDo
     return true;
 }
 
-int main(int argc, char *argv[])
+//-*****************************************************************************
+double getTimeSec()
 {
-    ConversionOptions options;
-    bool doConversion = false;
+#ifdef _MSC_VER
+    LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+    timeval t;
+    gettimeofday(&t, 0);
+    return (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
+#endif
+}
 
-    if (parseArgs( argc, argv, options, doConversion ) == false)
-        return 1;
+//-*****************************************************************************
+AbcU::uint64_t getFileSize( const std::string & iFileName )
+{
+    struct stat buf;
+    if ( stat( iFileName.c_str(), &buf ) == 0 && !S_ISDIR( buf.st_mode ) )
+    {
+        return ( AbcU::uint64_t ) buf.st_size;
+    }
+    return 0;
+}
 
-    if (doConversion)
+//-*****************************************************************************
+bool isDirectory( const std::string & iPath )
+{
+    struct stat buf;
+    return stat( iPath.c_str(), &buf ) == 0 && S_ISDIR( buf.st_mode );
+}
+
+//-*****************************************************************************
+// whether iFileName starts with the Ogawa magic, anything else is opened as
+// an HDF5 file by the factory
+bool isOgawaFile( const std::string & iFileName )
+{
+    char magic[5] = { 0, 0, 0, 0, 0 };
+    FILE * file = fopen( iFileName.c_str(), "rb" );
+    if ( !file )
     {
-        for( std::vector<std::string>::const_iterator inFile = options.inFiles.begin(); inFile != options.inFiles.end(); inFile++ )
+        return false;
+    }
+
+    size_t numRead = fread( magic, 1, sizeof( magic ), file );
+    fclose( file );
+    return numRead == sizeof( magic ) &&
+        memcmp( magic, "Ogawa", sizeof( magic ) ) == 0;
+}
+
+//-*****************************************************************************
+// the names of the .abc files directly inside of iDir, sorted
+bool listArchives( const std::string & iDir,
+                   std::vector< std::string > & oNames )
+{
+#ifdef _MSC_VER
+    WIN32_FIND_DATAA found;
+    HANDLE find = FindFirstFileA( ( iDir + "\\*.abc" ).c_str(), &found );
+    if ( find == INVALID_HANDLE_VALUE )
+    {
+        return GetLastError() == ERROR_FILE_NOT_FOUND;
+    }
+
+    do
+    {
+        if ( !( found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) )
         {
-            if (*inFile == options.outFile)
+            oNames.push_back( found.cFileName );
+        }
+    } while ( FindNextFileA( find, &found ) );
+
+    FindClose( find );
+#else
+    DIR * dir = opendir( iDir.c_str() );
+    if ( !dir )
+    {
+        return false;
+    }
+
+    while ( dirent * entry = readdir( dir ) )
+    {
+        std::string name = entry->d_name;
+        if ( name.size() > 4 && name.compare( name.size() - 4, 4, ".abc" ) == 0
+             && getFileSize( iDir + "/" + name ) > 0 )
+        {
+            oNames.push_back( name );
+        }
+    }
+
+    closedir( dir );
+#endif
+
+    std::sort( oNames.begin(), oNames.end() );
+    return true;
+}
+
+//-*****************************************************************************
+// Pipelined copy.  The output hierarchy and every output property are
+// created up front, in the same order CopyObject creates them, and the
+// scalar samples, which are small, are copied along the way.  The array
+// samples are then read a window of units at a time on a separate thread,
+// spread over several threads when the input allows it, while the main
+// thread writes out the window before it.  The writer is never called
+// from more than one thread, and the main thread leaves the input alone
+// while a window is being read, so an HDF5 input read on a single thread
+// is only used by that thread.  When HDF5 is on both ends there is no read
+// thread, each unit is read and then written on the calling thread.
+// The writers of an object and its properties are let go of as soon as
+// its last array sample is written, rather than all at the end.
+class PipelinedCopy
+{
+public:
+    PipelinedCopy( size_t iNumThreads, size_t iMaxBytes, bool iReadAhead,
+                   ConvertStats & ioStats )
+      : m_numThreads( iNumThreads )
+      , m_maxBytes( iMaxBytes )
+      , m_readAhead( iReadAhead )
+      , m_stats( ioStats )
+      , m_nextRelease( 0 )
+    {
+    }
+
+    ~PipelinedCopy()
+    {
+        // children before their parents, properties before their objects
+        while ( !m_arrays.empty() )
+        {
+            m_arrays.pop_back();
+        }
+
+        while ( !m_compounds.empty() )
+        {
+            m_compounds.pop_back();
+        }
+
+        while ( !m_objects.empty() )
+        {
+            m_objects.pop_back();
+        }
+    }
+
+    void copy( Abc::IObject iIn, Abc::OObject iOut );
+
+    // reads units [iBegin, iEnd), called from several threads at once
+    void readUnits( size_t iBegin, size_t iEnd );
+
+private:
+    struct ArrayCopy
+    {
+        Abc::IArrayProperty in;
+        Abc::OArrayProperty out;
+        size_t numSamples;
+    };
+
+    // an output object, with the compounds created for its own properties
+    // in [compoundsBegin, compoundsEnd) and its own array properties ending
+    // before arraysEnd
+    struct ObjectCopy
+    {
+        Abc::OObject out;
+        size_t compoundsBegin;
+        size_t compoundsEnd;
+        size_t arraysEnd;
+    };
+
+    struct CopyUnit
+    {
+        CopyUnit() : prop( 0 ), begin( 0 ), end( 0 ), bytes( 0 ) {}
+
+        size_t prop;
+        AbcA::index_t begin;
+        AbcA::index_t end;
+        std::vector< AbcA::ArraySamplePtr > samples;
+        size_t bytes;
+    };
+
+    void createObject( Abc::IObject iIn, Abc::OObject iOut );
+    void createProperties( Abc::ICompoundProperty iIn,
+                           Abc::OCompoundProperty iOut );
+    void copyScalar( Abc::IScalarProperty iIn, Abc::OScalarProperty iOut );
+    void readWindow( size_t iBegin, size_t iEnd, size_t iGrain );
+    void writeUnits( size_t iBegin, size_t iEnd );
+    void releaseWriters( size_t iArraysDone );
+
+    class ReadUnits
+    {
+    public:
+        ReadUnits( PipelinedCopy & iCopy, size_t iOffset )
+          : m_copy( iCopy ), m_offset( iOffset ) {}
+
+        void operator()( size_t iBegin, size_t iEnd )
+        {
+            m_copy.readUnits( m_offset + iBegin, m_offset + iEnd );
+        }
+
+    private:
+        PipelinedCopy & m_copy;
+        size_t m_offset;
+    };
+
+    // reads one window on its own thread, failures are handed back to the
+    // writing thread rather than escaping the thread
+    class WindowRead
+    {
+    public:
+        WindowRead( PipelinedCopy & iCopy, size_t iBegin, size_t iEnd,
+                    size_t iGrain )
+          : failed( false ), m_copy( iCopy ), m_begin( iBegin ),
+            m_end( iEnd ), m_grain( iGrain ) {}
+
+        static void run( void * iRead )
+        {
+            WindowRead * read = static_cast< WindowRead * >( iRead );
+            try
             {
-                printf("Error: inFile and outFile must not be the same!\n");
-                return 1;
+                read->m_copy.readWindow( read->m_begin, read->m_end,
+                                         read->m_grain );
+            }
+            catch ( std::exception & e )
+            {
+                read->failed = true;
+                read->error = e.what();
+            }
+            catch ( ... )
+            {
+                read->failed = true;
+                read->error = "unknown exception";
             }
         }
 
-        if (options.toType != IFactoryNS::kHDF5 && options.toType != IFactoryNS::kOgawa)
+        bool failed;
+        std::string error;
+
+    private:
+        PipelinedCopy & m_copy;
+        size_t m_begin;
+        size_t m_end;
+        size_t m_grain;
+    };
+
+    size_t m_numThreads;
+    size_t m_maxBytes;
+    bool m_readAhead;
+    ConvertStats & m_stats;
+
+    // the first object whose writers haven't been let go of yet
+    size_t m_nextRelease;
+
+    std::vector< ObjectCopy > m_objects;
+    std::vector< Abc::OCompoundProperty > m_compounds;
+    std::vector< ArrayCopy > m_arrays;
+    std::vector< CopyUnit > m_units;
+};
+
+//-*****************************************************************************
+void PipelinedCopy::copy( Abc::IObject iIn, Abc::OObject iOut )
+{
+    m_stats.pipelined = true;
+    createObject( iIn, iOut );
+
+    for ( size_t i = 0; i < m_arrays.size(); ++i )
+    {
+        size_t numSamples = m_arrays[i].numSamples;
+        for ( size_t j = 0; j < numSamples; j += kSamplesPerUnit )
         {
-            printf("Currently only -toHDF and -toOgawa are supported.\n");
-            return 1;
+            CopyUnit unit;
+            unit.prop = i;
+            unit.begin = ( AbcA::index_t ) j;
+            unit.end = ( AbcA::index_t ) std::min( numSamples,
+                                                   j + kSamplesPerUnit );
+            m_units.push_back( unit );
+        }
+    }
+
+    // objects without any array samples are done already
+    releaseWriters( 0 );
+
+    size_t numUnits = m_units.size();
+    if ( !m_readAhead )
+    {
+        for ( size_t i = 0; i < numUnits; ++i )
+        {
+            readUnits( i, i + 1 );
+            writeUnits( i, i + 1 );
+        }
+        return;
+    }
+
+    // two windows are in flight, the one being written and the next one
+    size_t maxWindowBytes = std::max< size_t >( 1, m_maxBytes / 2 );
+
+    size_t begin = 0;
+    size_t end = std::min< size_t >( numUnits, 1 );
+    readWindow( begin, end, 1 );
+
+    while ( begin < numUnits )
+    {
+        size_t totalBytes = 0;
+        for ( size_t i = begin; i < end; ++i )
+        {
+            totalBytes += m_units[i].bytes;
+        }
+
+        size_t avgBytes = std::max< size_t >( 1, totalBytes / ( end - begin ) );
+        size_t window = std::max< size_t >( 1, maxWindowBytes / avgBytes );
+        size_t grain = std::max< size_t >( 1, kMinThreadBytes / avgBytes );
+        size_t nextEnd = std::min( numUnits, end + window );
+
+        WindowRead next( *this, end, nextEnd, grain );
+        {
+            AbcU::thread reader( &WindowRead::run, &next );
+            writeUnits( begin, end );
+            reader.join();
+        }
+
+        if ( next.failed )
+        {
+            ABC_THROW( next.error );
+        }
+
+        begin = end;
+        end = nextEnd;
+    }
+}
+
+//-*****************************************************************************
+void PipelinedCopy::createObject( Abc::IObject iIn, Abc::OObject iOut )
+{
+    size_t index = m_objects.size();
+    m_objects.push_back( ObjectCopy() );
+    m_objects[index].out = iOut;
+    m_objects[index].compoundsBegin = m_compounds.size();
+    m_stats.numObjects ++;
+
+    createProperties( iIn.getProperties(), iOut.getProperties() );
+    m_objects[index].compoundsEnd = m_compounds.size();
+    m_objects[index].arraysEnd = m_arrays.size();
+
+    size_t numChildren = iIn.getNumChildren();
+    for ( size_t i = 0; i < numChildren; ++i )
+    {
+        Abc::IObject childIn( iIn.getChild( i ) );
+        Abc::OObject childOut( iOut, childIn.getName(),
+                               childIn.getMetaData() );
+        createObject( childIn, childOut );
+    }
+}
+
+//-*****************************************************************************
+void PipelinedCopy::createProperties( Abc::ICompoundProperty iIn,
+                                      Abc::OCompoundProperty iOut )
+{
+    m_compounds.push_back( iOut );
+
+    size_t numChildren = iIn.getNumProperties();
+    for ( size_t i = 0; i < numChildren; ++i )
+    {
+        const AbcA::PropertyHeader & header = iIn.getPropertyHeader( i );
+        if ( header.isArray() )
+        {
+            ArrayCopy prop;
+            prop.in = Abc::IArrayProperty( iIn, header.getName() );
+            prop.out = Abc::OArrayProperty( iOut, header.getName(),
+                header.getDataType(), header.getMetaData(),
+                header.getTimeSampling() );
+            prop.numSamples = prop.in.getNumSamples();
+            m_arrays.push_back( prop );
+            m_stats.numProperties ++;
+        }
+        else if ( header.isScalar() )
+        {
+            Abc::IScalarProperty inProp( iIn, header.getName() );
+            Abc::OScalarProperty outProp( iOut, header.getName(),
+                header.getDataType(), header.getMetaData(),
+                header.getTimeSampling() );
+            copyScalar( inProp, outProp );
+            m_stats.numProperties ++;
+        }
+        else if ( header.isCompound() )
+        {
+            Abc::ICompoundProperty inProp( iIn, header.getName() );
+            Abc::OCompoundProperty outProp( iOut, header.getName(),
+                header.getMetaData() );
+            createProperties( inProp, outProp );
+        }
+    }
+}
+
+//-*****************************************************************************
+void PipelinedCopy::copyScalar( Abc::IScalarProperty iIn,
+                                Abc::OScalarProperty iOut )
+{
+    const AbcA::DataType & dataType = iIn.getDataType();
+    std::vector< std::string > strSamp;
+    std::vector< std::wstring > wstrSamp;
+    std::vector< AbcU::uint8_t > samp;
+    void * dst = NULL;
+
+    if ( dataType.getPod() == AbcU::kStringPOD )
+    {
+        strSamp.resize( dataType.getExtent() );
+        dst = &strSamp.front();
+    }
+    else if ( dataType.getPod() == AbcU::kWstringPOD )
+    {
+        wstrSamp.resize( dataType.getExtent() );
+        dst = &wstrSamp.front();
+    }
+    else
+    {
+        samp.resize( dataType.getNumBytes() );
+        dst = &samp.front();
+    }
+
+    size_t numSamples = iIn.getNumSamples();
+    for ( size_t j = 0; j < numSamples; ++j )
+    {
+        iIn.get( dst, Abc::ISampleSelector( ( AbcA::index_t ) j ) );
+        iOut.set( dst );
+    }
+
+    m_stats.numSamples += numSamples;
+    m_stats.sampleBytes += numSamples * dataType.getNumBytes();
+}
+
+//-*****************************************************************************
+void PipelinedCopy::readUnits( size_t iBegin, size_t iEnd )
+{
+    for ( size_t i = iBegin; i < iEnd; ++i )
+    {
+        CopyUnit & unit = m_units[i];
+        Abc::IArrayProperty & prop = m_arrays[unit.prop].in;
+        size_t podBytes = prop.getDataType().getNumBytes();
+
+        unit.samples.resize( unit.end - unit.begin );
+        unit.bytes = 0;
+        for ( AbcA::index_t j = unit.begin; j < unit.end; ++j )
+        {
+            AbcA::ArraySamplePtr & samp = unit.samples[j - unit.begin];
+            prop.get( samp, Abc::ISampleSelector( j ) );
+            unit.bytes += samp->size() * podBytes;
+        }
+    }
+}
+
+//-*****************************************************************************
+void PipelinedCopy::readWindow( size_t iBegin, size_t iEnd, size_t iGrain )
+{
+    ReadUnits units( *this, iBegin );
+    AbcU::parallel_for( iEnd - iBegin, iGrain, units, m_numThreads );
+}
+
+//-*****************************************************************************
+void PipelinedCopy::writeUnits( size_t iBegin, size_t iEnd )
+{
+    for ( size_t i = iBegin; i < iEnd; ++i )
+    {
+        CopyUnit & unit = m_units[i];
+        Abc::OArrayProperty & prop = m_arrays[unit.prop].out;
+        for ( size_t j = 0; j < unit.samples.size(); ++j )
+        {
+            prop.set( *unit.samples[j] );
         }
 
+        m_stats.numSamples += unit.samples.size();
+        m_stats.sampleBytes += unit.bytes;
+
+        // let go of the samples as soon as they are written
+        std::vector< AbcA::ArraySamplePtr >().swap( unit.samples );
+
+        // the units are in property order, so this finishes the property
+        // and every one before it
+        if ( ( size_t ) unit.end == m_arrays[unit.prop].numSamples )
+        {
+            prop.reset();
+            releaseWriters( unit.prop + 1 );
+        }
+    }
+}
+
+//-*****************************************************************************
+// Lets go of the objects whose own array properties are all below
+// iArraysDone.  The objects were created depth first, so they finish in
+// order.  A child holds on to its parent's writer, so the parent is only
+// written out once its whole subtree is.
+void PipelinedCopy::releaseWriters( size_t iArraysDone )
+{
+    while ( m_nextRelease < m_objects.size() &&
+            m_objects[m_nextRelease].arraysEnd <= iArraysDone )
+    {
+        ObjectCopy & obj = m_objects[m_nextRelease];
+        for ( size_t i = obj.compoundsEnd; i > obj.compoundsBegin; --i )
+        {
+            m_compounds[i - 1].reset();
+        }
+        obj.out.reset();
+        ++m_nextRelease;
+    }
+}
+
+//-*****************************************************************************
+ConvertResult doConvertArchive( const std::vector< std::string > & iInFiles,
+                                const std::string & iOutFile,
+                                const ConversionOptions & iOptions,
+                                size_t iNumThreads, size_t iMaxBytes,
+                                bool iReadsHDF5, ConvertStats & oStats )
+{
+    double start = getTimeSec();
+
+    try
+    {
         Alembic::AbcCoreFactory::IFactory factory;
+        factory.setOgawaNumStreams( iNumThreads );
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
 
-        Alembic::Abc::IArchive archive;
-        if(options.inFiles.size() == 1)
+        Abc::IArchive archive;
+        if(iInFiles.size() == 1)
         {
-            archive = factory.getArchive(*options.inFiles.begin(), coreType);
+            archive = factory.getArchive(*iInFiles.begin(), coreType);
             if (!archive.valid())
             {
                 printf("Error: Invalid Alembic file specified: %s\n",
-                       options.inFiles.begin()->c_str());
-                return 1;
+                       iInFiles.begin()->c_str());
+                return kFailed;
             }
-            else if ( !options.force && (
+            else if ( !iOptions.force && (
                 (coreType == IFactoryNS::kHDF5 &&
-                 options.toType == IFactoryNS::kHDF5) ||
+                 iOptions.toType == IFactoryNS::kHDF5) ||
                 (coreType == IFactoryNS::kOgawa &&
-                 options.toType == IFactoryNS::kOgawa)) )
+                 iOptions.toType == IFactoryNS::kOgawa)) )
             {
-                printf("Warning: Alembic file specified: %s\n", options.inFiles.begin()->c_str());
+                printf("Warning: Alembic file specified: %s\n", iInFiles.begin()->c_str());
                 printf("is already of the type you want to convert to.\n");
                 printf("Please specify -force if you want to do this anyway.\n");
-                return 1;
+                return kSkipped;
             }
         }
         else
         {
-            archive = factory.getArchive(options.inFiles, coreType);
+            archive = factory.getArchive(iInFiles, coreType);
+        }
+
+        // an HDF5 input, or a layered one with HDF5 files in it, is read
+        // ahead on just one thread
+        if (iReadsHDF5)
+        {
+            iNumThreads = 1;
+        }
+
+        for (size_t i = 0; i < iInFiles.size(); ++i)
+        {
+            oStats.inBytes += getFileSize(iInFiles[i]);
+        }
+
+        // Scoped, so that the output is closed before measuring it.
+        {
+            Abc::IObject inTop = archive.getTop();
+            Abc::OArchive outArchive;
+            if (iOptions.toType == IFactoryNS::kHDF5)
+            {
+                outArchive = Abc::OArchive(
+                    Alembic::AbcCoreHDF5::WriteArchive(),
+                    iOutFile, inTop.getMetaData(),
+                    Abc::ErrorHandler::kThrowPolicy);
+            }
+            else if (iOptions.toType == IFactoryNS::kOgawa)
+            {
+                outArchive = Abc::OArchive(
+                    Alembic::AbcCoreOgawa::WriteArchive(),
+                    iOutFile, inTop.getMetaData(),
+                    Abc::ErrorHandler::kThrowPolicy);
+            }
+
+            // start at 1, we don't need to worry about intrinsic default case
+            for (AbcU::uint32_t i = 1; i < archive.getNumTimeSamplings();
+                 ++i)
+            {
+                outArchive.addTimeSampling(*archive.getTimeSampling(i));
+            }
+
+            // instancing, and Ogawa to Ogawa copies of the stored samples,
+            // are left to CopyObject
+            if (iOptions.instance || (coreType == IFactoryNS::kOgawa &&
+                                      iOptions.toType == IFactoryNS::kOgawa))
+            {
+                Abc::CopyStats stats;
+                Abc::CopyObject(inTop, outArchive.getTop(),
+                                iOptions.instance, &stats);
+                oStats.numObjects = stats.numObjects;
+
+                if (iOptions.instance)
+                {
+                    printf("Wrote %lu objects, %lu instances replacing %lu objects.\n",
+                           (unsigned long) stats.numObjects,
+                           (unsigned long) stats.numInstances,
+                           (unsigned long) stats.numInstancedObjects);
+                }
+            }
+            else
+            {
+                // the read thread and the writer can't both use HDF5
+                bool readAhead = !iReadsHDF5 ||
+                    iOptions.toType != IFactoryNS::kHDF5;
+                PipelinedCopy copy(iNumThreads, iMaxBytes, readAhead,
+                                   oStats);
+                copy.copy(inTop, outArchive.getTop());
+            }
+        }
+    }
+    catch (std::exception & e)
+    {
+        printf("Error: converting to %s failed: %s\n", iOutFile.c_str(),
+               e.what());
+        return kFailed;
+    }
+
+    oStats.outBytes = getFileSize(iOutFile);
+    oStats.seconds = getTimeSec() - start;
+    return kConverted;
+}
+
+//-*****************************************************************************
+// Conversions to HDF5 run one at a time.  Every file in a run is converted
+// to the same type, so HDF5 inputs are never read next to an HDF5 writer
+// and only need the reader's own serialization.  Anything that isn't Ogawa
+// is counted as HDF5 since the factory tries to open it as such.
+ConvertResult convertArchive( const std::vector< std::string > & iInFiles,
+                              const std::string & iOutFile,
+                              const ConversionOptions & iOptions,
+                              size_t iNumThreads, size_t iMaxBytes,
+                              ConvertStats & oStats )
+{
+    bool readsHDF5 = false;
+    for (size_t i = 0; i < iInFiles.size() && !readsHDF5; ++i)
+    {
+        readsHDF5 = !isOgawaFile(iInFiles[i]);
+    }
+
+    if (iOptions.toType == IFactoryNS::kHDF5)
+    {
+        AbcU::scoped_lock l(g_hdf5Lock);
+        return doConvertArchive(iInFiles, iOutFile, iOptions, iNumThreads,
+                                iMaxBytes, readsHDF5, oStats);
+    }
+
+    return doConvertArchive(iInFiles, iOutFile, iOptions, iNumThreads,
+                            iMaxBytes, readsHDF5, oStats);
+}
+
+//-*****************************************************************************
+void printReport( const std::string & iName, const ConvertStats & iStats )
+{
+    const double mb = 1024.0 * 1024.0;
+    double seconds = std::max( iStats.seconds, 1e-6 );
+
+    printf("%s: %lu objects, read %.1f MB, wrote %.1f MB in %.2f s "
+           "(%.1f MB/s in, %.1f MB/s out)\n", iName.c_str(),
+           (unsigned long) iStats.numObjects, iStats.inBytes / mb,
+           iStats.outBytes / mb, iStats.seconds,
+           iStats.inBytes / mb / seconds, iStats.outBytes / mb / seconds);
+
+    if (iStats.pipelined)
+    {
+        printf("%s: %lu properties, %lu samples, %.1f MB of samples "
+               "(%.1f MB/s)\n", iName.c_str(),
+               (unsigned long) iStats.numProperties,
+               (unsigned long) iStats.numSamples, iStats.sampleBytes / mb,
+               iStats.sampleBytes / mb / seconds);
+    }
+}
+
+//-*****************************************************************************
+// Workers take the next file until there are none left, every file is
+// converted by exactly one worker so the results don't need a lock.
+class BatchConvert
+{
+public:
+    BatchConvert( const ConversionOptions & iOptions,
+                  const std::vector< std::string > & iNames,
+                  size_t iNumWorkers )
+      : results( iNames.size(), kFailed ), stats( iNames.size() ),
+        m_options( iOptions ), m_names( iNames ), m_next( 0 ),
+        m_maxBytes( std::max< size_t >( 1, kMaxPrefetchBytes / iNumWorkers ) )
+    {
+    }
+
+    void operator()( size_t, size_t )
+    {
+        for (;;)
+        {
+            size_t file;
+            {
+                AbcU::scoped_lock l( m_lock );
+                if ( m_next == m_names.size() )
+                {
+                    return;
+                }
+                file = m_next++;
+            }
+
+            std::vector< std::string > inFiles( 1,
+                m_options.inDir + "/" + m_names[file] );
+            std::string outFile = m_options.outDir + "/" + m_names[file];
+
+            // the workers already keep the cores busy, each file is read
+            // ahead on just one thread
+            results[file] = convertArchive( inFiles, outFile, m_options, 1,
+                                            m_maxBytes, stats[file] );
+            if ( results[file] == kConverted )
+            {
+                printReport( m_names[file], stats[file] );
+            }
         }
+    }
+
+    std::vector< ConvertResult > results;
+    std::vector< ConvertStats > stats;
+
+private:
+    const ConversionOptions & m_options;
+    const std::vector< std::string > & m_names;
+    AbcU::mutex m_lock;
+    size_t m_next;
+    size_t m_maxBytes;
+};
+
+//-*****************************************************************************
+int convertDirectory( const ConversionOptions & iOptions )
+{
+    if (iOptions.inDir == iOptions.outDir)
+    {
+        printf("Error: inDir and outDir must not be the same!\n");
+        return 1;
+    }
 
-        Alembic::Abc::IObject inTop = archive.getTop();
-        Alembic::Abc::OArchive outArchive;
-        if (options.toType == IFactoryNS::kHDF5)
+    if (!isDirectory(iOptions.inDir) || !isDirectory(iOptions.outDir))
+    {
+        printf("Error: -dir needs an existing input and output directory!\n");
+        return 1;
+    }
+
+    std::vector< std::string > names;
+    if (!listArchives(iOptions.inDir, names))
+    {
+        printf("Error: Couldn't list the directory: %s\n",
+               iOptions.inDir.c_str());
+        return 1;
+    }
+
+    size_t numWorkers = iOptions.numThreads;
+    if (numWorkers == 0)
+    {
+        numWorkers = AbcU::thread::hardware_concurrency();
+    }
+    numWorkers = std::max< size_t >( 1, std::min( numWorkers, names.size() ) );
+
+    double start = getTimeSec();
+    BatchConvert batch( iOptions, names, numWorkers );
+    AbcU::parallel_for( numWorkers, 1, batch, numWorkers );
+
+    ConvertStats total;
+    size_t numConverted = 0;
+    size_t numSkipped = 0;
+    size_t numFailed = 0;
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        switch (batch.results[i])
         {
-            outArchive = Alembic::Abc::OArchive(
-                Alembic::AbcCoreHDF5::WriteArchive(),
-                options.outFile, inTop.getMetaData(),
-                Alembic::Abc::ErrorHandler::kThrowPolicy);
+            case kConverted:
+                numConverted ++;
+                total.add( batch.stats[i] );
+                break;
+            case kSkipped:
+                numSkipped ++;
+                break;
+            case kFailed:
+                numFailed ++;
+                break;
         }
-        else if (options.toType == IFactoryNS::kOgawa)
+    }
+    total.seconds = getTimeSec() - start;
+
+    printf("Converted %lu files, skipped %lu, %lu failed, on %lu workers.\n",
+           (unsigned long) numConverted, (unsigned long) numSkipped,
+           (unsigned long) numFailed, (unsigned long) numWorkers);
+    printReport( "total", total );
+
+    return numFailed > 0 ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    ConversionOptions options;
+    bool doConversion = false;
+
+    if (parseArgs( argc, argv, options, doConversion ) == false)
+        return 1;
+
+    if (doConversion)
+    {
+        if (options.toType != IFactoryNS::kHDF5 && options.toType != IFactoryNS::kOgawa)
+        {
+            printf("Currently only -toHDF and -toOgawa are supported.\n");
+            return 1;
+        }
+
+        if (!options.inDir.empty())
         {
-            outArchive = Alembic::Abc::OArchive(
-                Alembic::AbcCoreOgawa::WriteArchive(),
-                options.outFile, inTop.getMetaData(),
-                Alembic::Abc::ErrorHandler::kThrowPolicy);
+            return convertDirectory(options);
         }
 
-        // start at 1, we don't need to worry about intrinsic default case
-        for (Alembic::Util::uint32_t i = 1; i < archive.getNumTimeSamplings();
-             ++i)
+        for( std::vector<std::string>::const_iterator inFile = options.inFiles.begin(); inFile != options.inFiles.end(); inFile++ )
         {
-            outArchive.addTimeSampling(*archive.getTimeSampling(i));
+            if (*inFile == options.outFile)
+            {
+                printf("Error: inFile and outFile must not be the same!\n");
+                return 1;
+            }
+        }
+
+        size_t numThreads = options.numThreads;
+        if (numThreads == 0)
+        {
+            numThreads = AbcU::thread::hardware_concurrency();
+        }
+
+        ConvertStats stats;
+        ConvertResult result = convertArchive(options.inFiles,
+            options.outFile, options, numThreads, kMaxPrefetchBytes, stats);
+
+        if (result != kConverted)
+        {
+            return 1;
         }
 
-        Alembic::Abc::OObject outTop = outArchive.getTop();
-        copyObject(inTop, outTop);
+        printReport(options.outFile, stats);
     }
 
     return 0;
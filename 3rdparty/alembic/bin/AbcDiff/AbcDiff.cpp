@@ -39,6 +39,7 @@
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/AbcCoreLayer/Util.h>
 #include <Alembic/AbcGeom/All.h>
+#include <Alembic/Util/Thread.h>
 
 // util which compares the property headers and returns if they are the same
 bool headerCmp(const Alembic::Abc::PropertyHeader * iHeaderA,
@@ -216,19 +217,260 @@ void copyObject(Alembic::Abc::IObject & iIn, Alembic::Abc::OObject & iOut)
     }
 }
 
+// returns true if any sample of the two scalar properties differs, the
+// headers are expected to match already
+bool scalarPropDiffers(Alembic::Abc::IScalarProperty & iPropA,
+                       Alembic::Abc::IScalarProperty & iPropB)
+{
+    if (iPropA.getNumSamples() != iPropB.getNumSamples())
+    {
+        return true;
+    }
+
+    std::vector<std::string> sampStrVecA, sampStrVecB;
+    std::vector<std::wstring> sampWStrVecA, sampWStrVecB;
+    char sampA[4096];
+    char sampB[4096];
+    std::size_t numBytes = 0;
+
+    Alembic::Util::PlainOldDataType ptype = iPropB.getDataType().getPod();
+
+    if (ptype == Alembic::Util::kStringPOD)
+    {
+        sampStrVecA.resize(iPropB.getDataType().getExtent());
+        sampStrVecB.resize(iPropB.getDataType().getExtent());
+    }
+    else if (ptype == Alembic::Util::kWstringPOD)
+    {
+        sampWStrVecA.resize(iPropB.getDataType().getExtent());
+        sampWStrVecB.resize(iPropB.getDataType().getExtent());
+    }
+    else
+    {
+        memset(sampA, 0, 4096);
+        memset(sampB, 0, 4096);
+        numBytes = iPropB.getDataType().getNumBytes();
+    }
+
+    Alembic::Abc::index_t j;
+    Alembic::Abc::index_t numSamples = iPropB.getNumSamples();
+    for (j = 0; j < numSamples; ++j)
+    {
+        if (ptype == Alembic::Util::kStringPOD)
+        {
+            iPropA.get(&sampStrVecA.front(), j);
+            iPropB.get(&sampStrVecB.front(), j);
+            if (sampStrVecA != sampStrVecB)
+            {
+                return true;
+            }
+        }
+        else if (ptype == Alembic::Util::kWstringPOD)
+        {
+            iPropA.get(&sampWStrVecA.front(), j);
+            iPropB.get(&sampWStrVecB.front(), j);
+            if (sampWStrVecA != sampWStrVecB)
+            {
+                return true;
+            }
+        }
+        else
+        {
+            iPropA.get(sampA, j);
+            iPropB.get(sampB, j);
+
+            if (memcmp(sampA, sampB, numBytes) != 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// returns true if any sample of the two array properties differs, the
+// headers are expected to match already
+bool arrayPropDiffers(Alembic::Abc::IArrayProperty & iPropA,
+                      Alembic::Abc::IArrayProperty & iPropB)
+{
+    if (iPropA.getNumSamples() != iPropB.getNumSamples())
+    {
+        return true;
+    }
+
+    Alembic::Abc::index_t j;
+    Alembic::Abc::index_t numSamples = iPropB.getNumSamples();
+    for (j = 0; j < numSamples; ++j)
+    {
+        Alembic::Abc::ArraySampleKey keyA, keyB;
+        iPropA.getKey(keyA, j);
+        iPropB.getKey(keyB, j);
+        if (keyA != keyB)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// what has to be written for one property of a compound so that B layers
+// correctly over A
+struct PropDiff
+{
+    enum Action
+    {
+        kPrune, // in A but not B
+        kCopy,  // differs, copy all of B
+        kWalk   // same header compound, the children hold the differences
+    };
+
+    PropDiff(Action iAction, const std::string & iName) :
+        action(iAction), name(iName) {}
+
+    Action action;
+    std::string name;
+    std::vector<PropDiff> children;
+};
+
+// compares iPropA and iPropB, filling oDiffs in the property order of A.
+// This only reads, so it can run on any thread.
+void diffProps(Alembic::Abc::ICompoundProperty & iPropA,
+               Alembic::Abc::ICompoundProperty & iPropB,
+               std::vector<PropDiff> & oDiffs)
+{
+    for (size_t i = 0; i < iPropA.getNumProperties(); ++i)
+    {
+        const Alembic::Abc::PropertyHeader & childAHeader =
+            iPropA.getPropertyHeader(i);
+        const Alembic::Abc::PropertyHeader * childBHeader =
+            iPropB.getPropertyHeader(childAHeader.getName());
+
+        if (!childBHeader)
+        {
+            oDiffs.push_back(PropDiff(PropDiff::kPrune,
+                                      childAHeader.getName()));
+        }
+        else if (!headerCmp(&childAHeader, childBHeader))
+        {
+            oDiffs.push_back(PropDiff(PropDiff::kCopy,
+                                      childAHeader.getName()));
+        }
+        else if (childAHeader.isCompound())
+        {
+            Alembic::Abc::ICompoundProperty childA(iPropA,
+                childAHeader.getName());
+            Alembic::Abc::ICompoundProperty childB(iPropB,
+                childAHeader.getName());
+
+            oDiffs.push_back(PropDiff(PropDiff::kWalk,
+                                      childAHeader.getName()));
+            diffProps(childA, childB, oDiffs.back().children);
+        }
+        else if (childAHeader.isScalar())
+        {
+            Alembic::Abc::IScalarProperty childA(iPropA,
+                childAHeader.getName());
+            Alembic::Abc::IScalarProperty childB(iPropB,
+                childAHeader.getName());
+            if (scalarPropDiffers(childA, childB))
+            {
+                oDiffs.push_back(PropDiff(PropDiff::kCopy,
+                                          childAHeader.getName()));
+            }
+        }
+        else if (childAHeader.isArray())
+        {
+            Alembic::Abc::IArrayProperty childA(iPropA,
+                childAHeader.getName());
+            Alembic::Abc::IArrayProperty childB(iPropB,
+                childAHeader.getName());
+            if (arrayPropDiffers(childA, childB))
+            {
+                oDiffs.push_back(PropDiff(PropDiff::kCopy,
+                                          childAHeader.getName()));
+            }
+        }
+    }
+}
+
+// one step of the diff, recorded in hierarchy order while walking and
+// written out in that same order afterwards
+struct DiffOp
+{
+    enum Type
+    {
+        kProps, // the properties of objA and objB differ
+        kPrune, // objA has a child called name that objB doesn't
+        kAdd    // objB is new, copy its whole hierarchy
+    };
+
+    Type type;
+    Alembic::Abc::IObject objA;
+    Alembic::Abc::IObject objB;
+    std::string name;
+
+    // filled in for kProps, unless the whole object gets replaced
+    std::vector<PropDiff> props;
+};
+
+// runs diffProps over a range of the recorded ops
+class DiffOpsRange
+{
+public:
+    DiffOpsRange(std::vector<DiffOp> & iOps) : m_ops(iOps) {}
+
+    void operator()(size_t iBegin, size_t iEnd)
+    {
+        for (size_t i = iBegin; i < iEnd; ++i)
+        {
+            DiffOp & op = m_ops[i];
+            if (op.type != DiffOp::kProps || replacesObject(op))
+            {
+                continue;
+            }
+
+            Alembic::Abc::ICompoundProperty propA = op.objA.getProperties();
+            Alembic::Abc::ICompoundProperty propB = op.objB.getProperties();
+            diffProps(propA, propB, op.props);
+        }
+    }
+
+    // xforms are written in full, there's nothing to compare
+    static bool replacesObject(DiffOp & iOp)
+    {
+        return Alembic::AbcGeom::IXform::matches(
+            iOp.objB.getProperties().getMetaData());
+    }
+
+private:
+    std::vector<DiffOp> & m_ops;
+};
+
 // class which walks the hierarchy, writes out hiearchy and properties
 // that are different in iInFileB from iInFileA, and prunes hierarchy and
 // properties which are in iInFileA but not iInFileB.
+//
+// Subtrees whose property and children hashes match are skipped entirely.
+// The remaining work is gathered in batches of DiffOps, whose property
+// comparisons are spread over iNumThreads threads, and then written in
+// hierarchy order so the output doesn't depend on the thread count.
 class DiffWalker
 {
 public:
     DiffWalker(const char * iInFileA, const char * iInFileB,
-               const char * iOutFile, bool iVerbose)
+               const char * iOutFile, bool iVerbose, size_t iNumThreads)
     {
         m_verbose = iVerbose;
         m_inFileA = iInFileA;
         m_inFileB = iInFileB;
         m_outFile = iOutFile;
+        m_numThreads = iNumThreads;
+        if (m_numThreads == 0)
+        {
+            m_numThreads = Alembic::Util::thread::hardware_concurrency();
+        }
     }
 
     int walk()
@@ -237,6 +479,9 @@ public:
         Alembic::AbcCoreFactory::IFactory factory;
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
 
+        // one stream per thread so the readers don't wait on each other
+        factory.setOgawaNumStreams(m_numThreads);
+
         Alembic::Abc::IArchive arc1 = factory.getArchive(m_inFileA, coreType);
         if (coreType != Alembic::AbcCoreFactory::IFactory::kOgawa)
         {
@@ -256,6 +501,8 @@ public:
         Alembic::Abc::IObject topA = arc1.getTop();
         Alembic::Abc::IObject topB = arc2.getTop();
         walk(topA, topB);
+        flush();
+
         if (m_outStack.empty())
         {
             printf("No differences detected, %s was not written.\n",
@@ -266,23 +513,66 @@ public:
 
 private:
 
-    void walkProps(Alembic::Abc::ICompoundProperty & iPropA,
-                   Alembic::Abc::ICompoundProperty & iPropB,
-                   Alembic::Abc::OCompoundProperty & oProp)
+    // how many ops get gathered before they are diffed and written, this
+    // bounds how many objects are held open at once
+    static const size_t kBatchSize = 4096;
+
+    void addOp(DiffOp::Type iType, Alembic::Abc::IObject & iObjA,
+               Alembic::Abc::IObject & iObjB, const std::string & iName)
     {
-        for (size_t i = 0; i < iPropA.getNumProperties(); ++i)
+        m_ops.push_back(DiffOp());
+        m_ops.back().type = iType;
+        m_ops.back().objA = iObjA;
+        m_ops.back().objB = iObjB;
+        m_ops.back().name = iName;
+
+        if (m_ops.size() >= kBatchSize)
         {
-            Alembic::Abc::PropertyHeader childAHeader =
-                iPropA.getPropertyHeader(i);
-            const Alembic::Abc::PropertyHeader * childBHeader =
-                iPropB.getPropertyHeader(childAHeader.getName());
+            flush();
+        }
+    }
+
+    // diffs the gathered ops in parallel, and then writes them in order
+    void flush()
+    {
+        DiffOpsRange range(m_ops);
+        Alembic::Util::parallel_for(m_ops.size(), 1, range, m_numThreads);
+
+        for (size_t i = 0; i < m_ops.size(); ++i)
+        {
+            DiffOp & op = m_ops[i];
+            if (op.type == DiffOp::kProps)
+            {
+                writeProps(op);
+            }
+            else if (op.type == DiffOp::kPrune)
+            {
+                writePrune(op);
+            }
+            else
+            {
+                writeAdd(op);
+            }
+        }
+
+        m_ops.clear();
+    }
+
+    void writeProps(Alembic::Abc::ICompoundProperty & iPropA,
+                    Alembic::Abc::ICompoundProperty & iPropB,
+                    const std::vector<PropDiff> & iDiffs,
+                    Alembic::Abc::OCompoundProperty & oProp)
+    {
+        for (size_t i = 0; i < iDiffs.size(); ++i)
+        {
+            const PropDiff & diff = iDiffs[i];
 
             // prune this property
-            if (!childBHeader)
+            if (diff.action == PropDiff::kPrune)
             {
                 if (m_verbose)
                 {
-                    std::string propName = childAHeader.getName();
+                    std::string propName = diff.name;
                     fillFullPropName(iPropA, propName);
                     printf("%s pruning prop: %s.\n",
                            iPropA.getObject().getFullName().c_str(),
@@ -291,190 +581,107 @@ private:
                 Alembic::Abc::MetaData md;
                 Alembic::AbcCoreLayer::SetPrune(md, true);
                 Alembic::Abc::OCompoundProperty pruneProp(oProp,
-                    childAHeader.getName(), md);
-                continue;
+                    diff.name, md);
             }
-
-            if (!headerCmp(&childAHeader, childBHeader))
+            else if (diff.action == PropDiff::kCopy)
             {
+                const Alembic::Abc::PropertyHeader * childBHeader =
+                    iPropB.getPropertyHeader(diff.name);
+
                 if (childBHeader->isArray())
                 {
-                    Alembic::Abc::IArrayProperty inProp(iPropB,
-                        childBHeader->getName());
+                    Alembic::Abc::IArrayProperty inProp(iPropB, diff.name);
                     copyArrayProp(inProp, oProp, m_verbose);
                 }
                 else if (childBHeader->isScalar())
                 {
-                    Alembic::Abc::IScalarProperty inProp(iPropB,
-                        childBHeader->getName());
+                    Alembic::Abc::IScalarProperty inProp(iPropB, diff.name);
                     copyStaticProp(inProp, oProp, m_verbose);
                 }
                 else if (childBHeader->isCompound())
                 {
                     Alembic::Abc::OCompoundProperty outProp(oProp,
-                        childBHeader->getName(), childBHeader->getMetaData());
-                    Alembic::Abc::ICompoundProperty inProp(iPropB,
-                        childBHeader->getName());
+                        diff.name, childBHeader->getMetaData());
+                    Alembic::Abc::ICompoundProperty inProp(iPropB, diff.name);
                     copyProps(inProp, outProp, m_verbose);
                 }
-
-                continue;
-            } // if childAHeader != *childBHeader
-
-
-            // headers are equal do more checks
-            if (childAHeader.isCompound())
-            {
-                Alembic::Abc::ICompoundProperty childA(iPropA,
-                    childAHeader.getName());
-                Alembic::Abc::ICompoundProperty childB(iPropB,
-                    childAHeader.getName());
-
-                // dont copy metadata here, since it was the same
-                Alembic::Abc::OCompoundProperty outProp(oProp,
-                    childAHeader.getName());
-
-                walkProps(childA, childB, outProp);
-            }
-            else if (childAHeader.isScalar())
-            {
-                Alembic::Abc::IScalarProperty childA(iPropA,
-                    childAHeader.getName());
-                Alembic::Abc::IScalarProperty childB(iPropB,
-                    childAHeader.getName());
-                if (childA.getNumSamples() != childB.getNumSamples())
-                {
-                    copyStaticProp(childB, oProp, m_verbose);
-                    continue;
-                }
-
-                std::vector<std::string> sampStrVecA, sampStrVecB;
-                std::vector<std::wstring> sampWStrVecA, sampWStrVecB;
-                char sampA[4096];
-                char sampB[4096];
-                std::size_t numBytes = 0;
-
-                Alembic::Util::PlainOldDataType ptype =
-                    childB.getDataType().getPod();
-
-                if (ptype == Alembic::Util::kStringPOD)
-                {
-                    sampStrVecA.resize(childB.getDataType().getExtent());
-                    sampStrVecB.resize(childB.getDataType().getExtent());
-                }
-                else if (ptype == Alembic::Util::kWstringPOD)
-                {
-                    sampWStrVecA.resize(childB.getDataType().getExtent());
-                    sampWStrVecB.resize(childB.getDataType().getExtent());
-                }
-                else
-                {
-                    memset(sampA, 0, 4096);
-                    memset(sampB, 0, 4096);
-                    numBytes = childB.getDataType().getNumBytes();
-                }
-
-                Alembic::Abc::index_t j;
-                Alembic::Abc::index_t numSamples = childB.getNumSamples();
-                for (j = 0; j < numSamples; ++j)
-                {
-                    if (ptype == Alembic::Util::kStringPOD)
-                    {
-                        childA.get(&sampStrVecA.front(), j);
-                        childB.get(&sampStrVecB.front(), j);
-                        if (sampStrVecA != sampStrVecB)
-                        {
-                            copyStaticProp(childB, oProp, m_verbose);
-                            break;
-                        }
-                    }
-                    else if (ptype == Alembic::Util::kWstringPOD)
-                    {
-                        childA.get(&sampWStrVecA.front(), j);
-                        childB.get(&sampWStrVecB.front(), j);
-                        if (sampWStrVecA != sampWStrVecB)
-                        {
-                            copyStaticProp(childB, oProp, m_verbose);
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        childA.get(sampA, j);
-                        childB.get(sampB, j);
-
-                        if (memcmp(sampA, sampB, numBytes) != 0)
-                        {
-                            copyStaticProp(childB, oProp, m_verbose);
-                            break;
-                        }
-                    }
-                }
             }
-            else if (childAHeader.isArray())
+            else
             {
-                Alembic::Abc::IArrayProperty childA(iPropA,
-                    childAHeader.getName());
-                Alembic::Abc::IArrayProperty childB(iPropB,
-                    childAHeader.getName());
+                Alembic::Abc::ICompoundProperty childA(iPropA, diff.name);
+                Alembic::Abc::ICompoundProperty childB(iPropB, diff.name);
 
-                if (childA.getNumSamples() != childB.getNumSamples())
-                {
-                    copyArrayProp(childB, oProp, m_verbose);
-                    continue;
-                }
+                // dont copy metadata here, since it was the same
+                Alembic::Abc::OCompoundProperty outProp(oProp, diff.name);
 
-                Alembic::Abc::index_t j;
-                Alembic::Abc::index_t numSamples = childB.getNumSamples();
-                for (j = 0; j < numSamples; ++j)
-                {
-                    Alembic::Abc::ArraySampleKey keyA, keyB;
-                    childA.getKey(keyA, j);
-                    childB.getKey(keyB, j);
-                    if (keyA != keyB)
-                    {
-                        copyArrayProp(childB, oProp, m_verbose);
-                        break;
-                    }
-                }
+                writeProps(childA, childB, diff.children, outProp);
             }
         }
     }
 
-    void walkProps(Alembic::Abc::ICompoundProperty & iPropA,
-                   Alembic::Abc::ICompoundProperty & iPropB)
+    void writeProps(DiffOp & iOp)
     {
-        if (Alembic::AbcGeom::IXform::matches(iPropB.getMetaData()))
+        Alembic::Abc::ICompoundProperty propA = iOp.objA.getProperties();
+        Alembic::Abc::ICompoundProperty propB = iOp.objB.getProperties();
+
+        if (DiffOpsRange::replacesObject(iOp))
         {
-            fillStack(iPropB.getObject().getParent().getFullName());
-            Alembic::Abc::MetaData md = iPropB.getMetaData();
+            fillStack(iOp.objB.getParent().getFullName());
+            Alembic::Abc::MetaData md = propB.getMetaData();
             Alembic::AbcCoreLayer::SetReplace(md, true);
             m_outStack.push_back(Alembic::Abc::OObject(m_outStack.back(),
-                iPropB.getObject().getName(), md));
+                iOp.objB.getName(), md));
             Alembic::Abc::OCompoundProperty oprop =
                 m_outStack.back().getProperties();
-            copyProps(iPropB, oprop, m_verbose);
+            copyProps(propB, oprop, m_verbose);
 
             // This does not handle arbGeomParam and user props that are in
-            // iPropA but not iPropB (normally would prune)
+            // propA but not propB (normally would prune)
             return;
         }
-        else if (iPropA.getMetaData().serialize() !=
-                 iPropB.getMetaData().serialize() &&
-                 iPropB.getObject().getParent().valid())
+        else if (propA.getMetaData().serialize() !=
+                 propB.getMetaData().serialize() &&
+                 iOp.objB.getParent().valid())
         {
-            fillStack(iPropB.getObject().getParent().getFullName());
+            fillStack(iOp.objB.getParent().getFullName());
             m_outStack.push_back(Alembic::Abc::OObject(m_outStack.back(),
-                iPropB.getObject().getName(), iPropB.getMetaData()));
+                iOp.objB.getName(), propB.getMetaData()));
         }
         else
         {
-            fillStack(iPropB.getObject().getFullName());
+            fillStack(iOp.objB.getFullName());
         }
 
         Alembic::Abc::OCompoundProperty prop =
             m_outStack.back().getProperties();
-        walkProps(iPropA, iPropB, prop);
+        writeProps(propA, propB, iOp.props, prop);
+    }
+
+    void writePrune(DiffOp & iOp)
+    {
+        fillStack(iOp.objA.getFullName());
+
+        Alembic::Abc::MetaData md;
+        Alembic::AbcCoreLayer::SetPrune(md, true);
+        Alembic::Abc::OObject pruneObj(m_outStack.back(), iOp.name, md);
+        if (m_verbose)
+        {
+            printf("%s pruned.\n",
+                   iOp.objA.getChildHeader(iOp.name)->getFullName().c_str());
+        }
+    }
+
+    void writeAdd(DiffOp & iOp)
+    {
+        fillStack(iOp.objB.getParent().getFullName());
+        Alembic::Abc::OObject out(m_outStack.back(), iOp.objB.getName(),
+            iOp.objB.getMetaData());
+        if (m_verbose)
+        {
+            printf("%s copying hierarchy.\n",
+                   iOp.objB.getFullName().c_str());
+        }
+        copyObject(iOp.objB, out);
     }
 
     void walk(Alembic::Abc::IObject & iObjA, Alembic::Abc::IObject & iObjB)
@@ -487,44 +694,30 @@ private:
         // lets check our properties
         if (hashPropA != hashPropB)
         {
-            Alembic::Abc::ICompoundProperty propA = iObjA.getProperties();
-            Alembic::Abc::ICompoundProperty propB = iObjB.getProperties();
-            walkProps(propA, propB);
+            addOp(DiffOp::kProps, iObjA, iObjB, iObjA.getName());
         }
 
+        // identical subtree, nothing below here needs to be opened
         Alembic::Util::Digest hashChildrenA, hashChildrenB;
         iObjA.getChildrenHash(hashChildrenA);
         iObjB.getChildrenHash(hashChildrenB);
         if (hashChildrenA == hashChildrenB)
         {
-            if (m_outStack.size() > 1 &&
-                m_outStack.back().getFullName() == iObjA.getFullName())
-            {
-                m_outStack.pop_back();
-            }
-
             return;
         }
 
+        Alembic::Abc::IObject noObj;
         for (size_t i = 0; i < iObjA.getNumChildren(); ++i)
         {
-            Alembic::Abc::ObjectHeader headerA = iObjA.getChildHeader(i);
+            const Alembic::Abc::ObjectHeader & headerA =
+                iObjA.getChildHeader(i);
             const Alembic::Abc::ObjectHeader * headerB =
                 iObjB.getChildHeader(headerA.getName());
 
             // prune
             if (!headerB)
             {
-                fillStack(iObjA.getParent().getFullName());
-
-                Alembic::Abc::MetaData md;
-                Alembic::AbcCoreLayer::SetPrune(md, true);
-                Alembic::Abc::OObject pruneObj(m_outStack.back(),
-                                               headerA.getName(), md);
-                if (m_verbose)
-                {
-                    printf("%s pruned.\n", headerA.getFullName().c_str());
-                }
+                addOp(DiffOp::kPrune, iObjA, noObj, headerA.getName());
             }
             else
             {
@@ -537,34 +730,34 @@ private:
         // check to see if B introduced any new children
         for (size_t i = 0; i < iObjB.getNumChildren(); ++i)
         {
-            Alembic::Abc::ObjectHeader headerB = iObjB.getChildHeader(i);
+            const Alembic::Abc::ObjectHeader & headerB =
+                iObjB.getChildHeader(i);
             const Alembic::Abc::ObjectHeader * headerA =
                 iObjA.getChildHeader(headerB.getName());
             if (headerA == NULL)
             {
                 Alembic::Abc::IObject childB(iObjB, headerB.getName());
-                fillStack(iObjB.getParent().getFullName());
-                Alembic::Abc::OObject out(m_outStack.back(), childB.getName(),
-                    childB.getMetaData());
-                if (m_verbose)
-                {
-                    printf("%s copying hierarchy.\n",
-                           childB.getFullName().c_str());
-                }
-                copyObject(childB, out);
+                addOp(DiffOp::kAdd, noObj, childB, headerB.getName());
             }
         }
+    }
 
-        if (m_outStack.size() > 1 &&
-            m_outStack.back().getFullName() == iObjA.getFullName())
+    // true if iPath is iAncestor, or somewhere below it
+    static bool isWithin(const std::string & iAncestor,
+                         const std::string & iPath)
+    {
+        if (iAncestor == "/" || iAncestor == iPath)
         {
-            m_outStack.pop_back();
+            return true;
         }
 
+        return iPath.size() > iAncestor.size() &&
+            iPath.compare(0, iAncestor.size(), iAncestor) == 0 &&
+            iPath[iAncestor.size()] == '/';
     }
 
     // fills in m_outStack with empty OObjects based on where we are in the
-    // hierarchy
+    // hierarchy, closing anything that isn't an ancestor of iFullName
     void fillStack(const std::string & iFullName)
     {
         if (m_outStack.empty())
@@ -577,8 +770,17 @@ private:
             m_outStack.push_back(arc.getTop());
         }
 
+        // the root parent has no name, write to the top
+        std::string fullName = iFullName.empty() ? "/" : iFullName;
+
+        while (m_outStack.size() > 1 &&
+               !isWithin(m_outStack.back().getFullName(), fullName))
+        {
+            m_outStack.pop_back();
+        }
+
         // and we are done
-        if (iFullName.empty() || iFullName == m_outStack.back().getFullName())
+        if (fullName == m_outStack.back().getFullName())
         {
             return;
         }
@@ -593,10 +795,10 @@ private:
         size_t curIdx = std::string::npos;
         do
         {
-            curIdx = iFullName.find('/', lastIdx);
+            curIdx = fullName.find('/', lastIdx);
 
             m_outStack.push_back(Alembic::Abc::OObject(m_outStack.back(),
-                iFullName.substr(lastIdx, curIdx - lastIdx)));
+                fullName.substr(lastIdx, curIdx - lastIdx)));
             if (curIdx != std::string::npos)
             {
                 lastIdx = curIdx + 1;
@@ -606,16 +808,18 @@ private:
     }
 
     bool m_verbose;
+    size_t m_numThreads;
     std::string m_inFileA;
     std::string m_inFileB;
     std::string m_outFile;
     std::vector<Alembic::Abc::OObject> m_outStack;
+    std::vector<DiffOp> m_ops;
 };
 
 void displayHelp()
 {
     printf("Usage:\n");
-    printf("abcdiff [-v] inputFilename1 inputFilename2 outputFilename\n\n");
+    printf("abcdiff [-v] [-j numThreads] inputFilename1 inputFilename2 outputFilename\n\n");
 
     printf("Used to compare two Alembic files and write an Alembic file that contains the differences.\n\n");
     printf("inputFilename1 is the \"base\" file. If there a difference in the object hierarchy of inputFilename2, "
@@ -625,6 +829,7 @@ void displayHelp()
 
     printf("Parameters:\n");
     printf("-v\t\tOPTIONAL\tVerbose mode prints more detailed information about the diff process\n");
+    printf("-j\t\tOPTIONAL\tNumber of threads used to compare properties, defaults to the number of cores\n");
     printf("inputFilename1\tREQUIRED\tThe first Alembic file to compare\n");
     printf("inputFilename2\tREQUIRED\tThe second Alembic file to compare\n");
     printf("outputFilename\tREQUIRED\tThe filename to write out the Alembic diff file\n");
@@ -632,19 +837,34 @@ void displayHelp()
 
 int main(int argc, char *argv[])
 {
+    bool verbose = false;
+    size_t numThreads = 0;
 
-    if ((argc != 4 && argc != 5)|| (argc == 5 && std::string("-v") != argv[1]))
+    int argIdx = 1;
+    for (; argIdx < argc - 3; ++argIdx)
     {
-        displayHelp();
-        return 1;
+        std::string arg = argv[argIdx];
+        if (arg == "-v")
+        {
+            verbose = true;
+        }
+        else if (arg == "-j" && argIdx + 1 < argc - 3)
+        {
+            numThreads = (size_t) atoi(argv[++argIdx]);
+        }
+        else
+        {
+            break;
+        }
     }
 
-    bool verbose = false;
-    // we've already checked for -v above
-    if (argc == 5)
+    if (argc < 4 || argIdx != argc - 3)
     {
-        verbose = true;
+        displayHelp();
+        return 1;
     }
-    DiffWalker dw(argv[argc-3], argv[argc-2], argv[argc-1], verbose);
+
+    DiffWalker dw(argv[argc-3], argv[argc-2], argv[argc-1], verbose,
+                  numThreads);
     dw.walk();
 }
@@ -39,7 +39,10 @@
 
 #include <ImathBoxAlgo.h>
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 //-*****************************************************************************
 using namespace ::Alembic::AbcGeom;
@@ -77,12 +80,8 @@ M44d getFinalMatrix( IObject &iObj, chrono_t seconds )
 }
 
 //-*****************************************************************************
-Box3d getBounds( IObject iObj, chrono_t seconds )
+IBox3dProperty getSelfBoundsProperty( IObject iObj )
 {
-    Box3d bnds;
-    bnds.makeEmpty();
-
-    M44d xf = getFinalMatrix( iObj, seconds );
     IBox3dProperty boxProp;
 
     if ( ICurves::matches( iObj.getMetaData() ) )
@@ -116,6 +115,18 @@ Box3d getBounds( IObject iObj, chrono_t seconds )
         boxProp = ms.getSelfBoundsProperty();
     }
 
+    return boxProp;
+}
+
+//-*****************************************************************************
+Box3d getBounds( IObject iObj, chrono_t seconds )
+{
+    Box3d bnds;
+    bnds.makeEmpty();
+
+    M44d xf = getFinalMatrix( iObj, seconds );
+    IBox3dProperty boxProp = getSelfBoundsProperty( iObj );
+
     if ( boxProp.valid() )
     {
         ISampleSelector sel( seconds );
@@ -154,6 +165,244 @@ void visitObject( IObject iObj, chrono_t seconds )
     }
 }
 
+//-*****************************************************************************
+// Frame range mode.  The hierarchy is flattened once, parents before their
+// children, so each frame builds every world matrix from its parent's in a
+// single pass instead of walking up the parents of every shape.
+static const size_t NO_PARENT = static_cast< size_t >( -1 );
+
+struct BoundsNode
+{
+    BoundsNode()
+      : parent( NO_PARENT )
+      , subtreeEnd( 0 )
+      , constantXform( false )
+      , constantSelfBounds( false )
+    {
+        constantMatrix.makeIdentity();
+        constantSelf.makeEmpty();
+    }
+
+    // index of the nearest xform or shape above this one
+    size_t parent;
+
+    // one past the last node below this one
+    size_t subtreeEnd;
+
+    IXformSchema xform;
+    IBox3dProperty childBounds;
+    IBox3dProperty selfBounds;
+
+    // constant values are read once rather than once per frame
+    bool constantXform;
+    M44d constantMatrix;
+    bool constantSelfBounds;
+    Box3d constantSelf;
+};
+
+//-*****************************************************************************
+void flattenObject( IObject iObj, size_t iParent,
+                    std::vector< BoundsNode > &oNodes )
+{
+    const MetaData &md = iObj.getMetaData();
+    size_t parent = iParent;
+
+    if ( IXform::matches( md ) )
+    {
+        oNodes.push_back( BoundsNode() );
+        BoundsNode &node = oNodes.back();
+        node.parent = iParent;
+        node.xform = IXform( iObj, kWrapExisting ).getSchema();
+        node.childBounds = node.xform.getChildBoundsProperty();
+
+        if ( node.xform.isConstant() )
+        {
+            node.constantXform = true;
+            node.constantMatrix = node.xform.getValue().getMatrix();
+        }
+
+        parent = oNodes.size() - 1;
+    }
+    else
+    {
+        IBox3dProperty selfBounds = getSelfBoundsProperty( iObj );
+        if ( selfBounds.valid() )
+        {
+            oNodes.push_back( BoundsNode() );
+            BoundsNode &node = oNodes.back();
+            node.parent = iParent;
+            node.selfBounds = selfBounds;
+
+            if ( selfBounds.isConstant() )
+            {
+                node.constantSelfBounds = true;
+                node.constantSelf = selfBounds.getValue();
+            }
+
+            parent = oNodes.size() - 1;
+        }
+    }
+
+    for ( size_t i = 0 ; i < iObj.getNumChildren() ; i++ )
+    {
+        flattenObject( IObject( iObj, iObj.getChildHeader( i ).getName() ),
+                       parent, oNodes );
+    }
+
+    if ( parent != iParent )
+    {
+        oNodes[parent].subtreeEnd = oNodes.size();
+    }
+}
+
+//-*****************************************************************************
+// The world space bounds of every shape at one time.  oWorlds is scratch
+// space with one matrix per node.  When iUseChildBounds is set an xform
+// with a non-empty .childBnds sample stands in for its whole subtree.
+Box3d getSceneBounds( const std::vector< BoundsNode > &iNodes,
+                      chrono_t seconds, bool iUseChildBounds,
+                      std::vector< M44d > &oWorlds )
+{
+    Box3d bnds;
+    bnds.makeEmpty();
+
+    ISampleSelector sel( seconds );
+
+    size_t i = 0;
+    while ( i < iNodes.size() )
+    {
+        const BoundsNode &node = iNodes[i];
+        M44d &xf = oWorlds[i];
+
+        if ( node.parent == NO_PARENT )
+        {
+            xf.makeIdentity();
+        }
+        else
+        {
+            xf = oWorlds[node.parent];
+        }
+
+        if ( node.xform.valid() )
+        {
+            if ( node.constantXform )
+            {
+                xf = node.constantMatrix * xf;
+            }
+            else
+            {
+                xf = node.xform.getValue( sel ).getMatrix() * xf;
+            }
+
+            if ( iUseChildBounds && node.childBounds.valid() &&
+                 node.childBounds.getNumSamples() > 0 )
+            {
+                Box3d childBnds = node.childBounds.getValue( sel );
+                if ( !childBnds.isEmpty() )
+                {
+                    bnds.extendBy( Imath::transform( childBnds, xf ) );
+                    i = node.subtreeEnd;
+                    continue;
+                }
+            }
+        }
+        else if ( node.constantSelfBounds )
+        {
+            bnds.extendBy( Imath::transform( node.constantSelf, xf ) );
+        }
+        else
+        {
+            bnds.extendBy( Imath::transform( node.selfBounds.getValue( sel ),
+                                             xf ) );
+        }
+
+        ++i;
+    }
+
+    return bnds;
+}
+
+//-*****************************************************************************
+// Computes the scene bounds of a contiguous run of frames, each chunk with
+// its own world matrices.
+struct FrameBounds
+{
+    const std::vector< BoundsNode > *nodes;
+    const std::vector< chrono_t > *times;
+    std::vector< Box3d > *bounds;
+    bool useChildBounds;
+
+    void operator()( size_t iBegin, size_t iEnd )
+    {
+        std::vector< M44d > worlds( nodes->size() );
+        for ( size_t i = iBegin ; i < iEnd ; i++ )
+        {
+            ( *bounds )[i] = getSceneBounds( *nodes, ( *times )[i],
+                                             useChildBounds, worlds );
+        }
+    }
+};
+
+//-*****************************************************************************
+int echoFrameRange( const char *iFileName, int iFirst, int iLast, double iFps,
+                    size_t iNumThreads, bool iUseChildBounds )
+{
+    if ( iNumThreads == 0 )
+    {
+        iNumThreads = Alembic::Util::thread::hardware_concurrency();
+    }
+
+    Alembic::AbcCoreFactory::IFactory factory;
+    factory.setPolicy( ErrorHandler::kQuietNoopPolicy );
+    factory.setOgawaNumStreams( iNumThreads );
+
+    Alembic::AbcCoreFactory::IFactory::CoreType coreType;
+    IArchive archive = factory.getArchive( iFileName, coreType );
+    if ( !archive.valid() )
+    {
+        std::cerr << "Couldn't open " << iFileName << std::endl;
+        return -1;
+    }
+
+    // HDF5 reads are serialized behind a global lock
+    if ( coreType == Alembic::AbcCoreFactory::IFactory::kHDF5 )
+    {
+        iNumThreads = 1;
+    }
+
+    std::vector< BoundsNode > nodes;
+    flattenObject( archive.getTop(), NO_PARENT, nodes );
+
+    std::vector< chrono_t > times;
+    for ( int frame = iFirst ; frame <= iLast ; frame++ )
+    {
+        times.push_back( frame / iFps );
+    }
+
+    std::vector< Box3d > bounds( times.size() );
+
+    FrameBounds frameBounds;
+    frameBounds.nodes = &nodes;
+    frameBounds.times = &times;
+    frameBounds.bounds = &bounds;
+    frameBounds.useChildBounds = iUseChildBounds;
+    Alembic::Util::parallel_for( times.size(), 1, frameBounds, iNumThreads );
+
+    Box3d rangeBounds;
+    rangeBounds.makeEmpty();
+    for ( size_t i = 0 ; i < bounds.size() ; i++ )
+    {
+        std::cout << iFirst + static_cast< int >( i ) << " " << bounds[i].min
+                  << " " << bounds[i].max << std::endl;
+        rangeBounds.extendBy( bounds[i] );
+    }
+
+    std::cout << "/" << " " << rangeBounds.min << " " << rangeBounds.max
+              << std::endl;
+
+    return 0;
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 // DO IT.
@@ -161,10 +410,62 @@ void visitObject( IObject iObj, chrono_t seconds )
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
+    if ( argc >= 5 && strcmp( argv[2], "-frames" ) == 0 )
+    {
+        int first = atoi( argv[3] );
+        int last = atoi( argv[4] );
+        double fps = 24.0;
+        size_t numThreads = 0;
+        bool useChildBounds = true;
+
+        int arg = 5;
+        if ( arg < argc && argv[arg][0] != '-' )
+        {
+            fps = atof( argv[arg++] );
+        }
+
+        for ( ; arg < argc ; arg++ )
+        {
+            if ( strcmp( argv[arg], "-threads" ) == 0 && arg + 1 < argc )
+            {
+                numThreads = atoi( argv[++arg] );
+            }
+            else if ( strcmp( argv[arg], "-nochildbnds" ) == 0 )
+            {
+                useChildBounds = false;
+            }
+            else
+            {
+                std::cerr << "Unknown option: " << argv[arg] << std::endl;
+                exit( -1 );
+            }
+        }
+
+        if ( fps <= 0.0 || last < first )
+        {
+            std::cerr << "Invalid frame range or fps" << std::endl;
+            exit( -1 );
+        }
+
+        return echoFrameRange( argv[1], first, last, fps, numThreads,
+                               useChildBounds );
+    }
+
     if ( argc != 2 && argc != 3 )
     {
         std::cerr << "USAGE: " << argv[0] << " <AlembicArchive.abc> <seconds>"
-                  << std::endl;
+                  << std::endl
+                  << "       " << argv[0] << " <AlembicArchive.abc> -frames"
+                  << " <first> <last> [fps] [-threads N] [-nochildbnds]"
+                  << std::endl << std::endl
+                  << "With -frames, prints the world bounds of the whole"
+                  << " scene at each frame" << std::endl
+                  << "(frame / fps seconds, fps defaults to 24), then their"
+                  << " union.  Frames are" << std::endl
+                  << "evaluated on N threads, all cores by default.  Xforms"
+                  << " with .childBnds" << std::endl
+                  << "stand in for their subtrees unless -nochildbnds is"
+                  << " given." << std::endl;
         exit( -1 );
     }
 
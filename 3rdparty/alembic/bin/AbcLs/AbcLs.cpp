@@ -47,6 +47,7 @@
 
 #include <signal.h>
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <sys/stat.h>
@@ -598,6 +599,377 @@ void visit( AbcG::IObject iObj,
     }
 }
 
+//-*****************************************************************************
+// Fast listing (-x and -json).
+//
+// Only the object and property headers are read, through the
+// AbcCoreAbstract readers, and sibling subtrees are listed on several
+// threads.  Every subtree is listed into its own string and the strings are
+// printed in hierarchy order, so the output doesn't depend on the threads.
+//-*****************************************************************************
+
+struct FastOptions
+{
+    bool all;
+    bool long_list;
+    bool meta;
+    bool json;
+
+    // the archive time samplings, to look up the index of a property's
+    std::vector< AbcA::TimeSamplingPtr > timeSamplings;
+};
+
+//-*****************************************************************************
+std::string jsonString( const std::string & iStr )
+{
+    std::ostringstream ret;
+    ret << "\"";
+    for ( std::size_t i = 0; i < iStr.size(); ++i ) {
+        char c = iStr[i];
+        if ( c == '"' || c == '\\' ) {
+            ret << '\\' << c;
+        } else if ( (unsigned char) c < 0x20 ) {
+            ret << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' )
+                << (int) c << std::dec << std::setfill( ' ' );
+        } else {
+            ret << c;
+        }
+    }
+    ret << "\"";
+    return ret.str();
+}
+
+//-*****************************************************************************
+int timeSamplingIndex( AbcA::TimeSamplingPtr iTime, const FastOptions & iOpt )
+{
+    for ( std::size_t i = 0; i < iOpt.timeSamplings.size(); ++i ) {
+        if ( iOpt.timeSamplings[i] == iTime ||
+             ( iTime && *iOpt.timeSamplings[i] == *iTime ) ) {
+            return (int) i;
+        }
+    }
+    return -1;
+}
+
+//-*****************************************************************************
+void fastProperties( AbcA::CompoundPropertyReaderPtr iProps,
+                     const std::string & iPath, std::size_t iDepth,
+                     const FastOptions & iOpt, std::ostream & oOut )
+{
+    std::string indent( 2 * iDepth, ' ' );
+    std::string prefix = iPath == "/" ? iPath : iPath + "/";
+
+    for ( std::size_t i = 0; i < iProps->getNumProperties(); ++i ) {
+        const AbcA::PropertyHeader & header = iProps->getPropertyHeader( i );
+        std::string path = prefix + header.getName();
+
+        std::size_t numSamples = 0;
+        if ( header.isScalar() ) {
+            numSamples = iProps->getScalarProperty(
+                header.getName() )->getNumSamples();
+        } else if ( header.isArray() ) {
+            numSamples = iProps->getArrayProperty(
+                header.getName() )->getNumSamples();
+        }
+
+        if ( iOpt.json ) {
+            oOut << ( i ? "," : "" ) << std::endl << indent << "{\"name\": "
+                 << jsonString( header.getName() ) << ", \"type\": ";
+            if ( header.isCompound() ) {
+                oOut << "\"compound\"";
+            } else {
+                oOut << ( header.isScalar() ? "\"scalar\"" : "\"array\"" )
+                     << ", \"dataType\": ";
+                std::stringstream dt;
+                dt << header.getDataType();
+                oOut << jsonString( dt.str() ) << ", \"numSamples\": "
+                     << numSamples << ", \"timeSampling\": "
+                     << timeSamplingIndex( header.getTimeSampling(), iOpt );
+            }
+            oOut << ", \"metaData\": "
+                 << jsonString( header.getMetaData().serialize() );
+            if ( header.isCompound() ) {
+                oOut << ", \"properties\": [";
+                fastProperties( iProps->getCompoundProperty( header.getName() ),
+                                path, iDepth + 1, iOpt, oOut );
+                oOut << "]";
+            }
+            oOut << "}";
+            continue;
+        }
+
+        if ( iOpt.long_list ) {
+            std::stringstream ss;
+            std::string ptype = "CompoundProperty";
+            if ( header.isScalar() ) {
+                ptype = "ScalarProperty";
+                ss << header.getDataType() << "[" << numSamples << "]";
+            } else if ( header.isArray() ) {
+                ptype = "ArrayProperty";
+                ss << header.getDataType() << "[" << numSamples << "]";
+            }
+            oOut << ptype << std::string( COL_1 - ptype.length(), ' ' )
+                 << ss.str();
+            if ( ss.str().length() < COL_2 ) {
+                oOut << std::string( COL_2 - ss.str().length(), ' ' );
+            } else {
+                oOut << " ";
+            }
+        }
+
+        oOut << BLUECOLOR << path << RESETCOLOR;
+        if ( iOpt.meta ) {
+            oOut << GRAYCOLOR << " {" << header.getMetaData().serialize()
+                 << "}" << RESETCOLOR;
+        }
+        oOut << std::endl;
+
+        if ( header.isCompound() ) {
+            fastProperties( iProps->getCompoundProperty( header.getName() ),
+                            path, iDepth, iOpt, oOut );
+        }
+    }
+}
+
+//-*****************************************************************************
+// what goes before the children of an object
+void fastOpen( AbcA::ObjectReaderPtr iObj, std::size_t iDepth,
+               const FastOptions & iOpt, std::ostream & oOut )
+{
+    const AbcA::MetaData & md = iObj->getMetaData();
+    std::string indent( 2 * iDepth, ' ' );
+
+    if ( iOpt.json ) {
+        oOut << indent << "{\"name\": " << jsonString( iObj->getName() )
+             << ", \"path\": " << jsonString( iObj->getFullName() )
+             << ", \"schema\": " << jsonString( md.get( "schema" ) )
+             << ", \"metaData\": " << jsonString( md.serialize() );
+        if ( iOpt.all ) {
+            oOut << "," << std::endl << indent << " \"properties\": [";
+            fastProperties( iObj->getProperties(), iObj->getFullName(),
+                            iDepth + 1, iOpt, oOut );
+            oOut << "]";
+        }
+        oOut << "," << std::endl << indent << " \"children\": [";
+        if ( iObj->getNumChildren() > 0 ) {
+            oOut << std::endl;
+        }
+        return;
+    }
+
+    if ( iOpt.long_list ) {
+        std::string schema = md.get( "schema" );
+        std::size_t spacing = iOpt.all ? COL_1 + COL_2 : COL_1;
+        oOut << schema;
+        if ( spacing > schema.length() ) {
+            oOut << std::string( spacing - schema.length(), ' ' );
+        } else {
+            oOut << " ";
+        }
+    }
+
+    oOut << GREENCOLOR << iObj->getFullName() << RESETCOLOR;
+    if ( iOpt.meta ) {
+        oOut << GRAYCOLOR << " {" << md.serialize() << "}" << RESETCOLOR;
+    }
+    oOut << std::endl;
+
+    if ( iOpt.all ) {
+        fastProperties( iObj->getProperties(), iObj->getFullName(),
+                        iDepth, iOpt, oOut );
+    }
+}
+
+//-*****************************************************************************
+// what goes between two children
+void fastSeparator( const FastOptions & iOpt, std::ostream & oOut )
+{
+    if ( iOpt.json ) {
+        oOut << "," << std::endl;
+    }
+}
+
+//-*****************************************************************************
+// what goes after the children of an object
+void fastClose( AbcA::ObjectReaderPtr iObj, std::size_t iDepth,
+                const FastOptions & iOpt, std::ostream & oOut )
+{
+    if ( iOpt.json ) {
+        if ( iObj->getNumChildren() > 0 ) {
+            oOut << std::endl << std::string( 2 * iDepth, ' ' );
+        }
+        oOut << " ]}";
+    }
+}
+
+//-*****************************************************************************
+void fastSubtree( AbcA::ObjectReaderPtr iObj, std::size_t iDepth,
+                  const FastOptions & iOpt, std::ostream & oOut )
+{
+    fastOpen( iObj, iDepth, iOpt, oOut );
+    for ( std::size_t i = 0; i < iObj->getNumChildren(); ++i ) {
+        if ( i > 0 ) {
+            fastSeparator( iOpt, oOut );
+        }
+        fastSubtree( iObj->getChild( i ), iDepth + 1, iOpt, oOut );
+    }
+    fastClose( iObj, iDepth, iOpt, oOut );
+}
+
+//-*****************************************************************************
+// A piece of the output, either text that is already known, or a subtree
+// that still needs listing.
+struct FastPiece
+{
+    FastPiece() : depth( 0 ) {}
+
+    std::string text;
+    AbcA::ObjectReaderPtr obj;
+    std::size_t depth;
+};
+
+//-*****************************************************************************
+// lists the subtree pieces, handing them out round robin to the threads so
+// that big and small subtrees get mixed
+class FastListPieces
+{
+public:
+    FastListPieces( std::vector< FastPiece > & iPieces,
+                    const std::vector< std::size_t > & iSubtrees,
+                    std::size_t iNumThreads, const FastOptions & iOpt )
+        : m_pieces( iPieces ), m_subtrees( iSubtrees ),
+          m_numThreads( iNumThreads ), m_opt( iOpt ) {}
+
+    void operator()( std::size_t iBegin, std::size_t iEnd )
+    {
+        for ( std::size_t t = iBegin; t < iEnd; ++t ) {
+            for ( std::size_t i = t; i < m_subtrees.size();
+                  i += m_numThreads ) {
+                FastPiece & piece = m_pieces[ m_subtrees[i] ];
+                std::ostringstream out;
+                fastSubtree( piece.obj, piece.depth, m_opt, out );
+                piece.text = out.str();
+                piece.obj.reset();
+            }
+        }
+    }
+
+private:
+    std::vector< FastPiece > & m_pieces;
+    const std::vector< std::size_t > & m_subtrees;
+    std::size_t m_numThreads;
+    const FastOptions & m_opt;
+};
+
+//-*****************************************************************************
+void fastList( AbcA::ObjectReaderPtr iObj, std::size_t iNumThreads,
+               const FastOptions & iOpt )
+{
+    std::vector< FastPiece > pieces( 1 );
+    pieces[0].obj = iObj;
+    pieces[0].depth = iOpt.json ? 1 : 0;
+
+    // open up the hierarchy a level at a time, in place, until there are
+    // enough subtrees to keep the threads busy
+    std::size_t wanted = 16 * iNumThreads;
+    std::size_t numSubtrees = 1;
+    while ( iNumThreads > 1 && numSubtrees > 0 && numSubtrees < wanted ) {
+        std::vector< FastPiece > next;
+        numSubtrees = 0;
+        for ( std::size_t i = 0; i < pieces.size(); ++i ) {
+            if ( !pieces[i].obj ) {
+                next.push_back( pieces[i] );
+                continue;
+            }
+
+            AbcA::ObjectReaderPtr obj = pieces[i].obj;
+            std::size_t depth = pieces[i].depth;
+
+            std::ostringstream open;
+            fastOpen( obj, depth, iOpt, open );
+            next.push_back( FastPiece() );
+            next.back().text = open.str();
+
+            for ( std::size_t c = 0; c < obj->getNumChildren(); ++c ) {
+                if ( c > 0 ) {
+                    std::ostringstream sep;
+                    fastSeparator( iOpt, sep );
+                    next.push_back( FastPiece() );
+                    next.back().text = sep.str();
+                }
+                next.push_back( FastPiece() );
+                next.back().obj = obj->getChild( c );
+                next.back().depth = depth + 1;
+                numSubtrees ++;
+            }
+
+            std::ostringstream close;
+            fastClose( obj, depth, iOpt, close );
+            next.push_back( FastPiece() );
+            next.back().text = close.str();
+        }
+        pieces.swap( next );
+    }
+
+    std::vector< std::size_t > subtrees;
+    for ( std::size_t i = 0; i < pieces.size(); ++i ) {
+        if ( pieces[i].obj ) {
+            subtrees.push_back( i );
+        }
+    }
+
+    std::size_t numThreads = std::max( (std::size_t) 1,
+        std::min( iNumThreads, subtrees.size() ) );
+    FastListPieces lister( pieces, subtrees, numThreads, iOpt );
+    AbcU::parallel_for( numThreads, 1, lister, numThreads );
+
+    for ( std::size_t i = 0; i < pieces.size(); ++i ) {
+        std::cout << pieces[i].text;
+    }
+}
+
+//-*****************************************************************************
+void fastListArchive( Abc::IArchive iArchive, AbcA::ObjectReaderPtr iObj,
+                      std::size_t iNumThreads, const FastOptions & iOpt )
+{
+    if ( !iOpt.json ) {
+        fastList( iObj, iNumThreads, iOpt );
+        return;
+    }
+
+    std::cout << "{" << std::endl << "  \"archive\": "
+              << jsonString( iArchive.getName() ) << "," << std::endl
+              << "  \"timeSamplings\": [";
+    for ( std::size_t k = 0; k < iOpt.timeSamplings.size(); ++k ) {
+        AbcA::TimeSamplingPtr ts = iOpt.timeSamplings[k];
+        AbcA::TimeSamplingType timeType = ts->getTimeSamplingType();
+        std::cout << ( k ? "," : "" ) << std::endl << "    {\"index\": " << k
+                  << ", \"type\": ";
+        if ( timeType.isUniform() ) {
+            std::cout << "\"uniform\"";
+        } else if ( timeType.isCyclic() ) {
+            std::cout << "\"cyclic\"";
+        } else {
+            std::cout << "\"acyclic\"";
+        }
+        if ( !timeType.isAcyclic() ) {
+            std::cout << ", \"timePerCycle\": " << timeType.getTimePerCycle();
+        }
+        std::cout << ", \"storedTimes\": [";
+        const std::vector< double > & times = ts->getStoredTimes();
+        for ( std::size_t t = 0; t < times.size(); ++t ) {
+            std::cout << ( t ? ", " : "" ) << times[t];
+        }
+        std::cout << "], \"maxNumSamples\": "
+                  << iArchive.getMaxNumSamplesForTimeSamplingIndex( k )
+                  << "}";
+    }
+    std::cout << std::endl << "  ]," << std::endl << "  \"object\":"
+              << std::endl;
+    fastList( iObj, iNumThreads, iOpt );
+    std::cout << std::endl << "}";
+}
+
 //-*****************************************************************************
 bool isFile( const std::string& filename )
 {
@@ -628,17 +1000,25 @@ int main( int argc, char *argv[] )
     bool opt_size = false; // array sample size option
     bool opt_time = false; // time info option
     bool opt_values = false; // show all 0th values
+    bool opt_fast = false; // header only recursive listing
+    bool opt_json = false; // header only JSON listing
+    std::size_t numThreads = 0; // for the fast listings, 0 means all cores
     int index = -1; // sample number, at tail of path
     std::string desc( "abcls [OPTION] FILE[/NAME] \n"
     "  -a          include property listings\n"
     "  -f          show time sampling as 24 fps\n"
     "  -h, --help  show this help message\n"
+    "  -json       list the hierarchy as JSON, with property sample counts\n"
+    "              and time sampling indices, reading only the headers.\n"
+    "              Several files are listed as one JSON array\n"
     "  -l          long listing format\n"
     "  -m          show archive metadata\n"
     "  -r          list entries recursively\n"
     "  -s          show the size of a data property sample\n"
     "  -t          show time sampling information\n"
     "  -v          show 0th value for all properties\n"
+    "  -x[N]       fast recursive listing that reads only the headers,\n"
+    "              on N threads (default: all cores)\n"
     );
 
     /* sigaction if available */
@@ -667,9 +1047,12 @@ int main( int argc, char *argv[] )
     std::vector<std::string> options;
     std::vector<std::string> files;
 
-    // separate file args from option args
+    // separate file args from option args, -json is taken out first
+    // since the single letter options are matched anywhere in an option
     for ( std::size_t i = 1; i < arguments.size(); i++ ) {
-        if ( arguments[ i ].substr( 0, 1 ) == "-" )
+        if ( arguments[ i ] == "-json" )
+            opt_json = true;
+        else if ( arguments[ i ].substr( 0, 1 ) == "-" )
             options.push_back( arguments[ i ] );
         else
             files.push_back( arguments[ i ] );
@@ -697,11 +1080,30 @@ int main( int argc, char *argv[] )
         fps = 24.0;
         opt_time = true;
     }
+    opt_fast = optionExists( options, "x" );
+    for ( std::size_t i = 0; i < options.size(); i++ ) {
+        std::size_t pos = options[i].find( "x" );
+        if ( pos != std::string::npos &&
+             is_digit( options[i].substr( pos + 1 ) ) ) {
+            numThreads = atoi( options[i].substr( pos + 1 ).c_str() );
+        }
+    }
+    if ( numThreads == 0 ) {
+        numThreads = AbcU::thread::hardware_concurrency();
+    }
+
+    // several files are listed as one JSON array
+    bool jsonArray = opt_json && files.size() > 1;
+    if ( jsonArray ) {
+        std::cout << "[" << std::endl;
+    }
 
     // open each file
     for ( std::size_t i = 0; i < files.size(); i++ ) {
-        if ( files.size() > 1 )
+        if ( files.size() > 1 && !opt_json )
             std::cout << BOLD << files[i] << ':' << RESETCOLOR << std::endl;
+        else if ( jsonArray && i > 0 )
+            std::cout << "," << std::endl;
 
         std::stringstream ss( files[i] );
         std::stringstream fp;
@@ -738,10 +1140,13 @@ int main( int argc, char *argv[] )
         AbcF::IFactory factory;
         factory.setPolicy(Abc::ErrorHandler::kQuietNoopPolicy);
         AbcF::IFactory::CoreType coreType;
+        if ( opt_fast || opt_json ) {
+            factory.setOgawaNumStreams( numThreads );
+        }
         archive = factory.getArchive(std::string( fp.str() ), coreType);
 
         // display file metadata
-        if ( opt_meta && seglist.size() == 0 ) {
+        if ( opt_meta && seglist.size() == 0 && !opt_json ) {
             std::cout  << "Using "
                        << Alembic::AbcCoreAbstract::GetLibraryVersion()
                        << std::endl;;
@@ -785,7 +1190,7 @@ int main( int argc, char *argv[] )
             std::cout << "  core type : " << coreName << std::endl;
         };
 
-        if ( opt_time && seglist.size() == 0 ) {
+        if ( opt_time && seglist.size() == 0 && !opt_json ) {
             uint32_t numTimes = archive.getNumTimeSamplings();
             std::cout << std::endl << "Time Samplings: " << std::endl;
             for ( uint32_t k = 0; k < numTimes; ++k ) {
@@ -842,7 +1247,26 @@ int main( int argc, char *argv[] )
         }
 
         // do stuff
-        if ( shouldPrintValue ) {
+        if ( ( opt_fast || opt_json ) && !found && !shouldPrintValue ) {
+            FastOptions fastOpt;
+            fastOpt.all = opt_all || opt_json;
+            fastOpt.long_list = opt_long;
+            fastOpt.meta = opt_meta;
+            fastOpt.json = opt_json;
+            for ( uint32_t k = 0; k < archive.getNumTimeSamplings(); ++k ) {
+                fastOpt.timeSamplings.push_back( archive.getTimeSampling( k ) );
+            }
+
+            // the HDF5 reader isn't safe to use from several threads
+            std::size_t threads =
+                coreType == AbcF::IFactory::kOgawa ? numThreads : 1;
+            fastListArchive( archive, iObj.getPtr(), threads, fastOpt );
+            if ( !opt_json ) {
+                std::cout << RESETCOLOR;
+            } else if ( !jsonArray ) {
+                std::cout << std::endl;
+            }
+        } else if ( shouldPrintValue ) {
             printValue( props, *header, index, opt_size, opt_time, fps );
         } else {
             if ( found && header->isCompound() )
@@ -856,5 +1280,9 @@ int main( int argc, char *argv[] )
                 std::cout << std::endl;
         }
     }
+
+    if ( jsonArray ) {
+        std::cout << std::endl << "]" << std::endl;
+    }
     return 0;
 }
@@ -0,0 +1,714 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// abcsize reports where the bytes of an Ogawa archive go.
+//
+// It walks the object and property headers (through AbcCoreAbstract, so no
+// samples are read) and, in step with them, the Ogawa groups that hold the
+// samples.  Every data block is charged to the property that owns it, and a
+// block that several samples or properties point at (Ogawa stores identical
+// samples once) is only charged to the first one found, the others record
+// it as shared.
+//
+// Only the top N properties and objects are remembered, along with totals
+// per schema, property name and data type.  Shared blocks are spotted with
+// a fixed size table of block positions (-m), so memory stays bounded no
+// matter how large the archive is.  Once an archive has more blocks than
+// the table holds some positions are forgotten, and a later reference to a
+// forgotten block is charged again instead of counted as shared.  The
+// report says how many positions were forgotten when that happens.
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Ogawa/All.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace AbcA = ::Alembic::AbcCoreAbstract;
+namespace Ogawa = ::Alembic::Ogawa;
+namespace Util = ::Alembic::Util;
+
+namespace
+{
+
+//-*****************************************************************************
+struct Totals
+{
+    Totals() : bytes(0), sharedBytes(0), blocks(0), sharedBlocks(0) {}
+
+    void add(const Totals & iOther)
+    {
+        bytes += iOther.bytes;
+        sharedBytes += iOther.sharedBytes;
+        blocks += iOther.blocks;
+        sharedBlocks += iOther.sharedBlocks;
+    }
+
+    // bytes stored for this, counted once
+    Util::uint64_t bytes;
+
+    // bytes of blocks that were already charged to something else
+    Util::uint64_t sharedBytes;
+
+    Util::uint64_t blocks;
+    Util::uint64_t sharedBlocks;
+};
+
+typedef std::map< std::string, Totals > TotalsMap;
+
+//-*****************************************************************************
+struct Entry
+{
+    std::string path;
+    std::string kind;
+    Totals totals;
+};
+
+bool entryGreater(const Entry & iA, const Entry & iB)
+{
+    if (iA.totals.bytes != iB.totals.bytes)
+    {
+        return iA.totals.bytes > iB.totals.bytes;
+    }
+
+    return iA.path < iB.path;
+}
+
+// keeps the N largest entries that it has been offered
+class TopEntries
+{
+public:
+    TopEntries(std::size_t iMax) : m_max(iMax) {}
+
+    void offer(const std::string & iPath, const std::string & iKind,
+               const Totals & iTotals)
+    {
+        if (m_max == 0)
+        {
+            return;
+        }
+
+        if (m_heap.size() == m_max &&
+            iTotals.bytes <= m_heap.front().totals.bytes)
+        {
+            return;
+        }
+
+        Entry entry;
+        entry.path = iPath;
+        entry.kind = iKind;
+        entry.totals = iTotals;
+
+        // a min heap on the bytes, so the smallest kept entry is in front
+        m_heap.push_back(entry);
+        std::push_heap(m_heap.begin(), m_heap.end(), entryGreater);
+        if (m_heap.size() > m_max)
+        {
+            std::pop_heap(m_heap.begin(), m_heap.end(), entryGreater);
+            m_heap.pop_back();
+        }
+    }
+
+    std::vector< Entry > sorted() const
+    {
+        std::vector< Entry > ret = m_heap;
+        std::sort(ret.begin(), ret.end(), entryGreater);
+        return ret;
+    }
+
+private:
+    std::size_t m_max;
+    std::vector< Entry > m_heap;
+};
+
+//-*****************************************************************************
+// The positions of the blocks charged so far, in a fixed amount of memory.
+// Each position hashes to one slot and replaces whatever was in it, so it
+// never reports a block as seen that wasn't, but can forget ones that were.
+class SeenBlocks
+{
+public:
+    SeenBlocks(std::size_t iMaxBytes) : m_shift(64), m_numForgotten(0)
+    {
+        // a power of two number of slots, 0 marks an empty one since no
+        // block starts at the front of the file
+        std::size_t numSlots = 1;
+        while (numSlots * 2 * sizeof(Util::uint64_t) <= iMaxBytes)
+        {
+            numSlots *= 2;
+            --m_shift;
+        }
+        m_slots.assign(numSlots, 0);
+    }
+
+    // returns whether iPos was already inserted, as far as we remember
+    bool insert(Util::uint64_t iPos)
+    {
+        Util::uint64_t & slot = m_slots[m_shift >= 64 ? 0 :
+            (iPos * 0x9E3779B97F4A7C15ULL) >> m_shift];
+        if (slot == iPos)
+        {
+            return true;
+        }
+
+        if (slot != 0)
+        {
+            m_numForgotten ++;
+        }
+        slot = iPos;
+        return false;
+    }
+
+    Util::uint64_t getNumForgotten() const { return m_numForgotten; }
+
+private:
+    std::vector< Util::uint64_t > m_slots;
+    unsigned int m_shift;
+    Util::uint64_t m_numForgotten;
+};
+
+//-*****************************************************************************
+class SizeProfiler
+{
+public:
+    SizeProfiler(std::size_t iTopN, std::size_t iMaxSeenBytes) :
+        m_topProperties(iTopN), m_topObjects(iTopN), m_seen(iMaxSeenBytes) {}
+
+    void profile(AbcA::ArchiveReaderPtr iArchive, Ogawa::IGroupPtr iRoot);
+
+    void printText(std::ostream & iOut, const std::string & iFileName,
+                   Util::uint64_t iFileSize) const;
+
+    void printJson(std::ostream & iOut, const std::string & iFileName,
+                   Util::uint64_t iFileSize) const;
+
+private:
+    void visitObject(AbcA::ObjectReaderPtr iObject, Ogawa::IGroupPtr iGroup);
+
+    void visitCompound(AbcA::CompoundPropertyReaderPtr iCompound,
+                       Ogawa::IGroupPtr iGroup, const std::string & iPath,
+                       Totals & ioObjectTotals, Totals & ioStructure);
+
+    // charges a data block, or counts it as shared if it already was
+    void chargeData(Ogawa::IGroupPtr iGroup, Util::uint64_t iIndex,
+                    Totals & ioTotals);
+
+    // charges the child table of a group
+    void chargeGroup(Ogawa::IGroupPtr iGroup, Totals & ioStructure);
+
+    TopEntries m_topProperties;
+    TopEntries m_topObjects;
+
+    TotalsMap m_bySchema;
+    TotalsMap m_byPropertyName;
+    TotalsMap m_byDataType;
+
+    Totals m_samples;
+    Totals m_structure;
+    Totals m_archive;
+
+    Util::uint64_t m_numObjects;
+    Util::uint64_t m_numProperties;
+
+    // positions of the blocks charged so far
+    SeenBlocks m_seen;
+};
+
+//-*****************************************************************************
+void SizeProfiler::chargeData(Ogawa::IGroupPtr iGroup, Util::uint64_t iIndex,
+                              Totals & ioTotals)
+{
+    if (!iGroup->isChildData(iIndex) || iGroup->isEmptyChildData(iIndex))
+    {
+        return;
+    }
+
+    Ogawa::IDataPtr data = iGroup->getData(iIndex, 0);
+    if (!data)
+    {
+        return;
+    }
+
+    // the size is stored in front of the data
+    Util::uint64_t bytes = data->getSize() + 8;
+    if (m_seen.insert(data->getPos()))
+    {
+        ioTotals.sharedBytes += bytes;
+        ioTotals.sharedBlocks ++;
+        return;
+    }
+
+    ioTotals.bytes += bytes;
+    ioTotals.blocks ++;
+}
+
+//-*****************************************************************************
+void SizeProfiler::chargeGroup(Ogawa::IGroupPtr iGroup, Totals & ioStructure)
+{
+    Util::uint64_t numChildren = iGroup->getNumChildren();
+    if (numChildren > 0)
+    {
+        // the number of children, then the position of each one
+        ioStructure.bytes += 8 * (numChildren + 1);
+        ioStructure.blocks ++;
+    }
+}
+
+//-*****************************************************************************
+void SizeProfiler::profile(AbcA::ArchiveReaderPtr iArchive,
+                           Ogawa::IGroupPtr iRoot)
+{
+    m_numObjects = 0;
+    m_numProperties = 0;
+
+    chargeGroup(iRoot, m_archive);
+
+    // everything but the top object: the versions, the archive metadata,
+    // the time samplings and the indexed metadata
+    for (Util::uint64_t i = 0; i < iRoot->getNumChildren(); ++i)
+    {
+        if (i != 2)
+        {
+            chargeData(iRoot, i, m_archive);
+        }
+    }
+
+    visitObject(iArchive->getTop(), iRoot->getGroup(2, false, 0));
+}
+
+//-*****************************************************************************
+void SizeProfiler::visitObject(AbcA::ObjectReaderPtr iObject,
+                               Ogawa::IGroupPtr iGroup)
+{
+    m_numObjects ++;
+
+    Util::uint64_t numChildren = iGroup->getNumChildren();
+    chargeGroup(iGroup, m_structure);
+
+    // the headers of the children (and the object hashes) are last
+    if (numChildren > 0 && iGroup->isChildData(numChildren - 1))
+    {
+        chargeData(iGroup, numChildren - 1, m_structure);
+    }
+
+    Totals objectTotals;
+    if (numChildren > 0 && iGroup->isChildGroup(0))
+    {
+        visitCompound(iObject->getProperties(), iGroup->getGroup(0, false, 0),
+                      iObject->getFullName(), objectTotals, m_structure);
+    }
+
+    std::string schema = iObject->getMetaData().get("schema");
+    if (schema.empty())
+    {
+        schema = "(none)";
+    }
+
+    m_bySchema[schema].add(objectTotals);
+    m_topObjects.offer(iObject->getFullName(), schema, objectTotals);
+
+    // the groups of the children follow the properties
+    for (size_t i = 0; i < iObject->getNumChildren(); ++i)
+    {
+        if (i + 1 < numChildren && iGroup->isChildGroup(i + 1))
+        {
+            visitObject(iObject->getChild(i), iGroup->getGroup(i + 1, false, 0));
+        }
+    }
+}
+
+//-*****************************************************************************
+void SizeProfiler::visitCompound(AbcA::CompoundPropertyReaderPtr iCompound,
+                                 Ogawa::IGroupPtr iGroup,
+                                 const std::string & iPath,
+                                 Totals & ioObjectTotals, Totals & ioStructure)
+{
+    Util::uint64_t numChildren = iGroup->getNumChildren();
+    chargeGroup(iGroup, ioStructure);
+
+    // the property headers are last
+    if (numChildren > 0 && iGroup->isChildData(numChildren - 1))
+    {
+        chargeData(iGroup, numChildren - 1, ioStructure);
+    }
+
+    std::string prefix = iPath;
+    if (prefix != "/")
+    {
+        prefix += "/";
+    }
+
+    for (size_t i = 0; i < iCompound->getNumProperties(); ++i)
+    {
+        if (i >= numChildren || !iGroup->isChildGroup(i))
+        {
+            continue;
+        }
+
+        const AbcA::PropertyHeader & header = iCompound->getPropertyHeader(i);
+        Ogawa::IGroupPtr group = iGroup->getGroup(i, false, 0);
+        std::string path = prefix + header.getName();
+
+        if (header.isCompound())
+        {
+            visitCompound(iCompound->getCompoundProperty(header.getName()),
+                          group, path, ioObjectTotals, ioStructure);
+            continue;
+        }
+
+        m_numProperties ++;
+        chargeGroup(group, ioStructure);
+
+        // scalar samples are one block each, array samples are a block of
+        // data followed by a block of dimensions
+        Totals propTotals;
+        for (Util::uint64_t j = 0; j < group->getNumChildren(); ++j)
+        {
+            chargeData(group, j, propTotals);
+        }
+
+        std::ostringstream dataType;
+        dataType << header.getDataType();
+        if (header.isArray())
+        {
+            dataType << "[]";
+        }
+
+        m_topProperties.offer(path, dataType.str(), propTotals);
+        m_byPropertyName[header.getName()].add(propTotals);
+        m_byDataType[dataType.str()].add(propTotals);
+        m_samples.add(propTotals);
+        ioObjectTotals.add(propTotals);
+    }
+}
+
+//-*****************************************************************************
+std::string percent(Util::uint64_t iPart, Util::uint64_t iWhole)
+{
+    std::ostringstream ret;
+    ret << std::fixed << std::setprecision(1);
+    ret << (iWhole ? 100.0 * (double) iPart / (double) iWhole : 0.0) << "%";
+    return ret.str();
+}
+
+//-*****************************************************************************
+void printTotalsMap(std::ostream & iOut, const std::string & iTitle,
+                    const TotalsMap & iMap, std::size_t iTopN,
+                    Util::uint64_t iFileSize)
+{
+    std::vector< Entry > entries;
+    for (TotalsMap::const_iterator it = iMap.begin(); it != iMap.end(); ++it)
+    {
+        Entry entry;
+        entry.path = it->first;
+        entry.totals = it->second;
+        entries.push_back(entry);
+    }
+    std::sort(entries.begin(), entries.end(), entryGreater);
+    if (entries.size() > iTopN)
+    {
+        entries.resize(iTopN);
+    }
+
+    iOut << std::endl << iTitle << ":" << std::endl;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        const Totals & t = entries[i].totals;
+        iOut << std::setw(16) << t.bytes << std::setw(8)
+             << percent(t.bytes, iFileSize) << std::setw(16) << t.sharedBytes
+             << "  " << entries[i].path << std::endl;
+    }
+}
+
+//-*****************************************************************************
+void printEntries(std::ostream & iOut, const std::string & iTitle,
+                  const std::vector< Entry > & iEntries,
+                  Util::uint64_t iFileSize)
+{
+    iOut << std::endl << iTitle << ":" << std::endl;
+    for (std::size_t i = 0; i < iEntries.size(); ++i)
+    {
+        const Totals & t = iEntries[i].totals;
+        iOut << std::setw(16) << t.bytes << std::setw(8)
+             << percent(t.bytes, iFileSize) << std::setw(16) << t.sharedBytes
+             << "  " << iEntries[i].path << "  (" << iEntries[i].kind << ")"
+             << std::endl;
+    }
+}
+
+//-*****************************************************************************
+void SizeProfiler::printText(std::ostream & iOut, const std::string & iFileName,
+                             Util::uint64_t iFileSize) const
+{
+    Util::uint64_t accounted = m_samples.bytes + m_structure.bytes +
+        m_archive.bytes + 16;
+
+    iOut << iFileName << ": " << iFileSize << " bytes, " << m_numObjects
+         << " objects, " << m_numProperties << " properties" << std::endl;
+    iOut << "  samples:              " << std::setw(16) << m_samples.bytes
+         << std::setw(8) << percent(m_samples.bytes, iFileSize)
+         << " in " << m_samples.blocks << " blocks" << std::endl;
+    iOut << "  shared samples:       " << std::setw(16)
+         << m_samples.sharedBytes << std::setw(8) << " "
+         << " in " << m_samples.sharedBlocks
+         << " references, stored only once" << std::endl;
+    iOut << "  headers and groups:   " << std::setw(16) << m_structure.bytes
+         << std::setw(8) << percent(m_structure.bytes, iFileSize) << std::endl;
+    iOut << "  archive info:         " << std::setw(16) << m_archive.bytes
+         << std::setw(8) << percent(m_archive.bytes, iFileSize) << std::endl;
+    iOut << "  unreferenced:         " << std::setw(16)
+         << (iFileSize > accounted ? iFileSize - accounted : 0) << std::endl;
+
+    if (m_seen.getNumForgotten() > 0)
+    {
+        iOut << "  forgot " << m_seen.getNumForgotten() << " block positions,"
+             << " some shared samples may be charged more than once,"
+             << " raise -m" << std::endl;
+    }
+
+    std::size_t topN = m_topProperties.sorted().size();
+    iOut << std::endl << "columns: stored bytes, % of file, shared bytes"
+         << std::endl;
+    printEntries(iOut, "largest properties", m_topProperties.sorted(),
+                 iFileSize);
+    printEntries(iOut, "largest objects (own properties)",
+                 m_topObjects.sorted(), iFileSize);
+    printTotalsMap(iOut, "by schema", m_bySchema, topN, iFileSize);
+    printTotalsMap(iOut, "by property name", m_byPropertyName, topN,
+                   iFileSize);
+    printTotalsMap(iOut, "by data type", m_byDataType, topN, iFileSize);
+}
+
+//-*****************************************************************************
+std::string jsonString(const std::string & iStr)
+{
+    std::ostringstream ret;
+    ret << "\"";
+    for (std::size_t i = 0; i < iStr.size(); ++i)
+    {
+        unsigned char c = iStr[i];
+        if (c == '"' || c == '\\')
+        {
+            ret << "\\" << c;
+        }
+        else if (c < 0x20)
+        {
+            ret << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << (int) c << std::dec << std::setfill(' ');
+        }
+        else
+        {
+            ret << c;
+        }
+    }
+    ret << "\"";
+    return ret.str();
+}
+
+//-*****************************************************************************
+void printJsonTotals(std::ostream & iOut, const Totals & iTotals)
+{
+    iOut << "\"bytes\": " << iTotals.bytes
+         << ", \"blocks\": " << iTotals.blocks
+         << ", \"sharedBytes\": " << iTotals.sharedBytes
+         << ", \"sharedBlocks\": " << iTotals.sharedBlocks;
+}
+
+//-*****************************************************************************
+void printJsonEntries(std::ostream & iOut, const std::string & iName,
+                      const std::string & iKindName,
+                      const std::vector< Entry > & iEntries)
+{
+    iOut << "  " << jsonString(iName) << ": [";
+    for (std::size_t i = 0; i < iEntries.size(); ++i)
+    {
+        iOut << (i ? "," : "") << std::endl << "    {\"path\": "
+             << jsonString(iEntries[i].path) << ", " << jsonString(iKindName)
+             << ": " << jsonString(iEntries[i].kind) << ", ";
+        printJsonTotals(iOut, iEntries[i].totals);
+        iOut << "}";
+    }
+    iOut << std::endl << "  ]";
+}
+
+//-*****************************************************************************
+void printJsonMap(std::ostream & iOut, const std::string & iName,
+                  const TotalsMap & iMap)
+{
+    iOut << "  " << jsonString(iName) << ": {";
+    for (TotalsMap::const_iterator it = iMap.begin(); it != iMap.end(); ++it)
+    {
+        iOut << (it != iMap.begin() ? "," : "") << std::endl << "    "
+             << jsonString(it->first) << ": {";
+        printJsonTotals(iOut, it->second);
+        iOut << "}";
+    }
+    iOut << std::endl << "  }";
+}
+
+//-*****************************************************************************
+void SizeProfiler::printJson(std::ostream & iOut, const std::string & iFileName,
+                             Util::uint64_t iFileSize) const
+{
+    iOut << "{" << std::endl;
+    iOut << "  \"file\": " << jsonString(iFileName) << "," << std::endl;
+    iOut << "  \"fileBytes\": " << iFileSize << "," << std::endl;
+    iOut << "  \"numObjects\": " << m_numObjects << "," << std::endl;
+    iOut << "  \"numProperties\": " << m_numProperties << "," << std::endl;
+    iOut << "  \"forgottenBlocks\": " << m_seen.getNumForgotten() << ","
+         << std::endl;
+    iOut << "  \"samples\": {";
+    printJsonTotals(iOut, m_samples);
+    iOut << "}," << std::endl << "  \"structure\": {";
+    printJsonTotals(iOut, m_structure);
+    iOut << "}," << std::endl << "  \"archive\": {";
+    printJsonTotals(iOut, m_archive);
+    iOut << "}," << std::endl;
+    printJsonEntries(iOut, "properties", "dataType", m_topProperties.sorted());
+    iOut << "," << std::endl;
+    printJsonEntries(iOut, "objects", "schema", m_topObjects.sorted());
+    iOut << "," << std::endl;
+    printJsonMap(iOut, "bySchema", m_bySchema);
+    iOut << "," << std::endl;
+    printJsonMap(iOut, "byPropertyName", m_byPropertyName);
+    iOut << "," << std::endl;
+    printJsonMap(iOut, "byDataType", m_byDataType);
+    iOut << std::endl << "}" << std::endl;
+}
+
+}
+
+//-*****************************************************************************
+int main(int argc, char *argv[])
+{
+    std::string desc("abcsize [-n N] [-m MB] [-json] FILE\n"
+    "Reports how the bytes of an Ogawa archive are spent on its objects\n"
+    "and properties.  Samples shared by several properties (or repeated\n"
+    "within one) are stored once, and are counted once, for the first\n"
+    "property that refers to them.\n"
+    "  -n N        how many of the largest entries to list, default 20\n"
+    "  -m MB       memory for spotting shared samples, default 32.  Archives\n"
+    "              with more blocks than fit may charge some shared samples\n"
+    "              more than once, the report says when that happened\n"
+    "  -json       print the report as JSON\n"
+    "  -h, --help  prints this help message\n");
+
+    std::size_t topN = 20;
+    std::size_t seenMB = 32;
+    bool json = false;
+    std::string fileName;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+        {
+            topN = (std::size_t) std::max(0, atoi(argv[++i]));
+        }
+        else if (arg == "-m" && i + 1 < argc)
+        {
+            seenMB = (std::size_t) std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "-json")
+        {
+            json = true;
+        }
+        else if (arg.substr(0, 1) == "-" || !fileName.empty())
+        {
+            std::cout << desc << std::endl;
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+        else
+        {
+            fileName = arg;
+        }
+    }
+
+    if (fileName.empty())
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    Util::uint64_t fileSize = 0;
+    {
+        std::ifstream file(fileName.c_str(), std::ios::binary | std::ios::ate);
+        if (file)
+        {
+            fileSize = file.tellg();
+        }
+    }
+
+    Ogawa::IArchive ogawa(fileName);
+    if (!ogawa.isValid())
+    {
+        std::cerr << "ERROR: " << fileName << " is not an Ogawa archive"
+                  << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        Alembic::AbcCoreOgawa::ReadArchive reader;
+        AbcA::ArchiveReaderPtr archive = reader(fileName);
+
+        SizeProfiler profiler(topN, seenMB * 1024 * 1024);
+        profiler.profile(archive, ogawa.getGroup());
+
+        if (json)
+        {
+            profiler.printJson(std::cout, fileName, fileSize);
+        }
+        else
+        {
+            profiler.printText(std::cout, fileName, fileSize);
+        }
+    }
+    catch (std::exception & e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
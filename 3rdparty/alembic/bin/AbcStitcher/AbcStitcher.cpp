@@ -45,6 +45,7 @@
 
 #include "util.h"
 
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -65,25 +66,663 @@ inline void stitchVisible(ICompoundPropertyVec & iCompoundProps,
     stitchScalarProp(*propHeaderPtr, iCompoundProps, oCompoundProp, iTimeMap);
 }
 
-template< class IPARAM, class IPARAMSAMP, class OPARAMSAMP >
-void getOGeomParamSamp(IPARAM & iGeomParam, IPARAMSAMP & iGeomSamp,
-                     OPARAMSAMP & oGeomSamp, index_t iIndex)
+template< class PTR >
+size_t sampleBytes(const PTR & iSamp)
+{
+    if (!iSamp)
+    {
+        return 0;
+    }
+
+    return iSamp->getDimensions().numPoints() *
+        iSamp->getDataType().getNumBytes();
+}
+
+template< class IPARAM >
+size_t readGeomParamSamp(IPARAM & iGeomParam,
+                         typename IPARAM::Sample & oGeomSamp, index_t iIndex)
 {
     if (iGeomParam.isIndexed())
     {
-        iGeomParam.getIndexed(iGeomSamp, iIndex);
-        oGeomSamp.setVals(*(iGeomSamp.getVals()));
-        oGeomSamp.setScope(iGeomSamp.getScope());
-        oGeomSamp.setIndices(*(iGeomSamp.getIndices()));
+        iGeomParam.getIndexed(oGeomSamp, iIndex);
     }
     else
     {
-        iGeomParam.getExpanded(iGeomSamp, iIndex);
-        oGeomSamp.setVals(*(iGeomSamp.getVals()));
-        oGeomSamp.setScope(iGeomSamp.getScope());
+        iGeomParam.getExpanded(oGeomSamp, iIndex);
     }
+
+    return sampleBytes(oGeomSamp.getVals()) +
+        sampleBytes(oGeomSamp.getIndices());
 }
 
+template< class IPARAMSAMP, class OPARAMSAMP >
+void setOGeomParamSamp(const IPARAMSAMP & iGeomSamp, OPARAMSAMP & oGeomSamp)
+{
+    oGeomSamp.setVals(*(iGeomSamp.getVals()));
+    oGeomSamp.setScope(iGeomSamp.getScope());
+    if (iGeomSamp.isIndexed())
+    {
+        oGeomSamp.setIndices(*(iGeomSamp.getIndices()));
+    }
+}
+
+//-*****************************************************************************
+// How each geometry schema is stitched, for SchemaInputs.
+//
+// Params are the geom params of one input, Sample holds one input sample
+// with its geom param samples.  read() fills a Sample and returns roughly
+// how many bytes it holds, it may run on any thread.  begin() and write()
+// are only called on the writing thread, in input order.
+//-*****************************************************************************
+
+struct SubDStitch
+{
+    typedef ISubD IData;
+    typedef ISubDSchema ISchema;
+    typedef OSubDSchema OSchema;
+
+    struct Params
+    {
+        Params() {};
+        Params(ISchema & iSchema) : uvs(iSchema.getUVsParam()) {};
+
+        IV2fGeomParam uvs;
+    };
+
+    struct Sample
+    {
+        ISchema::Sample samp;
+        IV2fGeomParam::Sample uvs;
+    };
+
+    static OSchema::Sample emptySample()
+    {
+        return OSchema::Sample(P3fArraySample::emptySample(),
+            Int32ArraySample::emptySample(), Int32ArraySample::emptySample());
+    }
+
+    static void begin(Params & iParams, OSchema & oSchema)
+    {
+        if (oSchema.getNumSamples() == 0 && iParams.uvs)
+        {
+            oSchema.setUVSourceName(GetSourceName(iParams.uvs.getMetaData()));
+        }
+    }
+
+    static size_t read(ISchema & iSchema, Params & iParams, index_t iIndex,
+                       Sample & oSamp)
+    {
+        oSamp.samp = iSchema.getValue(iIndex);
+        size_t bytes = sampleBytes(oSamp.samp.getPositions()) +
+            sampleBytes(oSamp.samp.getVelocities()) +
+            sampleBytes(oSamp.samp.getFaceIndices()) +
+            sampleBytes(oSamp.samp.getFaceCounts());
+
+        if (iParams.uvs)
+        {
+            bytes += readGeomParamSamp(iParams.uvs, oSamp.uvs, iIndex);
+        }
+
+        return bytes;
+    }
+
+    static void write(Params & iParams, Sample & iSample, OSchema & oSchema)
+    {
+        ISchema::Sample & iSamp = iSample.samp;
+        OSchema::Sample oSamp;
+
+        Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
+        if (posPtr)
+            oSamp.setPositions(*posPtr);
+
+        Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
+        if (velocPtr)
+            oSamp.setVelocities(*velocPtr);
+
+        Abc::Int32ArraySamplePtr faceIndicesPtr = iSamp.getFaceIndices();
+        if (faceIndicesPtr)
+            oSamp.setFaceIndices(*faceIndicesPtr);
+
+        Abc::Int32ArraySamplePtr faceCntPtr = iSamp.getFaceCounts();
+        if (faceCntPtr)
+            oSamp.setFaceCounts(*faceCntPtr);
+
+        oSamp.setFaceVaryingInterpolateBoundary(iSamp.getFaceVaryingInterpolateBoundary());
+        oSamp.setFaceVaryingPropagateCorners(iSamp.getFaceVaryingPropagateCorners());
+        oSamp.setInterpolateBoundary(iSamp.getInterpolateBoundary());
+
+        Abc::Int32ArraySamplePtr creaseIndicesPtr = iSamp.getCreaseIndices();
+        if (creaseIndicesPtr)
+            oSamp.setCreaseIndices(*creaseIndicesPtr);
+
+        Abc::Int32ArraySamplePtr creaseLenPtr = iSamp.getCreaseLengths();
+        if (creaseLenPtr)
+            oSamp.setCreaseLengths(*creaseLenPtr);
+
+        Abc::FloatArraySamplePtr creaseSpPtr = iSamp.getCreaseSharpnesses();
+        if (creaseSpPtr)
+            oSamp.setCreaseSharpnesses(*creaseSpPtr);
+
+        Abc::Int32ArraySamplePtr cornerIndicesPtr = iSamp.getCornerIndices();
+        if (cornerIndicesPtr)
+            oSamp.setCornerIndices(*cornerIndicesPtr);
+
+        Abc::FloatArraySamplePtr cornerSpPtr = iSamp.getCornerSharpnesses();
+        if (cornerSpPtr)
+            oSamp.setCornerSharpnesses(*cornerSpPtr);
+
+        Abc::Int32ArraySamplePtr holePtr = iSamp.getHoles();
+        if (holePtr)
+            oSamp.setHoles(*holePtr);
+
+        oSamp.setSubdivisionScheme(iSamp.getSubdivisionScheme());
+
+        // set uvs
+        OV2fGeomParam::Sample oUVSample;
+        if (iParams.uvs)
+        {
+            setOGeomParamSamp(iSample.uvs, oUVSample);
+            oSamp.setUVs(oUVSample);
+        }
+
+        oSchema.set(oSamp);
+    }
+};
+
+struct PolyMeshStitch
+{
+    typedef IPolyMesh IData;
+    typedef IPolyMeshSchema ISchema;
+    typedef OPolyMeshSchema OSchema;
+
+    struct Params
+    {
+        Params() {};
+        Params(ISchema & iSchema) :
+            normals(iSchema.getNormalsParam()), uvs(iSchema.getUVsParam()) {};
+
+        IN3fGeomParam normals;
+        IV2fGeomParam uvs;
+    };
+
+    struct Sample
+    {
+        ISchema::Sample samp;
+        IN3fGeomParam::Sample normals;
+        IV2fGeomParam::Sample uvs;
+    };
+
+    static OSchema::Sample emptySample()
+    {
+        return OSchema::Sample(P3fArraySample::emptySample(),
+            Int32ArraySample::emptySample(), Int32ArraySample::emptySample());
+    }
+
+    static void begin(Params & iParams, OSchema & oSchema)
+    {
+        if (oSchema.getNumSamples() == 0 && iParams.uvs)
+        {
+            oSchema.setUVSourceName(GetSourceName(iParams.uvs.getMetaData()));
+        }
+    }
+
+    static size_t read(ISchema & iSchema, Params & iParams, index_t iIndex,
+                       Sample & oSamp)
+    {
+        oSamp.samp = iSchema.getValue(iIndex);
+        size_t bytes = sampleBytes(oSamp.samp.getPositions()) +
+            sampleBytes(oSamp.samp.getVelocities()) +
+            sampleBytes(oSamp.samp.getFaceIndices()) +
+            sampleBytes(oSamp.samp.getFaceCounts());
+
+        if (iParams.uvs)
+        {
+            bytes += readGeomParamSamp(iParams.uvs, oSamp.uvs, iIndex);
+        }
+
+        if (iParams.normals)
+        {
+            bytes += readGeomParamSamp(iParams.normals, oSamp.normals, iIndex);
+        }
+
+        return bytes;
+    }
+
+    static void write(Params & iParams, Sample & iSample, OSchema & oSchema)
+    {
+        ISchema::Sample & iSamp = iSample.samp;
+        OSchema::Sample oSamp;
+
+        Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
+        if (posPtr)
+            oSamp.setPositions(*posPtr);
+
+        Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
+        if (velocPtr)
+            oSamp.setVelocities(*velocPtr);
+
+        Abc::Int32ArraySamplePtr faceIndicesPtr = iSamp.getFaceIndices();
+        if (faceIndicesPtr)
+            oSamp.setFaceIndices(*faceIndicesPtr);
+
+        Abc::Int32ArraySamplePtr faceCntPtr = iSamp.getFaceCounts();
+        if (faceCntPtr)
+            oSamp.setFaceCounts(*faceCntPtr);
+
+        // set uvs
+        OV2fGeomParam::Sample oUVSample;
+        if (iParams.uvs)
+        {
+            setOGeomParamSamp(iSample.uvs, oUVSample);
+            oSamp.setUVs(oUVSample);
+        }
+
+        // set normals
+        ON3fGeomParam::Sample oNormalsSample;
+        if (iParams.normals)
+        {
+            setOGeomParamSamp(iSample.normals, oNormalsSample);
+            oSamp.setNormals(oNormalsSample);
+        }
+
+        oSchema.set(oSamp);
+    }
+};
+
+struct CurvesStitch
+{
+    typedef ICurves IData;
+    typedef ICurvesSchema ISchema;
+    typedef OCurvesSchema OSchema;
+
+    struct Params
+    {
+        Params() {};
+        Params(ISchema & iSchema) :
+            uvs(iSchema.getUVsParam()), normals(iSchema.getNormalsParam()),
+            widths(iSchema.getWidthsParam()) {};
+
+        IV2fGeomParam uvs;
+        IN3fGeomParam normals;
+        IFloatGeomParam widths;
+    };
+
+    struct Sample
+    {
+        ISchema::Sample samp;
+        IV2fGeomParam::Sample uvs;
+        IN3fGeomParam::Sample normals;
+        IFloatGeomParam::Sample widths;
+    };
+
+    static OSchema::Sample emptySample()
+    {
+        return OSchema::Sample(P3fArraySample::emptySample(),
+            Int32ArraySample::emptySample());
+    }
+
+    static void begin(Params & iParams, OSchema & oSchema) {}
+
+    static size_t read(ISchema & iSchema, Params & iParams, index_t iIndex,
+                       Sample & oSamp)
+    {
+        oSamp.samp = iSchema.getValue(iIndex);
+        size_t bytes = sampleBytes(oSamp.samp.getPositions()) +
+            sampleBytes(oSamp.samp.getVelocities()) +
+            sampleBytes(oSamp.samp.getCurvesNumVertices()) +
+            sampleBytes(oSamp.samp.getKnots()) +
+            sampleBytes(oSamp.samp.getOrders());
+
+        if (iParams.widths)
+        {
+            bytes += readGeomParamSamp(iParams.widths, oSamp.widths, iIndex);
+        }
+
+        if (iParams.uvs)
+        {
+            bytes += readGeomParamSamp(iParams.uvs, oSamp.uvs, iIndex);
+        }
+
+        if (iParams.normals)
+        {
+            bytes += readGeomParamSamp(iParams.normals, oSamp.normals, iIndex);
+        }
+
+        return bytes;
+    }
+
+    static void write(Params & iParams, Sample & iSample, OSchema & oSchema)
+    {
+        ISchema::Sample & iSamp = iSample.samp;
+
+        OSchema::Sample oSamp;
+        Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
+        if (posPtr)
+            oSamp.setPositions(*posPtr);
+
+        Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
+        if (velocPtr)
+            oSamp.setVelocities(*velocPtr);
+
+        oSamp.setType(iSamp.getType());
+        Abc::Int32ArraySamplePtr curvsNumPtr = iSamp.getCurvesNumVertices();
+        if (curvsNumPtr)
+            oSamp.setCurvesNumVertices(*curvsNumPtr);
+        oSamp.setWrap(iSamp.getWrap());
+        oSamp.setBasis(iSamp.getBasis());
+
+        Abc::FloatArraySamplePtr knotsPtr = iSamp.getKnots();
+        if (knotsPtr)
+        {
+            oSamp.setKnots(*knotsPtr);
+        }
+
+        Abc::UcharArraySamplePtr ordersPtr = iSamp.getOrders();
+        if (ordersPtr)
+        {
+            oSamp.setOrders(*ordersPtr);
+        }
+
+        OFloatGeomParam::Sample oWidthSample;
+        if (iParams.widths)
+        {
+            setOGeomParamSamp(iSample.widths, oWidthSample);
+            oSamp.setWidths(oWidthSample);
+        }
+
+        OV2fGeomParam::Sample oUVSample;
+        if (iParams.uvs)
+        {
+            setOGeomParamSamp(iSample.uvs, oUVSample);
+            oSamp.setUVs(oUVSample);
+        }
+
+        ON3fGeomParam::Sample oNormalsSample;
+        if (iParams.normals)
+        {
+            setOGeomParamSamp(iSample.normals, oNormalsSample);
+            oSamp.setNormals(oNormalsSample);
+        }
+
+        oSchema.set(oSamp);
+    }
+};
+
+struct PointsStitch
+{
+    typedef IPoints IData;
+    typedef IPointsSchema ISchema;
+    typedef OPointsSchema OSchema;
+
+    struct Params
+    {
+        Params() {};
+        Params(ISchema & iSchema) : widths(iSchema.getWidthsParam()) {};
+
+        IFloatGeomParam widths;
+    };
+
+    struct Sample
+    {
+        ISchema::Sample samp;
+        IFloatGeomParam::Sample widths;
+    };
+
+    static OSchema::Sample emptySample()
+    {
+        return OSchema::Sample(P3fArraySample::emptySample(),
+            UInt64ArraySample::emptySample());
+    }
+
+    static void begin(Params & iParams, OSchema & oSchema) {}
+
+    static size_t read(ISchema & iSchema, Params & iParams, index_t iIndex,
+                       Sample & oSamp)
+    {
+        oSamp.samp = iSchema.getValue(iIndex);
+        size_t bytes = sampleBytes(oSamp.samp.getPositions()) +
+            sampleBytes(oSamp.samp.getIds()) +
+            sampleBytes(oSamp.samp.getVelocities());
+
+        if (iParams.widths)
+        {
+            bytes += readGeomParamSamp(iParams.widths, oSamp.widths, iIndex);
+        }
+
+        return bytes;
+    }
+
+    static void write(Params & iParams, Sample & iSample, OSchema & oSchema)
+    {
+        ISchema::Sample & iSamp = iSample.samp;
+        OSchema::Sample oSamp;
+        Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
+        if (posPtr)
+            oSamp.setPositions(*posPtr);
+        Abc::UInt64ArraySamplePtr idPtr = iSamp.getIds();
+        if (idPtr)
+            oSamp.setIds(*idPtr);
+        Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
+        if (velocPtr)
+            oSamp.setVelocities(*velocPtr);
+
+        OFloatGeomParam::Sample oWidthSample;
+        if (iParams.widths)
+        {
+            setOGeomParamSamp(iSample.widths, oWidthSample);
+            oSamp.setWidths(oWidthSample);
+        }
+
+        oSchema.set(oSamp);
+    }
+};
+
+struct NuPatchStitch
+{
+    typedef INuPatch IData;
+    typedef INuPatchSchema ISchema;
+    typedef ONuPatchSchema OSchema;
+
+    struct Params
+    {
+        Params() : hasTrimCurve(false) {};
+        Params(ISchema & iSchema) :
+            normals(iSchema.getNormalsParam()), uvs(iSchema.getUVsParam()),
+            hasTrimCurve(iSchema.hasTrimCurve()) {};
+
+        IN3fGeomParam normals;
+        IV2fGeomParam uvs;
+        bool hasTrimCurve;
+    };
+
+    struct Sample
+    {
+        ISchema::Sample samp;
+        IN3fGeomParam::Sample normals;
+        IV2fGeomParam::Sample uvs;
+    };
+
+    static OSchema::Sample emptySample()
+    {
+        Alembic::Util::int32_t zeroVal = 0;
+        return OSchema::Sample(P3fArraySample::emptySample(),
+            zeroVal, zeroVal, zeroVal, zeroVal,
+            FloatArraySample::emptySample(), FloatArraySample::emptySample());
+    }
+
+    static void begin(Params & iParams, OSchema & oSchema) {}
+
+    static size_t read(ISchema & iSchema, Params & iParams, index_t iIndex,
+                       Sample & oSamp)
+    {
+        oSamp.samp = iSchema.getValue(iIndex);
+        size_t bytes = sampleBytes(oSamp.samp.getPositions()) +
+            sampleBytes(oSamp.samp.getVelocities()) +
+            sampleBytes(oSamp.samp.getUKnot()) +
+            sampleBytes(oSamp.samp.getVKnot());
+
+        if (iParams.uvs)
+        {
+            bytes += readGeomParamSamp(iParams.uvs, oSamp.uvs, iIndex);
+        }
+
+        if (iParams.normals)
+        {
+            bytes += readGeomParamSamp(iParams.normals, oSamp.normals, iIndex);
+        }
+
+        return bytes;
+    }
+
+    static void write(Params & iParams, Sample & iSample, OSchema & oSchema)
+    {
+        ISchema::Sample & iSamp = iSample.samp;
+        OSchema::Sample oSamp;
+
+        Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
+        if (posPtr)
+            oSamp.setPositions(*posPtr);
+
+        Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
+        if (velocPtr)
+            oSamp.setVelocities(*velocPtr);
+
+        oSamp.setNu(iSamp.getNumU());
+        oSamp.setNv(iSamp.getNumV());
+        oSamp.setUOrder(iSamp.getUOrder());
+        oSamp.setVOrder(iSamp.getVOrder());
+
+        Abc::FloatArraySamplePtr uKnotsPtr = iSamp.getUKnot();
+        if (uKnotsPtr)
+            oSamp.setUKnot(*uKnotsPtr);
+
+        Abc::FloatArraySamplePtr vKnotsPtr = iSamp.getVKnot();
+        if (vKnotsPtr)
+            oSamp.setVKnot(*vKnotsPtr);
+
+        OV2fGeomParam::Sample oUVSample;
+        if (iParams.uvs)
+        {
+            setOGeomParamSamp(iSample.uvs, oUVSample);
+            oSamp.setUVs(oUVSample);
+        }
+
+        ON3fGeomParam::Sample oNormalsSample;
+        if (iParams.normals)
+        {
+            setOGeomParamSamp(iSample.normals, oNormalsSample);
+            oSamp.setNormals(oNormalsSample);
+        }
+
+        if (iParams.hasTrimCurve)
+        {
+            oSamp.setTrimCurve(iSamp.getTrimNumLoops(),
+                               *(iSamp.getTrimNumCurves()),
+                               *(iSamp.getTrimNumVertices()),
+                               *(iSamp.getTrimOrders()),
+                               *(iSamp.getTrimKnots()),
+                               *(iSamp.getTrimMins()),
+                               *(iSamp.getTrimMaxes()),
+                               *(iSamp.getTrimU()),
+                               *(iSamp.getTrimV()),
+                               *(iSamp.getTrimW()));
+        }
+        oSchema.set(oSamp);
+    }
+};
+
+// the inputs of one geometry schema, for prefetchInputs
+template< class STITCH >
+class SchemaInputs
+{
+public:
+    typedef typename STITCH::ISchema ISchema;
+    typedef typename STITCH::OSchema OSchema;
+    typedef typename STITCH::Params Params;
+    typedef typename STITCH::Sample Sample;
+
+    SchemaInputs(std::vector< IObject > & iObjects, OSchema & iSchema) :
+        m_oSchema(iSchema),
+        m_schemas(iObjects.size()),
+        m_params(iObjects.size()),
+        m_samples(iObjects.size()),
+        m_emptySample(STITCH::emptySample())
+    {
+        std::vector< index_t > numSamples(iObjects.size(), 0);
+        std::vector< TimeSamplingPtr > times(iObjects.size());
+        for (size_t i = 0; i < iObjects.size(); ++i)
+        {
+            if (!iObjects[i].valid())
+            {
+                continue;
+            }
+
+            m_schemas[i] = typename STITCH::IData(iObjects[i],
+                Alembic::Abc::kWrapExisting).getSchema();
+            m_params[i] = Params(m_schemas[i]);
+            numSamples[i] = m_schemas[i].getNumSamples();
+            times[i] = m_schemas[i].getTimeSampling();
+        }
+
+        planInputSamples(numSamples, times, m_oSchema.getTimeSampling(),
+                         m_oSchema.getNumSamples(), false, m_ranges);
+    }
+
+    size_t numSamples(size_t i) const
+    {
+        if (!m_ranges[i].valid)
+        {
+            return 0;
+        }
+        return m_ranges[i].end - m_ranges[i].begin;
+    }
+
+    void reserve(size_t i)
+    {
+        m_samples[i].resize(numSamples(i));
+    }
+
+    size_t read(size_t i, size_t k)
+    {
+        return STITCH::read(m_schemas[i], m_params[i],
+                            m_ranges[i].begin + k, m_samples[i][k]);
+    }
+
+    void begin(size_t i)
+    {
+        if (!m_ranges[i].valid)
+        {
+            return;
+        }
+
+        STITCH::begin(m_params[i], m_oSchema);
+
+        for (index_t j = 0; j < m_ranges[i].numEmpty; ++j)
+        {
+            m_oSchema.set(m_emptySample);
+        }
+    }
+
+    void write(size_t i, size_t k)
+    {
+        STITCH::write(m_params[i], m_samples[i][k], m_oSchema);
+        m_samples[i][k] = Sample();
+
+        if (k + 1 == m_samples[i].size())
+        {
+            std::vector< Sample >().swap(m_samples[i]);
+        }
+    }
+
+private:
+    OSchema & m_oSchema;
+    std::vector< ISchema > m_schemas;
+    std::vector< Params > m_params;
+    std::vector< InputSampleRange > m_ranges;
+    std::vector< std::vector< Sample > > m_samples;
+    typename OSchema::Sample m_emptySample;
+};
+
 template< class IData, class IDataSchema, class OData, class ODataSchema >
 void init(std::vector< IObject > & iObjects, OObject & oParentObj,
           ODataSchema & oSchema, const TimeAndSamplesMap & iTimeMap,
@@ -378,101 +1017,10 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
             iObjects, oParentObj, oSchema, iTimeMap, totalSamples);
         outObj = oSchema.getObject();
 
-        OSubDSchema::Sample emptySample(P3fArraySample::emptySample(),
-            Int32ArraySample::emptySample(), Int32ArraySample::emptySample());
-
-        // stitch the SubDSchema
-        //
-        for (size_t i = 0; i < iObjects.size(); i++)
-        {
-            if (!iObjects[i].valid())
-            {
-                continue;
-            }
-
-            ISubDSchema iSchema =
-                ISubD(iObjects[i], Alembic::Abc::kWrapExisting).getSchema();
-            index_t numSamples = iSchema.getNumSamples();
-            IV2fGeomParam uvs = iSchema.getUVsParam();
-            if (oSchema.getNumSamples() == 0 && uvs)
-            {
-                oSchema.setUVSourceName(GetSourceName(uvs.getMetaData()));
-            }
-            index_t numEmpties = 0;
-            index_t reqIdx = getIndexSample(oSchema.getNumSamples(),
-                oSchema.getTimeSampling(), numSamples,
-                iSchema.getTimeSampling(), numEmpties);
-
-            for (index_t emptyIdx = 0; emptyIdx < numEmpties; ++emptyIdx)
-            {
-                oSchema.set(emptySample);
-            }
-
-            for (; reqIdx < numSamples; reqIdx++)
-            {
-                ISubDSchema::Sample iSamp = iSchema.getValue(reqIdx);
-                OSubDSchema::Sample oSamp;
-
-                Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
-                if (posPtr)
-                    oSamp.setPositions(*posPtr);
-
-                Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
-                if (velocPtr)
-                    oSamp.setVelocities(*velocPtr);
-
-                Abc::Int32ArraySamplePtr faceIndicesPtr = iSamp.getFaceIndices();
-                if (faceIndicesPtr)
-                    oSamp.setFaceIndices(*faceIndicesPtr);
-
-                Abc::Int32ArraySamplePtr faceCntPtr = iSamp.getFaceCounts();
-                if (faceCntPtr)
-                    oSamp.setFaceCounts(*faceCntPtr);
-
-                oSamp.setFaceVaryingInterpolateBoundary(iSamp.getFaceVaryingInterpolateBoundary());
-                oSamp.setFaceVaryingPropagateCorners(iSamp.getFaceVaryingPropagateCorners());
-                oSamp.setInterpolateBoundary(iSamp.getInterpolateBoundary());
-
-                Abc::Int32ArraySamplePtr creaseIndicesPtr = iSamp.getCreaseIndices();
-                if (creaseIndicesPtr)
-                    oSamp.setCreaseIndices(*creaseIndicesPtr);
-
-                Abc::Int32ArraySamplePtr creaseLenPtr = iSamp.getCreaseLengths();
-                if (creaseLenPtr)
-                    oSamp.setCreaseLengths(*creaseLenPtr);
+        OSubDSchema::Sample emptySample = SubDStitch::emptySample();
 
-                Abc::FloatArraySamplePtr creaseSpPtr = iSamp.getCreaseSharpnesses();
-                if (creaseSpPtr)
-                    oSamp.setCreaseSharpnesses(*creaseSpPtr);
-
-                Abc::Int32ArraySamplePtr cornerIndicesPtr = iSamp.getCornerIndices();
-                if (cornerIndicesPtr)
-                    oSamp.setCornerIndices(*cornerIndicesPtr);
-
-                Abc::FloatArraySamplePtr cornerSpPtr = iSamp.getCornerSharpnesses();
-                if (cornerSpPtr)
-                    oSamp.setCornerSharpnesses(*cornerSpPtr);
-
-                Abc::Int32ArraySamplePtr holePtr = iSamp.getHoles();
-                if (holePtr)
-                    oSamp.setHoles(*holePtr);
-
-                oSamp.setSubdivisionScheme(iSamp.getSubdivisionScheme());
-
-                // set uvs
-                IV2fGeomParam::Sample iUVSample;
-                OV2fGeomParam::Sample oUVSample;
-                if (uvs)
-                {
-                    getOGeomParamSamp <IV2fGeomParam, IV2fGeomParam::Sample,
-                        OV2fGeomParam::Sample>(uvs, iUVSample,
-                                               oUVSample, reqIdx);
-                    oSamp.setUVs(oUVSample);
-                }
-
-                oSchema.set(oSamp);
-            }
-        }
+        SchemaInputs< SubDStitch > inputs(iObjects, oSchema);
+        prefetchInputs(inputs, iObjects.size(), iTimeMap);
 
         for (size_t i = oSchema.getNumSamples(); i < totalSamples; ++i)
         {
@@ -487,86 +1035,10 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
             iObjects, oParentObj, oSchema, iTimeMap, totalSamples);
         outObj = oSchema.getObject();
 
-        OPolyMeshSchema::Sample emptySample(P3fArraySample::emptySample(),
-            Int32ArraySample::emptySample(), Int32ArraySample::emptySample());
-
-        // stitch the PolySchema
-        //
-        for (size_t i = 0; i < iObjects.size(); i++)
-        {
-
-            if (!iObjects[i].valid())
-            {
-                continue;
-            }
-
-            IPolyMeshSchema iSchema =
-                IPolyMesh(iObjects[i], Alembic::Abc::kWrapExisting).getSchema();
-            index_t numSamples = iSchema.getNumSamples();
-
-            IN3fGeomParam normals = iSchema.getNormalsParam();
-            IV2fGeomParam uvs = iSchema.getUVsParam();
-            if (oSchema.getNumSamples() == 0 && uvs)
-            {
-                oSchema.setUVSourceName(GetSourceName(uvs.getMetaData()));
-            }
-
-            index_t numEmpties = 0;
-            index_t reqIdx = getIndexSample(oSchema.getNumSamples(),
-                oSchema.getTimeSampling(), numSamples,
-                iSchema.getTimeSampling(), numEmpties);
-
-            for (index_t emptyIdx = 0; emptyIdx < numEmpties; ++emptyIdx)
-            {
-                oSchema.set(emptySample);
-            }
-
-            for (; reqIdx < numSamples; reqIdx++)
-            {
-                IPolyMeshSchema::Sample iSamp = iSchema.getValue(reqIdx);
-                OPolyMeshSchema::Sample oSamp;
-
-                Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
-                if (posPtr)
-                    oSamp.setPositions(*posPtr);
-
-                Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
-                if (velocPtr)
-                    oSamp.setVelocities(*velocPtr);
-
-                Abc::Int32ArraySamplePtr faceIndicesPtr = iSamp.getFaceIndices();
-                if (faceIndicesPtr)
-                    oSamp.setFaceIndices(*faceIndicesPtr);
-
-                Abc::Int32ArraySamplePtr faceCntPtr = iSamp.getFaceCounts();
-                if (faceCntPtr)
-                    oSamp.setFaceCounts(*faceCntPtr);
-
-                // set uvs
-                IV2fGeomParam::Sample iUVSample;
-                OV2fGeomParam::Sample oUVSample;
-                if (uvs)
-                {
-                    getOGeomParamSamp <IV2fGeomParam, IV2fGeomParam::Sample,
-                        OV2fGeomParam::Sample>(uvs, iUVSample,
-                                               oUVSample, reqIdx);
-                    oSamp.setUVs(oUVSample);
-                }
-
-                // set normals
-                IN3fGeomParam::Sample iNormalsSample;
-                ON3fGeomParam::Sample oNormalsSample;
-                if (normals)
-                {
-                    getOGeomParamSamp <IN3fGeomParam, IN3fGeomParam::Sample,
-                        ON3fGeomParam::Sample>(normals, iNormalsSample,
-                                               oNormalsSample, reqIdx);
-                    oSamp.setNormals(oNormalsSample);
-                }
+        OPolyMeshSchema::Sample emptySample = PolyMeshStitch::emptySample();
 
-                oSchema.set(oSamp);
-            }
-        }
+        SchemaInputs< PolyMeshStitch > inputs(iObjects, oSchema);
+        prefetchInputs(inputs, iObjects.size(), iTimeMap);
 
         for (size_t i = oSchema.getNumSamples(); i < totalSamples; ++i)
         {
@@ -625,101 +1097,10 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
         init< ICurves, ICurvesSchema, OCurves, OCurvesSchema >(
             iObjects, oParentObj, oSchema, iTimeMap, totalSamples);
         outObj = oSchema.getObject();
-        OCurvesSchema::Sample emptySample(P3fArraySample::emptySample(),
-            Int32ArraySample::emptySample());
-
-        // stitch the CurvesSchemas
-        //
-        for (size_t i = 0; i < iObjects.size(); i++)
-        {
-            if (!iObjects[i].valid())
-            {
-                continue;
-            }
-            ICurvesSchema iSchema =
-                ICurves(iObjects[i], Alembic::Abc::kWrapExisting).getSchema();
-            IV2fGeomParam iUVs = iSchema.getUVsParam();
-            IN3fGeomParam iNormals = iSchema.getNormalsParam();
-            IFloatGeomParam iWidths = iSchema.getWidthsParam();
-            IFloatArrayProperty iKnots = iSchema.getKnotsProperty();
-            IUcharArrayProperty iOrders = iSchema.getOrdersProperty();
-
-            index_t numSamples = iSchema.getNumSamples();
-
-            index_t numEmpty = 0;
-            index_t reqIdx = getIndexSample(oSchema.getNumSamples(),
-                oSchema.getTimeSampling(), numSamples,
-                iSchema.getTimeSampling(), numEmpty);
-            for (index_t emptyIdx = 0; emptyIdx < numEmpty; ++emptyIdx)
-            {
-                oSchema.set(emptySample);
-            }
+        OCurvesSchema::Sample emptySample = CurvesStitch::emptySample();
 
-            for (; reqIdx < numSamples; reqIdx++)
-            {
-                ICurvesSchema::Sample iSamp = iSchema.getValue(reqIdx);
-
-                OCurvesSchema::Sample oSamp;
-                Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
-                if (posPtr)
-                    oSamp.setPositions(*posPtr);
-
-                Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
-                if (velocPtr)
-                    oSamp.setVelocities(*velocPtr);
-
-                oSamp.setType(iSamp.getType());
-                Abc::Int32ArraySamplePtr curvsNumPtr = iSamp.getCurvesNumVertices();
-                if (curvsNumPtr)
-                    oSamp.setCurvesNumVertices(*curvsNumPtr);
-                oSamp.setWrap(iSamp.getWrap());
-                oSamp.setBasis(iSamp.getBasis());
-
-                Abc::FloatArraySamplePtr knotsPtr = iSamp.getKnots();
-                if (knotsPtr)
-                {
-                    oSamp.setKnots(*knotsPtr);
-                }
-
-                Abc::UcharArraySamplePtr ordersPtr = iSamp.getOrders();
-                if (ordersPtr)
-                {
-                    oSamp.setOrders(*ordersPtr);
-                }
-
-                IFloatGeomParam::Sample iWidthSample;
-                OFloatGeomParam::Sample oWidthSample;
-                if (iWidths)
-                {
-                    getOGeomParamSamp <IFloatGeomParam, IFloatGeomParam::Sample,
-                        OFloatGeomParam::Sample>(iWidths, iWidthSample,
-                                                 oWidthSample, reqIdx);
-                    oSamp.setWidths(oWidthSample);
-                }
-
-                IV2fGeomParam::Sample iUVSample;
-                OV2fGeomParam::Sample oUVSample;
-                if (iUVs)
-                {
-                    getOGeomParamSamp <IV2fGeomParam, IV2fGeomParam::Sample,
-                        OV2fGeomParam::Sample>(iUVs, iUVSample,
-                                               oUVSample, reqIdx);
-                    oSamp.setUVs(oUVSample);
-                }
-
-                IN3fGeomParam::Sample iNormalsSample;
-                ON3fGeomParam::Sample oNormalsSample;
-                if (iNormals)
-                {
-                    getOGeomParamSamp <IN3fGeomParam, IN3fGeomParam::Sample,
-                        ON3fGeomParam::Sample>(iNormals, iNormalsSample,
-                                               oNormalsSample, reqIdx);
-                    oSamp.setNormals(oNormalsSample);
-                }
-
-                oSchema.set(oSamp);
-            }
-        }
+        SchemaInputs< CurvesStitch > inputs(iObjects, oSchema);
+        prefetchInputs(inputs, iObjects.size(), iTimeMap);
 
         for (size_t i = oSchema.getNumSamples(); i < totalSamples; ++i)
         {
@@ -732,58 +1113,10 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
         init< IPoints, IPointsSchema, OPoints, OPointsSchema >(
             iObjects, oParentObj, oSchema, iTimeMap, totalSamples);
         outObj = oSchema.getObject();
-        OPointsSchema::Sample emptySample(P3fArraySample::emptySample(),
-            UInt64ArraySample::emptySample());
+        OPointsSchema::Sample emptySample = PointsStitch::emptySample();
 
-        // stitch the PointsSchemas
-        //
-        for (size_t i = 0; i < iObjects.size(); i++)
-        {
-            if (!iObjects[i].valid())
-            {
-                continue;
-            }
-
-            IPointsSchema iSchema =
-                IPoints(iObjects[i], Alembic::Abc::kWrapExisting).getSchema();
-            IFloatGeomParam iWidths = iSchema.getWidthsParam();
-            index_t numSamples = iSchema.getNumSamples();
-            index_t numEmpty = 0;
-            index_t reqIdx = getIndexSample(oSchema.getNumSamples(),
-                oSchema.getTimeSampling(), numSamples,
-                iSchema.getTimeSampling(), numEmpty);
-            for (index_t emptyIdx = 0; emptyIdx < numEmpty; ++emptyIdx)
-            {
-                oSchema.set(emptySample);
-            }
-
-            for (; reqIdx < numSamples; reqIdx++)
-            {
-                IPointsSchema::Sample iSamp = iSchema.getValue(reqIdx);
-                OPointsSchema::Sample oSamp;
-                Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
-                if (posPtr)
-                    oSamp.setPositions(*posPtr);
-                Abc::UInt64ArraySamplePtr idPtr = iSamp.getIds();
-                if (idPtr)
-                    oSamp.setIds(*idPtr);
-                Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
-                if (velocPtr)
-                    oSamp.setVelocities(*velocPtr);
-
-                IFloatGeomParam::Sample iWidthSample;
-                OFloatGeomParam::Sample oWidthSample;
-                if (iWidths)
-                {
-                    getOGeomParamSamp <IFloatGeomParam, IFloatGeomParam::Sample,
-                        OFloatGeomParam::Sample>(iWidths, iWidthSample,
-                                                 oWidthSample, reqIdx);
-                    oSamp.setWidths(oWidthSample);
-                }
-
-                oSchema.set(oSamp);
-            }
-        }
+        SchemaInputs< PointsStitch > inputs(iObjects, oSchema);
+        prefetchInputs(inputs, iObjects.size(), iTimeMap);
 
         for (size_t i = oSchema.getNumSamples(); i < totalSamples; ++i)
         {
@@ -797,99 +1130,10 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
             iObjects, oParentObj, oSchema, iTimeMap, totalSamples);
         outObj = oSchema.getObject();
 
-        Alembic::Util::int32_t zeroVal = 0;
-        ONuPatchSchema::Sample emptySample(P3fArraySample::emptySample(),
-            zeroVal, zeroVal, zeroVal, zeroVal,
-            FloatArraySample::emptySample(), FloatArraySample::emptySample());
+        ONuPatchSchema::Sample emptySample = NuPatchStitch::emptySample();
 
-        // stitch the NuPatchSchemas
-        //
-        for (size_t i = 0; i < iObjects.size(); i++)
-        {
-            if (!iObjects[i].valid())
-            {
-                continue;
-            }
-
-            INuPatchSchema iSchema =
-                INuPatch(iObjects[i], Alembic::Abc::kWrapExisting).getSchema();
-            index_t numSamples = iSchema.getNumSamples();
-
-            IN3fGeomParam normals = iSchema.getNormalsParam();
-            IV2fGeomParam uvs = iSchema.getUVsParam();
-
-            index_t numEmpty = 0;
-            index_t reqIdx = getIndexSample(oSchema.getNumSamples(),
-                oSchema.getTimeSampling(), numSamples,
-                iSchema.getTimeSampling(), numEmpty);
-            for (index_t emptyIdx = 0; emptyIdx < numEmpty; ++emptyIdx)
-            {
-                oSchema.set(emptySample);
-            }
-
-            for (; reqIdx < numSamples; reqIdx++)
-            {
-                INuPatchSchema::Sample iSamp = iSchema.getValue(reqIdx);
-                ONuPatchSchema::Sample oSamp;
-
-                Abc::P3fArraySamplePtr posPtr = iSamp.getPositions();
-                if (posPtr)
-                    oSamp.setPositions(*posPtr);
-
-                Abc::V3fArraySamplePtr velocPtr = iSamp.getVelocities();
-                if (velocPtr)
-                    oSamp.setVelocities(*velocPtr);
-
-                oSamp.setNu(iSamp.getNumU());
-                oSamp.setNv(iSamp.getNumV());
-                oSamp.setUOrder(iSamp.getUOrder());
-                oSamp.setVOrder(iSamp.getVOrder());
-
-                Abc::FloatArraySamplePtr uKnotsPtr = iSamp.getUKnot();
-                if (uKnotsPtr)
-                    oSamp.setUKnot(*uKnotsPtr);
-
-                Abc::FloatArraySamplePtr vKnotsPtr = iSamp.getVKnot();
-                if (vKnotsPtr)
-                    oSamp.setVKnot(*vKnotsPtr);
-
-                IV2fGeomParam::Sample iUVSample;
-                OV2fGeomParam::Sample oUVSample;
-                if (uvs)
-                {
-                    getOGeomParamSamp <IV2fGeomParam, IV2fGeomParam::Sample,
-                        OV2fGeomParam::Sample>(uvs, iUVSample,
-                                               oUVSample, reqIdx);
-                    oSamp.setUVs(oUVSample);
-                }
-
-                IN3fGeomParam::Sample iNormalsSample;
-                ON3fGeomParam::Sample oNormalsSample;
-                if (normals)
-                {
-                    getOGeomParamSamp <IN3fGeomParam, IN3fGeomParam::Sample,
-                        ON3fGeomParam::Sample>(normals, iNormalsSample,
-                                               oNormalsSample, reqIdx);
-                    oSamp.setNormals(oNormalsSample);
-                }
-
-
-                if (iSchema.hasTrimCurve())
-                {
-                    oSamp.setTrimCurve(iSamp.getTrimNumLoops(),
-                                       *(iSamp.getTrimNumCurves()),
-                                       *(iSamp.getTrimNumVertices()),
-                                       *(iSamp.getTrimOrders()),
-                                       *(iSamp.getTrimKnots()),
-                                       *(iSamp.getTrimMins()),
-                                       *(iSamp.getTrimMaxes()),
-                                       *(iSamp.getTrimU()),
-                                       *(iSamp.getTrimV()),
-                                       *(iSamp.getTrimW()));
-                }
-                oSchema.set(oSamp);
-            }
-        }
+        SchemaInputs< NuPatchStitch > inputs(iObjects, oSchema);
+        prefetchInputs(inputs, iObjects.size(), iTimeMap);
 
         for (size_t i = oSchema.getNumSamples(); i < totalSamples; ++i)
         {
@@ -961,30 +1205,51 @@ void visitObjects(std::vector< IObject > & iObjects, OObject & oParentObj,
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
-    if (argc < 4)
+    // look for the optional flags before the output file
+    TimeAndSamplesMap timeMap;
+    int inStart = 1;
+    bool badArgs = false;
+    for (; inStart < argc && argv[inStart][0] == '-'; ++inStart)
+    {
+        std::string arg = argv[inStart];
+        if (arg == "-v")
+        {
+            timeMap.setVerbose(true);
+        }
+        else if (arg == "-j" && inStart + 1 < argc)
+        {
+            timeMap.setNumThreads(atoi(argv[++inStart]));
+        }
+        else if (arg == "-m" && inStart + 1 < argc)
+        {
+            timeMap.setMaxPrefetchBytes(
+                (size_t) std::max(1, atoi(argv[++inStart])) * 1024 * 1024);
+        }
+        else
+        {
+            badArgs = true;
+            break;
+        }
+    }
+
+    if (badArgs || argc - inStart < 3)
     {
-        std::cerr << "USAGE: " << argv[0] << " [-v] outFile.abc inFile1.abc"
+        std::cerr << "USAGE: " << argv[0] << " [-v] [-j numThreads]"
+            << " [-m prefetchMB] outFile.abc inFile1.abc"
             << " inFile2.abc (inFile3.abc ...)" << std::endl;
         std::cerr << "Where -v is a verbosity flag which prints the IObject"
             << " being processed." << std::endl;
+        std::cerr << "-j is how many threads read the input files at once,"
+            << " the default is one per core." << std::endl;
+        std::cerr << "-m is roughly how many megabytes of input samples can be"
+            << " read ahead of the writer, the default is 256." << std::endl;
         return -1;
     }
 
     {
-        size_t numInputs = argc - 2;
-
-        std::string fileName = argv[1];
-
-        // look for optional verbose
-        int inStart = 2;
-        TimeAndSamplesMap timeMap;
-        if (fileName == "-v")
-        {
-            timeMap.setVerbose(true);
-            fileName = argv[2];
-            inStart ++;
-            numInputs --;
-        }
+        std::string fileName = argv[inStart];
+        inStart ++;
+        size_t numInputs = argc - inStart;
 
         std::vector< chrono_t > minVec;
         minVec.reserve(numInputs);
@@ -994,10 +1259,18 @@ int main( int argc, char *argv[] )
 
         std::map< chrono_t, size_t > minIndexMap;
 
+        size_t numStreams = timeMap.getNumThreads();
+        if (numStreams == 0)
+        {
+            numStreams = Alembic::Util::thread::hardware_concurrency();
+        }
+
         Alembic::AbcCoreFactory::IFactory factory;
         factory.setPolicy(ErrorHandler::kThrowPolicy);
+        factory.setOgawaNumStreams(std::max< size_t >(1, numStreams));
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
 
+        bool allOgawa = true;
         for (int i = inStart; i < argc; ++i)
         {
             IArchive archive = factory.getArchive(argv[i], coreType);
@@ -1040,9 +1313,19 @@ int main( int argc, char *argv[] )
                 }
             }
 
+            // the HDF5 library isn't built to be read from several threads
+            if (coreType != Alembic::AbcCoreFactory::IFactory::kOgawa)
+            {
+                timeMap.setNumThreads(1);
+                allOgawa = false;
+            }
+
             iArchives.push_back(archive);
         }
 
+        // Ogawa to Ogawa can copy array samples without decoding them
+        timeMap.setCopyStored(allOgawa);
+
         // now reorder the input nodes so they are in increasing order of their
         // min values in the frame range
         std::sort(minVec.begin(), minVec.end());
@@ -135,6 +135,42 @@ index_t getIndexSample(index_t iCurOutIndex, TimeSamplingPtr iOutTime,
     return iInNumSamples;
 }
 
+void planInputSamples(const std::vector< index_t > & iNumSamples,
+                      const std::vector< TimeSamplingPtr > & iInTimes,
+                      TimeSamplingPtr iOutTime,
+                      index_t iCurOutIndex,
+                      bool iEmptiesNeedSample,
+                      std::vector< InputSampleRange > & oRanges)
+{
+    oRanges.assign(iNumSamples.size(), InputSampleRange());
+
+    index_t curOutIndex = iCurOutIndex;
+    for (size_t i = 0; i < iNumSamples.size(); ++i)
+    {
+        if (!iInTimes[i])
+        {
+            continue;
+        }
+
+        InputSampleRange & range = oRanges[i];
+        range.valid = true;
+        range.end = iNumSamples[i];
+        range.begin = getIndexSample(curOutIndex, iOutTime, range.end,
+            iInTimes[i], range.numEmpty);
+
+        if (iEmptiesNeedSample && range.begin >= range.end)
+        {
+            range.numEmpty = 0;
+        }
+
+        curOutIndex += range.numEmpty;
+        if (range.begin < range.end)
+        {
+            curOutIndex += range.end - range.begin;
+        }
+    }
+}
+
 void checkAcyclic(const TimeSamplingType & tsType,
                   const std::string & fullNodeName)
 {
@@ -147,64 +183,142 @@ void checkAcyclic(const TimeSamplingType & tsType,
 }
 
 
-void stitchArrayProp(const PropertyHeader & propHeader,
-                     const ICompoundPropertyVec & iCompoundProps,
-                     OCompoundProperty & oCompoundProp,
-                     const TimeAndSamplesMap & iTimeMap)
+namespace
 {
 
-    size_t totalSamples = 0;
-    TimeSamplingPtr timePtr =
-        iTimeMap.get(propHeader.getTimeSampling(), totalSamples);
+// the inputs of stitchArrayProp, for prefetchInputs
+class ArrayPropInputs
+{
+public:
+    ArrayPropInputs(const std::string & iName, const DataType & iDataType,
+                    const ICompoundPropertyVec & iCompoundProps,
+                    OArrayProperty & iWriter, bool iCopyStored) :
+        m_writer(iWriter),
+        m_copyStored(iCopyStored),
+        m_readers(iCompoundProps.size()),
+        m_samples(iCompoundProps.size()),
+        m_emptySample(NULL, iDataType, Dimensions(0))
+    {
+        std::vector< index_t > numSamples(iCompoundProps.size(), 0);
+        std::vector< TimeSamplingPtr > times(iCompoundProps.size());
+        for (size_t i = 0; i < iCompoundProps.size(); ++i)
+        {
+            if (!iCompoundProps[i].valid())
+            {
+                continue;
+            }
 
-    const DataType & dataType = propHeader.getDataType();
-    const MetaData & metaData = propHeader.getMetaData();
-    const std::string & propName = propHeader.getName();
+            const PropertyHeader * childHeader =
+                iCompoundProps[i].getPropertyHeader(iName);
 
-    Dimensions emptyDims(0);
-    ArraySample emptySample(NULL, dataType, emptyDims);
+            if (!childHeader || iDataType != childHeader->getDataType())
+            {
+                continue;
+            }
 
-    OArrayProperty writer(oCompoundProp, propName, dataType, metaData, timePtr);
+            m_readers[i] = IArrayProperty(iCompoundProps[i], iName);
+            numSamples[i] = m_readers[i].getNumSamples();
+            times[i] = m_readers[i].getTimeSampling();
+        }
 
-    size_t numInputs = iCompoundProps.size();
-    for (size_t iCpIndex = 0; iCpIndex < numInputs; iCpIndex++)
-    {
+        planInputSamples(numSamples, times, m_writer.getTimeSampling(),
+                         m_writer.getNumSamples(), false, m_ranges);
+    }
 
-        if (!iCompoundProps[iCpIndex].valid())
+    size_t numSamples(size_t i) const
+    {
+        // stored samples are copied straight across by begin
+        if (m_copyStored || !m_ranges[i].valid)
         {
-            continue;
+            return 0;
         }
+        return m_ranges[i].end - m_ranges[i].begin;
+    }
 
-        const PropertyHeader * childHeader =
-            iCompoundProps[iCpIndex].getPropertyHeader(propName);
+    void reserve(size_t i)
+    {
+        m_samples[i].resize(numSamples(i));
+    }
 
-        if (!childHeader || dataType != childHeader->getDataType())
+    size_t read(size_t i, size_t k)
+    {
+        ArraySamplePtr & dataPtr = m_samples[i][k];
+        m_readers[i].get(dataPtr, m_ranges[i].begin + k);
+        return dataPtr->getDimensions().numPoints() *
+            dataPtr->getDataType().getNumBytes();
+    }
+
+    void begin(size_t i)
+    {
+        if (!m_ranges[i].valid)
         {
-            continue;
+            return;
         }
 
-        IArrayProperty reader(iCompoundProps[iCpIndex], propName);
-        index_t numSamples = reader.getNumSamples();
-
-        ArraySamplePtr dataPtr;
-        index_t numEmpty;
-        index_t k = getIndexSample(writer.getNumSamples(),
-            writer.getTimeSampling(), numSamples,
-            reader.getTimeSampling(), numEmpty);
-
+        for (index_t j = 0; j < m_ranges[i].numEmpty; ++j)
+        {
+            m_writer.set(m_emptySample);
+        }
 
-        for (index_t j = 0; j < numEmpty; ++j)
+        if (m_copyStored)
         {
-                writer.set(emptySample);
+            for (index_t k = m_ranges[i].begin; k < m_ranges[i].end; ++k)
+            {
+                if (!m_writer.copySample(m_readers[i], k))
+                {
+                    ArraySamplePtr dataPtr;
+                    m_readers[i].get(dataPtr, k);
+                    m_writer.set(*dataPtr);
+                }
+            }
         }
+    }
 
-        for (; k < numSamples; k++)
+    void write(size_t i, size_t k)
+    {
+        m_writer.set(*m_samples[i][k]);
+        m_samples[i][k].reset();
+
+        if (k + 1 == m_samples[i].size())
         {
-            reader.get(dataPtr, k);
-            writer.set(*dataPtr);
+            std::vector< ArraySamplePtr >().swap(m_samples[i]);
         }
     }
 
+private:
+    OArrayProperty & m_writer;
+    bool m_copyStored;
+    std::vector< IArrayProperty > m_readers;
+    std::vector< InputSampleRange > m_ranges;
+    std::vector< std::vector< ArraySamplePtr > > m_samples;
+    ArraySample m_emptySample;
+};
+
+}
+
+void stitchArrayProp(const PropertyHeader & propHeader,
+                     const ICompoundPropertyVec & iCompoundProps,
+                     OCompoundProperty & oCompoundProp,
+                     const TimeAndSamplesMap & iTimeMap)
+{
+
+    size_t totalSamples = 0;
+    TimeSamplingPtr timePtr =
+        iTimeMap.get(propHeader.getTimeSampling(), totalSamples);
+
+    const DataType & dataType = propHeader.getDataType();
+    const MetaData & metaData = propHeader.getMetaData();
+    const std::string & propName = propHeader.getName();
+
+    Dimensions emptyDims(0);
+    ArraySample emptySample(NULL, dataType, emptyDims);
+
+    OArrayProperty writer(oCompoundProp, propName, dataType, metaData, timePtr);
+
+    ArrayPropInputs inputs(propName, dataType, iCompoundProps, writer,
+                           iTimeMap.isCopyStored());
+    prefetchInputs(inputs, iCompoundProps.size(), iTimeMap);
+
     // fill in any other empties
     for (size_t i = writer.getNumSamples(); i < totalSamples; ++i)
     {
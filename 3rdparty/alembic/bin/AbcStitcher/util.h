@@ -37,17 +37,25 @@
 #ifndef ABC_STITCHER_UTIL_H
 #define ABC_STITCHER_UTIL_H
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <Alembic/Abc/ICompoundProperty.h>
 #include <Alembic/Abc/OCompoundProperty.h>
+#include <Alembic/Util/Thread.h>
 
 typedef std::vector< Alembic::Abc::ICompoundProperty > ICompoundPropertyVec;
 
 class TimeAndSamplesMap
 {
 public:
-    TimeAndSamplesMap() {m_isVerbose = false;};
+    TimeAndSamplesMap()
+    {
+        m_isVerbose = false;
+        m_copyStored = false;
+        m_numThreads = 0;
+        m_maxPrefetchBytes = 256 * 1024 * 1024;
+    };
 
     void add(Alembic::AbcCoreAbstract::TimeSamplingPtr iTime,
              std::size_t iNumSamples);
@@ -59,10 +67,39 @@ public:
     void setVerbose(bool isVerbose){m_isVerbose = isVerbose;};
     bool isVerbose() const {return m_isVerbose;};
 
+    // copy array samples as stored instead of decoding them, only valid
+    // when every input and the output are Ogawa
+    void setCopyStored(bool iCopyStored){m_copyStored = iCopyStored;};
+    bool isCopyStored() const {return m_copyStored;};
+
+    // threads used to read the inputs, 0 means one per core
+    void setNumThreads(std::size_t iNumThreads){m_numThreads = iNumThreads;};
+    std::size_t getNumThreads() const {return m_numThreads;};
+
+    // roughly how many bytes of input samples may be held in memory
+    // between being read and being written
+    void setMaxPrefetchBytes(std::size_t iBytes){m_maxPrefetchBytes = iBytes;};
+    std::size_t getMaxPrefetchBytes() const {return m_maxPrefetchBytes;};
+
 private:
     std::vector< Alembic::AbcCoreAbstract::TimeSamplingPtr > mTimeSampling;
     std::vector< std::size_t > mExpectedSamples;
     bool m_isVerbose;
+    bool m_copyStored;
+    std::size_t m_numThreads;
+    std::size_t m_maxPrefetchBytes;
+};
+
+// which samples of one input get written, and how many empty samples
+// need to be written before them to fill a gap in the frame range
+struct InputSampleRange
+{
+    InputSampleRange() : valid(false), numEmpty(0), begin(0), end(0) {};
+
+    bool valid;
+    Alembic::AbcCoreAbstract::index_t numEmpty;
+    Alembic::AbcCoreAbstract::index_t begin;
+    Alembic::AbcCoreAbstract::index_t end;
 };
 
 Alembic::AbcCoreAbstract::index_t
@@ -72,6 +109,160 @@ getIndexSample(Alembic::AbcCoreAbstract::index_t iCurOutIndex,
     Alembic::AbcCoreAbstract::TimeSamplingPtr iInTime,
     Alembic::AbcCoreAbstract::index_t & oNumEmpty);
 
+// Works out the InputSampleRange of every input up front, the same way
+// getIndexSample would while writing them one after another starting at
+// output sample iCurOutIndex.  Inputs with a NULL time sampling are skipped.
+// If iEmptiesNeedSample is true, empties are only written for inputs that
+// also write at least one sample.
+void planInputSamples(
+    const std::vector< Alembic::AbcCoreAbstract::index_t > & iNumSamples,
+    const std::vector< Alembic::AbcCoreAbstract::TimeSamplingPtr > & iInTimes,
+    Alembic::AbcCoreAbstract::TimeSamplingPtr iOutTime,
+    Alembic::AbcCoreAbstract::index_t iCurOutIndex,
+    bool iEmptiesNeedSample,
+    std::vector< InputSampleRange > & oRanges);
+
+// one sample of one input for prefetchInputs, inputs which only write
+// empty samples get a single unit without a sample
+struct PrefetchUnit
+{
+    PrefetchUnit(std::size_t iInput, std::size_t iSample, bool iHasSample) :
+        input(iInput), sample(iSample), hasSample(iHasSample) {};
+
+    std::size_t input;
+    std::size_t sample;
+    bool hasSample;
+};
+
+template < class INPUTS >
+class PrefetchReadRange
+{
+public:
+    PrefetchReadRange(INPUTS & iInputs,
+                      const std::vector< PrefetchUnit > & iUnits,
+                      std::vector< std::size_t > & oBytes) :
+        m_inputs(iInputs), m_units(iUnits), m_bytes(oBytes) {};
+
+    void operator()(std::size_t iBegin, std::size_t iEnd)
+    {
+        for (std::size_t i = iBegin; i < iEnd; ++i)
+        {
+            if (m_units[i].hasSample)
+            {
+                m_bytes[i] = m_inputs.read(m_units[i].input,
+                                           m_units[i].sample);
+            }
+        }
+    }
+
+private:
+    INPUTS & m_inputs;
+    const std::vector< PrefetchUnit > & m_units;
+    std::vector< std::size_t > & m_bytes;
+};
+
+// Reads the samples of the inputs a window at a time, spread over the
+// threads of iTimeMap, and then writes that window in input order.
+// The window holds whole samples rather than whole inputs, so a long input
+// is read in several passes.  It is resized after every pass from the
+// average sample size so far so that about getMaxPrefetchBytes() are held
+// at once, but never drops below one sample.
+//
+// INPUTS must have:
+//   numSamples(i), how many samples input i writes, asked once per input
+//   reserve(i), called before anything of input i is read
+//   read(i, k), reads sample k of input i and returns how many bytes it is
+//       holding onto, called concurrently for different samples
+//   begin(i), writes whatever goes before the samples of input i
+//   write(i, k), writes sample k of input i and lets go of it
+// Everything but read is only ever called from this thread, in order.
+template < class INPUTS >
+void prefetchInputs(INPUTS & iInputs, std::size_t iNumInputs,
+                    const TimeAndSamplesMap & iTimeMap)
+{
+    std::size_t numThreads = iTimeMap.getNumThreads();
+    if (numThreads == 0)
+    {
+        numThreads = Alembic::Util::thread::hardware_concurrency();
+    }
+
+    // don't bother threads with less than this much reading each
+    const std::size_t minThreadBytes = 256 * 1024;
+
+    std::size_t maxBytes = iTimeMap.getMaxPrefetchBytes();
+    std::size_t totalBytes = 0;
+    std::size_t totalSamples = 0;
+
+    // start with a single sample to get an idea of how big they are
+    std::size_t window = 1;
+    std::size_t grain = 1;
+
+    std::size_t input = 0;
+    std::size_t sample = 0;
+    std::size_t inputSamples = iNumInputs > 0 ? iInputs.numSamples(0) : 0;
+
+    std::vector< PrefetchUnit > units;
+    std::vector< std::size_t > bytes;
+    while (input < iNumInputs)
+    {
+        units.clear();
+        std::size_t windowSamples = 0;
+        while (input < iNumInputs && windowSamples < window)
+        {
+            if (sample == 0)
+            {
+                iInputs.reserve(input);
+            }
+
+            if (inputSamples == 0)
+            {
+                units.push_back(PrefetchUnit(input, 0, false));
+            }
+            else
+            {
+                units.push_back(PrefetchUnit(input, sample, true));
+                ++windowSamples;
+                ++sample;
+            }
+
+            if (sample >= inputSamples)
+            {
+                ++input;
+                sample = 0;
+                inputSamples = input < iNumInputs ?
+                    iInputs.numSamples(input) : 0;
+            }
+        }
+
+        bytes.assign(units.size(), 0);
+        PrefetchReadRange< INPUTS > range(iInputs, units, bytes);
+        Alembic::Util::parallel_for(units.size(), grain, range, numThreads);
+
+        for (std::size_t i = 0; i < units.size(); ++i)
+        {
+            if (units[i].sample == 0)
+            {
+                iInputs.begin(units[i].input);
+            }
+
+            if (units[i].hasSample)
+            {
+                iInputs.write(units[i].input, units[i].sample);
+                totalBytes += bytes[i];
+                ++totalSamples;
+            }
+        }
+
+        if (totalSamples > 0)
+        {
+            std::size_t avgBytes = std::max< std::size_t >(1,
+                totalBytes / totalSamples);
+            window = std::max< std::size_t >(1, maxBytes / avgBytes);
+            grain = std::max< std::size_t >(1, minThreadBytes / avgBytes);
+        }
+    }
+}
+
 void checkAcyclic(const Alembic::AbcCoreAbstract::TimeSamplingType & tsType,
                   const std::string & fullNodeName);
 
@@ -0,0 +1,228 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+// abcverify checks archives for corrupt samples.
+//
+// Every array sample is stored with a digest of its data, abcverify reads
+// each stored sample once, hashes it again and compares the two (see
+// Alembic::Abc::VerifyArchive).  Ogawa archives are memory mapped and read
+// on several threads, so on a warm or fast disk the run is bound by the
+// hashing.
+//
+// The objects, properties and samples that refer to corrupt data are
+// listed, and the exit status is 1 if any were found or an archive could
+// not be read at all.
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+using namespace Alembic;
+namespace AbcF = ::Alembic::AbcCoreFactory;
+
+namespace
+{
+
+//-*****************************************************************************
+double getTimeSec()
+{
+#ifdef _MSC_VER
+    LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+    timeval t;
+    gettimeofday(&t, 0);
+    return (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
+#endif
+}
+
+//-*****************************************************************************
+// returns false if the archive is corrupt or couldn't be read
+bool verifyFile(const std::string & iFileName, std::size_t iNumThreads,
+                bool iMemoryMapped, bool iQuiet)
+{
+    double start = getTimeSec();
+
+    Abc::VerifyStats stats;
+    std::string coreName;
+    try
+    {
+        AbcF::IFactory factory;
+        factory.setOgawaNumStreams(iNumThreads);
+        factory.setOgawaReadStrategy(iMemoryMapped ?
+            AbcF::IFactory::kMemoryMappedFiles :
+            AbcF::IFactory::kFileStreams);
+
+        AbcF::IFactory::CoreType coreType;
+        Abc::IArchive archive = factory.getArchive(iFileName, coreType);
+        if (!archive.valid())
+        {
+            std::cerr << iFileName << ": ERROR: not an Alembic archive"
+                      << std::endl;
+            return false;
+        }
+
+        // HDF5 reads all go through one global lock
+        std::size_t numThreads = iNumThreads;
+        if (coreType == AbcF::IFactory::kHDF5)
+        {
+            numThreads = 1;
+        }
+
+        Abc::VerifyArchive(archive, stats, numThreads);
+    }
+    catch (std::exception & e)
+    {
+        std::cerr << iFileName << ": ERROR: " << e.what() << std::endl;
+        return false;
+    }
+
+    double seconds = getTimeSec() - start;
+    double mb = (double) stats.numBytes / (1024.0 * 1024.0);
+
+    for (std::vector< Abc::VerifyError >::const_iterator it =
+         stats.errors.begin(); it != stats.errors.end(); ++it)
+    {
+        std::cout << iFileName << ": " << it->objectPath << " "
+                  << it->propertyPath << " sample " << it->sampleIndex
+                  << ": " << it->message << std::endl;
+    }
+
+    if (!iQuiet || !stats.errors.empty())
+    {
+        std::cout << iFileName << ": "
+                  << (stats.errors.empty() ? "OK" : "CORRUPT") << ", "
+                  << stats.numArrayProperties << " array properties, "
+                  << stats.numSamples << " samples, "
+                  << stats.numBlocks << " stored, "
+                  << std::fixed << std::setprecision(1) << mb << " MB in "
+                  << std::setprecision(3) << seconds << " s";
+
+        if (seconds > 0.0)
+        {
+            std::cout << " (" << std::setprecision(1) << mb / seconds
+                      << " MB/s)";
+        }
+
+        std::cout << std::endl;
+    }
+
+    return stats.errors.empty();
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+int main(int argc, char *argv[])
+{
+    std::string desc("abcverify [-threads N] [-nommap] [-q] FILE...\n"
+    "Rehashes every stored array sample and compares it with the digest\n"
+    "that was written with it, listing the objects, properties and samples\n"
+    "whose data is corrupt.  Exits with 1 if any archive is corrupt or\n"
+    "can't be read.\n"
+    "  -threads N  how many threads to read with, default is one per core\n"
+    "  -nommap     read Ogawa archives with file streams instead of\n"
+    "              memory mapping them\n"
+    "  -q          only print archives that have errors\n"
+    "  -h, --help  prints this help message\n");
+
+    std::size_t numThreads = 0;
+    bool memoryMapped = true;
+    bool quiet = false;
+    std::vector< std::string > fileNames;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "-threads" && i + 1 < argc)
+        {
+            numThreads = (std::size_t) std::max(0, atoi(argv[++i]));
+        }
+        else if (arg == "-nommap")
+        {
+            memoryMapped = false;
+        }
+        else if (arg == "-q")
+        {
+            quiet = true;
+        }
+        else if (arg.substr(0, 1) == "-")
+        {
+            std::cout << desc << std::endl;
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+        else
+        {
+            fileNames.push_back(arg);
+        }
+    }
+
+    if (fileNames.empty())
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = Util::thread::hardware_concurrency();
+    }
+
+    bool ok = true;
+    for (std::size_t i = 0; i < fileNames.size(); ++i)
+    {
+        if (!verifyFile(fileNames[i], numThreads, memoryMapped, quiet))
+        {
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
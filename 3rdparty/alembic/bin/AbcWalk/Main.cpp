@@ -34,295 +34,768 @@
 //
 //-*****************************************************************************
 
-#include <stdio.h>
-#include <pthread.h>
-#include <sys/time.h>
+// abcwalk measures how fast archives can be read.
+//
+// Every run opens the archives, collects their properties and then reads
+// samples with one access pattern, on some number of threads, pulling units
+// of work from a shared queue:
+//
+//   walk    the whole archive, a unit is every sample of one property
+//   play    frames in order, a unit is one frame (sample f of every property
+//           that has more than f samples)
+//   random  the same frames, picked at random
+//   prop    a single property, a unit is one of its samples
+//
+// The runs sweep thread counts, Ogawa stream counts and the Ogawa read
+// backend (memory mapped or plain file reads), and the results are printed
+// as JSON with the throughput and a latency histogram of the units.
+//
+// Only the library's caches start cold in each run, the operating system
+// will usually have the file cached after the first one.
+
 #include <Alembic/Abc/All.h>
 #include <Alembic/AbcCoreFactory/All.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+using namespace Alembic;
+namespace AbcA = ::Alembic::AbcCoreAbstract;
+namespace AbcF = ::Alembic::AbcCoreFactory;
+
+namespace
+{
+
+//-*****************************************************************************
 double getTimeSec()
 {
+#ifdef _MSC_VER
+    LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
     timeval t;
     gettimeofday(&t, 0);
     return (double) t.tv_sec + (double) t.tv_usec / 1000000.0;
+#endif
 }
 
-using namespace Alembic;
+//-*****************************************************************************
+// small and reproducible, so that random runs read the same frames
+class Random
+{
+public:
+    Random(Util::uint64_t iSeed) : m_state(iSeed ? iSeed : 1) {}
+
+    std::size_t operator()(std::size_t iRange)
+    {
+        // xorshift64*
+        m_state ^= m_state >> 12;
+        m_state ^= m_state << 25;
+        m_state ^= m_state >> 27;
+        return (std::size_t) ((m_state * 2685821657736338717ULL) >> 11) %
+            iRange;
+    }
+
+private:
+    Util::uint64_t m_state;
+};
 
-struct ArchiveAndData
+//-*****************************************************************************
+struct Property
 {
-    Abc::IArchive archive;
-    std::vector< Abc::IArrayProperty > arrays;
-    std::vector< Abc::IScalarProperty > scalars;
-    std::size_t maxNumSamples;
+    std::string path;
+    Abc::IScalarProperty scalar;
+    Abc::IArrayProperty array;
+    std::size_t numSamples;
 };
 
-class ArchiveWalker;
+//-*****************************************************************************
+// reads one sample and returns how many bytes it held
+std::size_t readSample(Property & iProp, std::size_t iIndex)
+{
+    if (iProp.array.valid())
+    {
+        AbcA::ArraySamplePtr samp;
+        iProp.array.get(samp, Abc::ISampleSelector((AbcA::index_t) iIndex));
+        return samp->size() * iProp.array.getDataType().getNumBytes();
+    }
+
+    const AbcA::DataType & dataType = iProp.scalar.getDataType();
+    if (dataType.getPod() == Util::kStringPOD)
+    {
+        std::vector< std::string > buffer(dataType.getExtent());
+        iProp.scalar.get(&buffer.front(), Abc::ISampleSelector(
+            (AbcA::index_t) iIndex));
+
+        std::size_t bytes = 0;
+        for (std::size_t i = 0; i < buffer.size(); ++i)
+        {
+            bytes += buffer[i].size();
+        }
+        return bytes;
+    }
+    else if (dataType.getPod() == Util::kWstringPOD)
+    {
+        std::vector< Util::wstring > buffer(dataType.getExtent());
+        iProp.scalar.get(&buffer.front(), Abc::ISampleSelector(
+            (AbcA::index_t) iIndex));
 
-// used two different ways, one when traverse the archives
-// (int archive is ignored), and one where we read samples
-struct WorkUnit
+        std::size_t bytes = 0;
+        for (std::size_t i = 0; i < buffer.size(); ++i)
+        {
+            bytes += buffer[i].size() * sizeof(wchar_t);
+        }
+        return bytes;
+    }
+
+    // the biggest extent is 255 of the biggest pod
+    char buffer[4096];
+    iProp.scalar.get(buffer, Abc::ISampleSelector((AbcA::index_t) iIndex));
+    return dataType.getNumBytes();
+}
+
+//-*****************************************************************************
+void findProps(Abc::ICompoundProperty & iParent, const std::string & iPath,
+               std::vector< Property > & oProps)
 {
-    int start;
-    int end;
-    int archive;
-    ArchiveWalker * walker;
-};
+    std::size_t numProps = iParent.getNumProperties();
+    for (std::size_t i = 0; i < numProps; ++i)
+    {
+        const AbcA::PropertyHeader & header = iParent.getPropertyHeader(i);
+        if (header.isCompound())
+        {
+            Abc::ICompoundProperty prop(iParent, header.getName());
+            findProps(prop, iPath + "/" + header.getName(), oProps);
+            continue;
+        }
+
+        Property prop;
+        if (header.isScalar())
+        {
+            prop.scalar = Abc::IScalarProperty(iParent, header.getName());
+            prop.numSamples = prop.scalar.getNumSamples();
+        }
+        else
+        {
+            prop.array = Abc::IArrayProperty(iParent, header.getName());
+            prop.numSamples = prop.array.getNumSamples();
+        }
 
-class ArchiveWalker
+        if (prop.numSamples > 0)
+        {
+            prop.path = iPath + "/" + header.getName();
+            oProps.push_back(prop);
+        }
+    }
+}
+
+//-*****************************************************************************
+void walkObjects(Abc::IObject & iParent, std::vector< Property > & oProps)
 {
+    Abc::ICompoundProperty props = iParent.getProperties();
+    std::string path = iParent.getFullName();
+    findProps(props, path == "/" ? "" : path, oProps);
 
-public:
+    std::size_t numChildren = iParent.getNumChildren();
+    for (std::size_t i = 0; i < numChildren; i++)
+    {
+        Abc::IObject child(iParent, iParent.getChildHeader(i).getName());
+        walkObjects(child, oProps);
+    }
+}
 
-std::vector< ArchiveAndData > mArchives;
+//-*****************************************************************************
+enum Mode
+{
+    kWalk,
+    kPlay,
+    kRandom,
+    kProp
+};
 
-void addArchive(Abc::IArchive iArchive)
+const char * modeName(Mode iMode)
 {
-    ArchiveAndData data;
-    data.archive = iArchive;
-    data.maxNumSamples = 0;
-    mArchives.push_back(data);
+    switch (iMode)
+    {
+        case kWalk: return "walk";
+        case kPlay: return "play";
+        case kRandom: return "random";
+        case kProp: return "prop";
+    }
+    return "";
 }
 
-void readProps(WorkUnit & data)
+//-*****************************************************************************
+struct Settings
 {
-    size_t numArchives = mArchives.size();
+    Settings() : numRandom(0), seed(1), repeat(1) {}
+
+    std::vector< std::string > files;
+    std::vector< Mode > modes;
+    std::vector< std::size_t > threads;
+    std::vector< std::size_t > streams;
+    std::vector< AbcF::IFactory::OgawaReadStrategy > backends;
+    std::string propName;
+    std::size_t numRandom;
+    Util::uint64_t seed;
+    std::size_t repeat;
+};
 
-    printf("readProps Work Unit Start %d %d\n",  data.start, data.end);
+//-*****************************************************************************
+struct Run
+{
+    AbcF::IFactory::OgawaReadStrategy backend;
+    std::size_t streams;
+    std::size_t threads;
+    Mode mode;
+    std::size_t repeat;
+};
 
-    double startTime = getTimeSec();
-    for (size_t a = 0; a < numArchives; ++a)
+//-*****************************************************************************
+// the archives and properties of one run
+struct Scene
+{
+    std::vector< Abc::IArchive > archives;
+    std::vector< Property > props;
+    std::size_t maxNumSamples;
+    AbcF::IFactory::CoreType coreType;
+};
+
+void openScene(const Settings & iSettings,
+               AbcF::IFactory::OgawaReadStrategy iBackend,
+               std::size_t iNumStreams, Scene & oScene)
+{
+    AbcF::IFactory factory;
+    factory.setOgawaReadStrategy(iBackend);
+    factory.setOgawaNumStreams(iNumStreams);
+
+    oScene.coreType = AbcF::IFactory::kUnknown;
+    for (std::size_t i = 0; i < iSettings.files.size(); ++i)
     {
-        std::size_t numScalars = mArchives[a].scalars.size();
-        std::size_t numArrays = mArchives[a].arrays.size();
-        for (std::size_t i = 0; i < numScalars; ++i)
+        AbcF::IFactory::CoreType coreType;
+        Abc::IArchive archive = factory.getArchive(iSettings.files[i],
+                                                   coreType);
+        if (!archive.valid())
+        {
+            ABC_THROW("Couldn't open " << iSettings.files[i]);
+        }
+
+        if (i == 0 || coreType != AbcF::IFactory::kOgawa)
         {
-            Abc::IScalarProperty & prop = mArchives[a].scalars[i];
-            int propEnd = std::min(data.end, (int) prop.getNumSamples());
-            if (prop.isConstant())
+            oScene.coreType = coreType;
+        }
+
+        oScene.archives.push_back(archive);
+        Abc::IObject top = archive.getTop();
+        walkObjects(top, oScene.props);
+    }
+
+    oScene.maxNumSamples = 0;
+    for (std::size_t i = 0; i < oScene.props.size(); ++i)
+    {
+        oScene.maxNumSamples = std::max(oScene.maxNumSamples,
+                                        oScene.props[i].numSamples);
+    }
+}
+
+// the property the prop mode reads, the named one or the array property
+// with the most samples
+std::size_t scanProperty(const Scene & iScene, const std::string & iName)
+{
+    std::size_t found = iScene.props.size();
+    for (std::size_t i = 0; i < iScene.props.size(); ++i)
+    {
+        const Property & prop = iScene.props[i];
+        if (!iName.empty())
+        {
+            if (prop.path == iName)
             {
-                propEnd = 1;
+                return i;
             }
+        }
+        else if (found == iScene.props.size() ||
+                 (prop.array.valid() && !iScene.props[found].array.valid()) ||
+                 (prop.array.valid() == iScene.props[found].array.valid() &&
+                  prop.numSamples > iScene.props[found].numSamples))
+        {
+            found = i;
+        }
+    }
+
+    if (found == iScene.props.size())
+    {
+        ABC_THROW("Couldn't find the property " << iName);
+    }
+    return found;
+}
 
-            for (int j = data.start; j < propEnd; ++j)
+//-*****************************************************************************
+// Threads take the next unit from the queue until it is empty, and record
+// how long each unit took and what it read.  Every unit is done by exactly
+// one thread so the results don't need a lock.
+class Reader
+{
+public:
+    Reader(Scene & iScene, Mode iMode, const std::vector< std::size_t > &
+           iUnits, std::size_t iScanProp)
+        : m_scene(iScene), m_mode(iMode), m_units(iUnits),
+          m_scanProp(iScanProp), m_next(0),
+          latencies(iUnits.size(), 0.0), bytes(iUnits.size(), 0),
+          samples(iUnits.size(), 0)
+    {
+    }
+
+    void operator()(std::size_t, std::size_t)
+    {
+        for (;;)
+        {
+            std::size_t unit;
             {
-                if (prop.getDataType().getPod() != Alembic::Util::kStringPOD)
-                {
-                    char buffer[4096];
-                    prop.get(buffer, j);
-                }
-                else
+                Util::scoped_lock l(m_lock);
+                if (m_next == m_units.size())
                 {
-                    std::vector< std::string > buffer(
-                        prop.getDataType().getExtent());
-
-                    prop.get(&buffer.front(), j);
+                    return;
                 }
+                unit = m_next++;
             }
+
+            double start = getTimeSec();
+            read(unit);
+            latencies[unit] = getTimeSec() - start;
         }
+    }
 
-        for (std::size_t i = 0; i < numArrays; ++i)
+private:
+    void read(std::size_t iUnit)
+    {
+        std::size_t value = m_units[iUnit];
+        switch (m_mode)
         {
-            Abc::IArrayProperty & prop = mArchives[a].arrays[i];
-            int propEnd = std::min(data.end, (int) prop.getNumSamples());
-            if (prop.isConstant())
+            case kWalk:
             {
-                propEnd = 1;
+                Property & prop = m_scene.props[value];
+                for (std::size_t i = 0; i < prop.numSamples; ++i)
+                {
+                    bytes[iUnit] += readSample(prop, i);
+                }
+                samples[iUnit] = prop.numSamples;
+            }
+            break;
+
+            case kPlay:
+            case kRandom:
+            {
+                for (std::size_t i = 0; i < m_scene.props.size(); ++i)
+                {
+                    Property & prop = m_scene.props[i];
+                    if (value < prop.numSamples)
+                    {
+                        bytes[iUnit] += readSample(prop, value);
+                        samples[iUnit] ++;
+                    }
+                }
             }
+            break;
 
-            for (int j = data.start; j < propEnd; ++j)
+            case kProp:
             {
-                Alembic::AbcCoreAbstract::ArraySamplePtr samp;
-                prop.get(samp, j);
+                bytes[iUnit] = readSample(m_scene.props[m_scanProp], value);
+                samples[iUnit] = 1;
             }
+            break;
         }
     }
 
-    printf("readProps Work Unit End %d %d %f\n",
-           data.start, data.end, getTimeSec() - startTime);
+    Scene & m_scene;
+    Mode m_mode;
+    const std::vector< std::size_t > & m_units;
+    std::size_t m_scanProp;
+    Util::mutex m_lock;
+    std::size_t m_next;
 
-    pthread_exit(0);
-}
+public:
+    std::vector< double > latencies;
+    std::vector< std::size_t > bytes;
+    std::vector< std::size_t > samples;
+};
 
-void findProps(int iArchiveNum, Abc::ICompoundProperty & iParent)
+//-*****************************************************************************
+void printRun(std::ostream & iOut, Mode iMode, const char * iBackend,
+              std::size_t iNumStreams, std::size_t iNumThreads,
+              std::size_t iRepeat, double iOpenTime, double iReadTime,
+              const Reader & iReader)
 {
-    size_t numProps = iParent.getNumProperties();
-    for (size_t i = 0; i < numProps; ++i)
+    std::size_t numUnits = iReader.latencies.size();
+    Util::uint64_t totalBytes = 0;
+    Util::uint64_t totalSamples = 0;
+    for (std::size_t i = 0; i < numUnits; ++i)
     {
-        const Alembic::AbcCoreAbstract::PropertyHeader & childHeader =
-            iParent.getPropertyHeader(i);
-        if (childHeader.isScalar())
-        {
-            Alembic::Abc::IScalarProperty prop(iParent, childHeader.getName());
-            if (prop.getNumSamples() > 0)
-            {
-                mArchives[iArchiveNum].scalars.push_back(prop);
-                mArchives[iArchiveNum].maxNumSamples = std::max(
-                    mArchives[iArchiveNum].maxNumSamples, prop.getNumSamples());
-            }
-        }
-        else if (childHeader.isArray())
-        {
-            Alembic::Abc::IArrayProperty prop(iParent, childHeader.getName());
-            if (prop.getNumSamples() > 0)
-            {
-                mArchives[iArchiveNum].arrays.push_back(prop);
-                mArchives[iArchiveNum].maxNumSamples = std::max(
-                    mArchives[iArchiveNum].maxNumSamples, prop.getNumSamples());
-            }
-        }
-        else
+        totalBytes += iReader.bytes[i];
+        totalSamples += iReader.samples[i];
+    }
+
+    std::vector< double > sorted = iReader.latencies;
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (std::size_t i = 0; i < numUnits; ++i)
+    {
+        sum += sorted[i];
+    }
+
+    // log2 buckets of microseconds, bucket k holds latencies below 2^(k+1)
+    std::vector< std::size_t > histogram;
+    for (std::size_t i = 0; i < numUnits; ++i)
+    {
+        double us = sorted[i] * 1000000.0;
+        std::size_t bucket = 0;
+        while (us >= 2.0 && bucket < 40)
         {
-            Alembic::Abc::ICompoundProperty prop(iParent,
-                childHeader.getName());
-            findProps(iArchiveNum, prop);
+            us *= 0.5;
+            bucket++;
         }
+        histogram.resize(std::max(histogram.size(), bucket + 1), 0);
+        histogram[bucket]++;
+    }
+
+    double seconds = std::max(iReadTime, 1e-9);
+
+    iOut << "    {\"mode\": \"" << modeName(iMode) << "\", \"backend\": \""
+         << iBackend << "\", \"streams\": " << iNumStreams
+         << ", \"threads\": " << iNumThreads << ", \"repeat\": " << iRepeat
+         << "," << std::endl
+         << "     \"openSeconds\": " << iOpenTime << ", \"readSeconds\": "
+         << iReadTime << ", \"units\": " << numUnits << ", \"samples\": "
+         << totalSamples << ", \"bytes\": " << totalBytes << "," << std::endl
+         << "     \"unitsPerSecond\": " << numUnits / seconds
+         << ", \"samplesPerSecond\": " << totalSamples / seconds
+         << ", \"megabytesPerSecond\": " << totalBytes / seconds / 1048576.0
+         << "," << std::endl;
+
+    iOut << "     \"latencyUs\": {";
+    if (numUnits > 0)
+    {
+        iOut << "\"mean\": " << sum / numUnits * 1000000.0
+             << ", \"min\": " << sorted.front() * 1000000.0
+             << ", \"p50\": " << sorted[numUnits / 2] * 1000000.0
+             << ", \"p90\": " << sorted[numUnits * 9 / 10] * 1000000.0
+             << ", \"p99\": " << sorted[numUnits * 99 / 100] * 1000000.0
+             << ", \"max\": " << sorted.back() * 1000000.0;
     }
+    iOut << "}," << std::endl << "     \"histogram\": [";
+    for (std::size_t k = 0; k < histogram.size(); ++k)
+    {
+        iOut << (k ? ", " : "") << "{\"belowUs\": "
+             << ((Util::uint64_t) 1 << (k + 1)) << ", \"count\": "
+             << histogram[k] << "}";
+    }
+    iOut << "]}";
 }
 
-void walkObjects(int iArchiveNum, Abc::IObject & iParent)
+//-*****************************************************************************
+template < class T >
+bool parseList(const std::string & iArg, std::vector< T > & oList)
 {
-    size_t numChildren = iParent.getNumChildren();
-    for (size_t i = 0; i < numChildren; i++)
+    oList.clear();
+    std::stringstream ss(iArg);
+    std::string item;
+    while (std::getline(ss, item, ','))
     {
-        const Abc::ObjectHeader & header = iParent.getChildHeader(i);
-        Abc::IObject child(iParent, header.getName());
-
-        Abc::ICompoundProperty prop = child.getProperties();
-        findProps(iArchiveNum, prop);
-        walkObjects(iArchiveNum, child);
+        char * end = NULL;
+        long value = strtol(item.c_str(), &end, 10);
+        if (item.empty() || *end != '\0' || value < 0)
+        {
+            return false;
+        }
+        oList.push_back((T) value);
     }
+    return !oList.empty();
 }
 
-void walkArchives(WorkUnit & data)
+bool parseModes(const std::string & iArg, std::vector< Mode > & oModes)
 {
-    printf("walkArchives Work Unit Start %d %d\n",  data.start, data.end);
-
-    for (int i = data.start; i < data.end; ++i)
+    oModes.clear();
+    std::stringstream ss(iArg);
+    std::string item;
+    while (std::getline(ss, item, ','))
     {
-        Abc::IObject top = mArchives[i].archive.getTop();
-        walkObjects(i, top);
+        if (item == "walk") oModes.push_back(kWalk);
+        else if (item == "play") oModes.push_back(kPlay);
+        else if (item == "random") oModes.push_back(kRandom);
+        else if (item == "prop") oModes.push_back(kProp);
+        else return false;
     }
-
-    printf("walkArchives Work Unit End %d %d\n",  data.start, data.end);
+    return !oModes.empty();
 }
 
-};
-
-void * readPropsWrap(void * ptr)
+bool parseBackends(const std::string & iArg,
+    std::vector< AbcF::IFactory::OgawaReadStrategy > & oBackends)
 {
-    WorkUnit * data = (WorkUnit *) ptr;
-    data->walker->readProps(*data);
-    pthread_exit(0);
+    oBackends.clear();
+    std::stringstream ss(iArg);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        if (item == "mmap")
+        {
+            oBackends.push_back(AbcF::IFactory::kMemoryMappedFiles);
+        }
+        else if (item == "pread")
+        {
+            oBackends.push_back(AbcF::IFactory::kFileStreams);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return !oBackends.empty();
 }
 
-void * walkArchivesWrap(void * ptr)
-{
-    WorkUnit * data = (WorkUnit *) ptr;
-    data->walker->walkArchives(*data);
-    pthread_exit(0);
 }
 
+//-*****************************************************************************
 int main(int argc, char ** argv)
 {
-    if (argc < 4)
+    std::string desc("abcwalk [OPTION] FILE [FILE ...]\n"
+    "Measures how fast archives are read, with a few access patterns, and\n"
+    "prints the throughput and latency histograms as JSON.\n"
+    "  -mode LIST     access patterns, any of walk (every sample of every\n"
+    "                 property), play (frames in order), random (frames at\n"
+    "                 random) and prop (every sample of one property),\n"
+    "                 default walk,play,random,prop\n"
+    "  -threads LIST  thread counts, default 1 and all the cores\n"
+    "  -streams LIST  Ogawa stream counts, 0 means as many as threads,\n"
+    "                 default 0\n"
+    "  -backend LIST  Ogawa read backends, mmap and/or pread, default mmap\n"
+    "  -prop PATH     the property for the prop mode, like\n"
+    "                 /obj/.geom/P, default the array property with the\n"
+    "                 most samples\n"
+    "  -frames N      how many frames the random mode reads, default as\n"
+    "                 many as there are frames\n"
+    "  -seed N        seed for the random mode, default 1\n"
+    "  -repeat N      how many times to do every run, default 1\n"
+    "  -h, --help     prints this help message\n"
+    "HDF5 archives are always read on one thread.\n");
+
+    Settings settings;
+    parseModes("walk,play,random,prop", settings.modes);
+    settings.threads.push_back(1);
+    if (Util::thread::hardware_concurrency() > 1)
     {
-        printf ("sceneWalk maxNumThreads ogawaStreams fileName [fileName ...]\n");
-        return 0;
+        settings.threads.push_back(Util::thread::hardware_concurrency());
     }
+    settings.streams.push_back(0);
+    settings.backends.push_back(AbcF::IFactory::kMemoryMappedFiles);
 
-    int maxThreads = atoi(argv[1]);
-    int ogawaStreams = atoi(argv[2]);
-{
-    ArchiveWalker walker;
-
-    Alembic::AbcCoreFactory::IFactory factory;
-    Alembic::AbcCoreFactory::IFactory::CoreType coreType;
-    factory.setOgawaNumStreams(ogawaStreams);
-    double time_start = getTimeSec();
-    for (int i = 3; i < argc; ++i)
+    for (int i = 1; i < argc; ++i)
     {
-        Abc::IArchive archive = factory.getArchive(argv[i], coreType);
+        std::string arg = argv[i];
+        std::string value = i + 1 < argc ? argv[i + 1] : "";
+        bool ok = true;
+        if (arg == "-mode" && i + 1 < argc)
+        {
+            ok = parseModes(value, settings.modes);
+            ++i;
+        }
+        else if (arg == "-threads" && i + 1 < argc)
+        {
+            ok = parseList(value, settings.threads) &&
+                std::find(settings.threads.begin(), settings.threads.end(),
+                          (std::size_t) 0) == settings.threads.end();
+            ++i;
+        }
+        else if (arg == "-streams" && i + 1 < argc)
+        {
+            ok = parseList(value, settings.streams);
+            ++i;
+        }
+        else if (arg == "-backend" && i + 1 < argc)
+        {
+            ok = parseBackends(value, settings.backends);
+            ++i;
+        }
+        else if (arg == "-prop" && i + 1 < argc)
+        {
+            settings.propName = value;
+            ++i;
+        }
+        else if (arg == "-frames" && i + 1 < argc)
+        {
+            settings.numRandom = (std::size_t) std::max(0, atoi(value.c_str()));
+            ++i;
+        }
+        else if (arg == "-seed" && i + 1 < argc)
+        {
+            settings.seed = (Util::uint64_t) strtoull(value.c_str(), NULL, 10);
+            ++i;
+        }
+        else if (arg == "-repeat" && i + 1 < argc)
+        {
+            settings.repeat = (std::size_t) std::max(1, atoi(value.c_str()));
+            ++i;
+        }
+        else if (arg.substr(0, 1) == "-")
+        {
+            std::cout << desc << std::endl;
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+        else
+        {
+            settings.files.push_back(arg);
+        }
 
-        if (archive.valid())
+        if (!ok)
         {
-            walker.addArchive(archive);
+            std::cerr << "ERROR: bad value for " << arg << ": " << value
+                      << std::endl;
+            return 1;
         }
     }
 
-    int numTraverse = std::min(maxThreads, (int) walker.mArchives.size());
-    std::vector<WorkUnit> traverseArchives(numTraverse);
-    int lastEnd = 0;
-    int workSize = walker.mArchives.size() / numTraverse;
-    int workRem = 0;
-    if ((int) walker.mArchives.size() > numTraverse)
-        workRem = walker.mArchives.size() % numTraverse;
-
-    pthread_t * walkThreads = new pthread_t[numTraverse];
-
-    for (int i = 0; i < numTraverse; ++i)
+    if (settings.files.empty())
     {
-        traverseArchives[i].archive = i;
-        traverseArchives[i].start = lastEnd;
-        traverseArchives[i].walker = &walker;
-        lastEnd += workSize;
-        if (i < workRem)
-            lastEnd ++;
-        traverseArchives[i].end = lastEnd;
-
-        pthread_create(&(walkThreads[i]), NULL, walkArchivesWrap,
-            (void *) &(traverseArchives[i]));
+        std::cout << desc << std::endl;
+        return 1;
     }
 
-    for (int i = 0; i < numTraverse; ++i)
+    try
     {
-        pthread_join(walkThreads[i], NULL);
-    }
+        // look at the scene once, for what doesn't change between runs
+        Scene scene;
+        openScene(settings, AbcF::IFactory::kMemoryMappedFiles, 1, scene);
+        bool isOgawa = scene.coreType == AbcF::IFactory::kOgawa;
+        std::size_t scanProp = scene.props.empty() ? 0 :
+            scanProperty(scene, settings.propName);
+
+        std::ostream & out = std::cout;
+        out << "{" << std::endl << "  \"files\": [";
+        for (std::size_t i = 0; i < settings.files.size(); ++i)
+        {
+            out << (i ? ", " : "") << "\"" << settings.files[i] << "\"";
+        }
+        out << "]," << std::endl;
 
-    delete [] walkThreads;
+        out << "  \"core\": \"" << (isOgawa ? "Ogawa" : "HDF5") << "\","
+            << std::endl << "  \"numProperties\": " << scene.props.size()
+            << ", \"numFrames\": " << scene.maxNumSamples << "," << std::endl
+            << "  \"scanProperty\": \""
+            << (scene.props.empty() ? "" : scene.props[scanProp].path)
+            << "\"," << std::endl << "  \"runs\": [" << std::endl;
 
-    double totalTime = getTimeSec() - time_start;
-    printf ("Property Collection Wall Time: %f\n\n", totalTime);
+        if (!isOgawa)
+        {
+            settings.threads.assign(1, 1);
+            settings.streams.assign(1, 1);
+            settings.backends.resize(1);
+        }
 
-    time_start = getTimeSec();
+        // the frames the random mode reads
+        std::vector< std::size_t > randomFrames(settings.numRandom > 0 ?
+            settings.numRandom : scene.maxNumSamples);
+        Random random(settings.seed);
+        for (std::size_t i = 0; i < randomFrames.size(); ++i)
+        {
+            randomFrames[i] = random(std::max(scene.maxNumSamples,
+                                              (std::size_t) 1));
+        }
 
-    size_t maxSamples = 0;
-    for (size_t i = 0; i < walker.mArchives.size(); ++i)
-    {
-        maxSamples = std::max(walker.mArchives[i].maxNumSamples, maxSamples);
-    }
+        std::vector< Run > runs;
+        for (std::size_t b = 0; b < settings.backends.size(); ++b)
+        {
+            for (std::size_t s = 0; s < settings.streams.size(); ++s)
+            {
+                for (std::size_t t = 0; t < settings.threads.size(); ++t)
+                {
+                    for (std::size_t m = 0; m < settings.modes.size(); ++m)
+                    {
+                        for (std::size_t r = 0; r < settings.repeat; ++r)
+                        {
+                            Run run;
+                            run.backend = settings.backends[b];
+                            run.threads = settings.threads[t];
+                            run.streams = settings.streams[s] > 0 ?
+                                settings.streams[s] : run.threads;
+                            run.mode = settings.modes[m];
+                            run.repeat = r;
+                            runs.push_back(run);
+                        }
+                    }
+                }
+            }
+        }
 
-    int numSamples = std::min(maxThreads, (int) maxSamples);
-    std::vector<WorkUnit> readSamples(numSamples);
-    lastEnd = 0;
-    workSize = maxSamples / numSamples;
-    workRem = 0;
-    if ((int) maxSamples > numSamples)
-        workRem = maxSamples % numSamples;
+        for (std::size_t i = 0; i < runs.size(); ++i)
+        {
+            const Run & run = runs[i];
 
-    pthread_t * readThreads = new pthread_t[numSamples];
-    for (int i = 0; i < numSamples; ++i)
-    {
-        readSamples[i].archive = i;  // ignored
-        readSamples[i].start = lastEnd;
-        readSamples[i].walker = &walker;
-        lastEnd += workSize;
-        if (i < workRem)
-            lastEnd ++;
-        readSamples[i].end = lastEnd;
-        pthread_create(&(readThreads[i]), NULL, readPropsWrap,
-            (void *) &(readSamples[i]));
-    }
+            double start = getTimeSec();
+            Scene runScene;
+            openScene(settings, run.backend, run.streams, runScene);
+            double openTime = getTimeSec() - start;
+
+            std::vector< std::size_t > units;
+            if (run.mode == kWalk)
+            {
+                units.resize(runScene.props.size());
+            }
+            else if (run.mode == kPlay)
+            {
+                units.resize(runScene.maxNumSamples);
+            }
+            else if (run.mode == kProp && !runScene.props.empty())
+            {
+                units.resize(runScene.props[scanProp].numSamples);
+            }
+
+            if (run.mode == kRandom)
+            {
+                units = randomFrames;
+            }
+            else
+            {
+                for (std::size_t u = 0; u < units.size(); ++u)
+                {
+                    units[u] = u;
+                }
+            }
+
+            Reader reader(runScene, run.mode, units, scanProp);
+            start = getTimeSec();
+            Util::parallel_for(run.threads, 1, reader, run.threads);
+            double readTime = getTimeSec() - start;
 
-    for (int i = 0; i < numSamples; ++i)
+            if (i > 0)
+            {
+                out << "," << std::endl;
+            }
+            const char * backend = !isOgawa ? "none" :
+                run.backend == AbcF::IFactory::kFileStreams ? "pread" : "mmap";
+            printRun(out, run.mode, backend, isOgawa ? run.streams : 1,
+                     run.threads, run.repeat, openTime, readTime, reader);
+        }
+
+        out << std::endl << "  ]" << std::endl << "}" << std::endl;
+    }
+    catch (std::exception & e)
     {
-        pthread_join(readThreads[i], NULL);
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
     }
 
-    delete [] readThreads;
-
-    totalTime = getTimeSec()-time_start;
-    printf ("Property Read Wall Time: %f\n\n", totalTime);
-}
     return 0;
 }
@@ -128,6 +128,92 @@ void AbcReader::f( const IndexVec &vIndices,
     }
 }
 
+//-*****************************************************************************
+void AbcReader::vertices( index_t iFirstIndex, const V3d *iVals,
+                          size_t iNumVals )
+{
+    assert( ( index_t ) ( m_vertices.size()+1 ) == iFirstIndex );
+
+    m_vertices.reserve( m_vertices.size() + iNumVals );
+    for ( size_t i = 0; i < iNumVals; ++i )
+    {
+        m_vertices.push_back( V3f( iVals[i].x, iVals[i].y, iVals[i].z ) );
+    }
+}
+
+//-*****************************************************************************
+void AbcReader::textureVertices( index_t iFirstIndex, const V2d *iVals,
+                                 size_t iNumVals )
+{
+    assert( ( index_t ) ( m_texVertices.size()+1 ) == iFirstIndex );
+
+    m_texVertices.reserve( m_texVertices.size() + iNumVals );
+    for ( size_t i = 0; i < iNumVals; ++i )
+    {
+        m_texVertices.push_back( V2f( iVals[i].x, iVals[i].y ) );
+    }
+}
+
+//-*****************************************************************************
+void AbcReader::normals( index_t iFirstIndex, const V3d *iVals,
+                         size_t iNumVals )
+{
+    assert( ( index_t ) ( m_normals.size()+1 ) == iFirstIndex );
+
+    m_normals.reserve( m_normals.size() + iNumVals );
+    for ( size_t i = 0; i < iNumVals; ++i )
+    {
+        m_normals.push_back( N3f( iVals[i].x, iVals[i].y, iVals[i].z ) );
+    }
+}
+
+//-*****************************************************************************
+void AbcReader::faces( const index_t *iFaceCounts, size_t iNumFaces,
+                       const index_t *iVertexIndices,
+                       const index_t *iTextureIndices,
+                       const index_t *iNormalIndices )
+{
+    size_t numIndices = 0;
+    for ( size_t i = 0; i < iNumFaces; ++i )
+    {
+        numIndices += ( size_t )iFaceCounts[i];
+    }
+
+    m_counts.reserve( m_counts.size() + iNumFaces );
+    m_indices.reserve( m_indices.size() + numIndices );
+
+    size_t start = 0;
+    for ( size_t i = 0; i < iNumFaces; ++i )
+    {
+        size_t count = ( size_t )iFaceCounts[i];
+        if ( count > 2 )
+        {
+            m_counts.push_back( count );
+            for ( size_t j = start; j < start + count; ++j )
+            {
+                m_indices.push_back( ( int )( iVertexIndices[j]-1 ) );
+            }
+
+            if ( iTextureIndices )
+            {
+                for ( size_t j = start; j < start + count; ++j )
+                {
+                    m_texIndices.push_back( ( int )( iTextureIndices[j]-1 ) );
+                }
+            }
+
+            if ( iNormalIndices )
+            {
+                for ( size_t j = start; j < start + count; ++j )
+                {
+                    m_normIndices.push_back( ( int )( iNormalIndices[j]-1 ) );
+                }
+            }
+        }
+        start += count;
+    }
+}
+
 //-*****************************************************************************
 void AbcReader::activeObject( const std::string &iObjectName )
 {
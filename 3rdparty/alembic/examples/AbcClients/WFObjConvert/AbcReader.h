@@ -74,6 +74,20 @@ public:
                     const IndexVec &iTextureIndices,
                     const IndexVec &iNormalIndices );
 
+    virtual void vertices( index_t iFirstIndex, const V3d *iVals,
+                           size_t iNumVals );
+
+    virtual void textureVertices( index_t iFirstIndex, const V2d *iVals,
+                                  size_t iNumVals );
+
+    virtual void normals( index_t iFirstIndex, const V3d *iVals,
+                          size_t iNumVals );
+
+    virtual void faces( const index_t *iFaceCounts, size_t iNumFaces,
+                        const index_t *iVertexIndices,
+                        const index_t *iTextureIndices,
+                        const index_t *iNormalIndices );
+
     virtual void activeObject( const std::string &iObjectName );
 
 protected:
@@ -0,0 +1,1144 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <AbcClients/WFObjConvert/ParseReader.h>
+#include <AbcClients/WFObjConvert/Parser.h>
+#include <AbcClients/WFObjConvert/Reader.h>
+
+#include <Alembic/Util/Thread.h>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AbcClients {
+namespace WFObjConvert {
+
+namespace {
+
+//-*****************************************************************************
+// chunks are at least this big, so that small files aren't split up
+static const size_t kMinChunkBytes = 1024 * 1024;
+
+// and there are this many per thread, to even out their work
+static const size_t kChunksPerThread = 4;
+
+//-*****************************************************************************
+// A read only view of a whole file.
+class MappedFile : public Alembic::Util::noncopyable
+{
+public:
+    MappedFile( const std::string &iFileName );
+    ~MappedFile();
+
+    bool valid() const { return m_valid; }
+    const char *data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    bool m_valid;
+    const char *m_data;
+    size_t m_size;
+
+#ifdef _MSC_VER
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+};
+
+#ifdef _MSC_VER
+
+//-*****************************************************************************
+MappedFile::MappedFile( const std::string &iFileName )
+  : m_valid( false )
+  , m_data( NULL )
+  , m_size( 0 )
+  , m_file( INVALID_HANDLE_VALUE )
+  , m_mapping( NULL )
+{
+    m_file = CreateFileA( iFileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                          NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( m_file == INVALID_HANDLE_VALUE )
+    {
+        return;
+    }
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx( m_file, &size ) )
+    {
+        return;
+    }
+
+    m_size = ( size_t )size.QuadPart;
+    if ( m_size == 0 )
+    {
+        m_valid = true;
+        return;
+    }
+
+    m_mapping = CreateFileMappingA( m_file, NULL, PAGE_READONLY, 0, 0, NULL );
+    if ( m_mapping == NULL )
+    {
+        return;
+    }
+
+    m_data = ( const char * )MapViewOfFile( m_mapping, FILE_MAP_READ,
+                                            0, 0, 0 );
+    m_valid = ( m_data != NULL );
+}
+
+//-*****************************************************************************
+MappedFile::~MappedFile()
+{
+    if ( m_data )
+    {
+        UnmapViewOfFile( m_data );
+    }
+
+    if ( m_mapping )
+    {
+        CloseHandle( m_mapping );
+    }
+
+    if ( m_file != INVALID_HANDLE_VALUE )
+    {
+        CloseHandle( m_file );
+    }
+}
+
+#else
+
+//-*****************************************************************************
+MappedFile::MappedFile( const std::string &iFileName )
+  : m_valid( false )
+  , m_data( NULL )
+  , m_size( 0 )
+{
+    int fd = open( iFileName.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+        return;
+    }
+
+    struct stat buf;
+    if ( fstat( fd, &buf ) == 0 )
+    {
+        m_size = ( size_t )buf.st_size;
+        if ( m_size == 0 )
+        {
+            m_valid = true;
+        }
+        else
+        {
+            void *data = mmap( NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( data != MAP_FAILED )
+            {
+                m_data = ( const char * )data;
+                m_valid = true;
+            }
+        }
+    }
+
+    // the mapping outlives the descriptor
+    close( fd );
+}
+
+//-*****************************************************************************
+MappedFile::~MappedFile()
+{
+    if ( m_data )
+    {
+        munmap( ( void * )m_data, m_size );
+    }
+}
+
+#endif
+
+//-*****************************************************************************
+// What a run of lines holds. Consecutive lines of the batched kinds are
+// gathered into one run, every other line is a run of its own.
+enum RunKind
+{
+    kVertexRun,         // 3-dimensional "v"
+    kTextureRun,        // 2-dimensional "vt"
+    kNormalRun,         // "vn"
+    kFaceRun,           // "f" whose vertices all have the same indices
+    kValuesLine,        // any other "v", "vt", "vn" or "vp"
+    kElementLine,       // "l", "p" and any other "f"
+    kNamesLine,         // "g"
+    kNameLine,          // "o", "mtllib", "usemtl" and the like
+    kBoolLine,          // "bevel", "cinterp", "dinterp", "s on"
+    kIntLine            // "s 1", "lod"
+};
+
+//-*****************************************************************************
+struct Run
+{
+    RunKind kind;
+
+    // the keyword of a single line run
+    std::string keyword;
+
+    // line of the chunk, counting from 1 and skipping empty lines as
+    // ParseOBJ does, that the run starts on
+    size_t line;
+
+    // range of the run in the array its kind is stored in
+    size_t begin;
+    size_t end;
+
+    // for faces and elements, where their indices start. Face runs only
+    // store the texture and normal indices they have, element lines
+    // store all of them with -1 for the missing ones
+    size_t indexBegin;
+    size_t textureBegin;
+    size_t normalBegin;
+    bool hasTexture;
+    bool hasNormal;
+};
+
+//-*****************************************************************************
+// Everything parsed from one chunk of the file.
+struct Chunk
+{
+    Chunk()
+      : begin( NULL ), end( NULL ), numLines( 0 ), failed( false ),
+        errorLine( 0 ) {}
+
+    const char *begin;
+    const char *end;
+
+    // the lines that aren't empty
+    size_t numLines;
+
+    std::vector<Run> runs;
+
+    std::vector<V3d> points;            // vertex and normal runs
+    std::vector<V2d> texPoints;         // texture runs
+    std::vector<double> values;         // value lines
+
+    std::vector<index_t> counts;        // faces and elements
+    std::vector<size_t> elementLines;
+    std::vector<index_t> vIndices;
+    std::vector<index_t> vtIndices;
+    std::vector<index_t> vnIndices;
+
+    std::vector<std::string> names;     // names lines and name lines
+    std::vector<int> ints;              // bool lines and int lines
+
+    // parsing stops at the first syntax error
+    bool failed;
+    size_t errorLine;
+    std::string error;
+};
+
+//-*****************************************************************************
+// The whitespace ParseOBJ's grammar skips.
+inline bool isSpace( char c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v' ||
+        c == '\n';
+}
+
+//-*****************************************************************************
+inline const char *skipSpace( const char *p, const char *e )
+{
+    while ( p < e && isSpace( *p ) ) { ++p; }
+    return p;
+}
+
+//-*****************************************************************************
+// Where iWord ends if the line starts with it, NULL otherwise. Like the
+// grammar's literals, the word doesn't have to be followed by a space.
+inline const char *afterWord( const char *p, const char *e,
+                              const char *iWord )
+{
+    size_t len = strlen( iWord );
+    if ( ( size_t )( e - p ) < len || memcmp( p, iWord, len ) != 0 )
+    {
+        return NULL;
+    }
+    return p + len;
+}
+
+//-*****************************************************************************
+// Reads a double the way the grammar does, skipping the whitespace before
+// it. p has to point into a null terminated line for strtod.
+bool parseDouble( const char *&p, const char *e, double &oVal )
+{
+    const char *b = skipSpace( p, e );
+    const char *q = b;
+    if ( q < e && ( *q == '+' || *q == '-' ) ) { ++q; }
+
+    // no hex floats, the grammar stops after the 0
+    if ( e - q > 1 && q[0] == '0' && ( q[1] == 'x' || q[1] == 'X' ) )
+    {
+        oVal = ( *b == '-' ) ? -0.0 : 0.0;
+        p = q + 1;
+        return true;
+    }
+
+    char *end = NULL;
+    oVal = strtod( b, &end );
+    if ( end == b )
+    {
+        return false;
+    }
+
+    p = end;
+    return true;
+}
+
+//-*****************************************************************************
+// Reads a signed integer in [iMin, iMax], without skipping whitespace. It
+// fails on overflow, as the grammar does.
+bool parseInteger( const char *&p, const char *e, long long iMin,
+                   long long iMax, long long &oVal )
+{
+    const char *q = p;
+    bool negative = false;
+    if ( q < e && ( *q == '+' || *q == '-' ) )
+    {
+        negative = ( *q == '-' );
+        ++q;
+    }
+
+    if ( q == e || *q < '0' || *q > '9' )
+    {
+        return false;
+    }
+
+    unsigned long long limit = negative ?
+        ( unsigned long long )( -( iMin + 1 ) ) + 1 :
+        ( unsigned long long )iMax;
+    unsigned long long val = 0;
+    while ( q < e && *q >= '0' && *q <= '9' )
+    {
+        unsigned long long digit = ( unsigned long long )( *q - '0' );
+        if ( val > ( limit - digit ) / 10 )
+        {
+            return false;
+        }
+        val = val * 10 + digit;
+        ++q;
+    }
+
+    oVal = !negative ? ( long long )val :
+        ( val == 0 ? 0 : -( long long )( val - 1 ) - 1 );
+    p = q;
+    return true;
+}
+
+//-*****************************************************************************
+inline bool parseIndex( const char *&p, const char *e, index_t &oVal )
+{
+    long long val = 0;
+    if ( !parseInteger( p, e, LLONG_MIN, LLONG_MAX, val ) )
+    {
+        return false;
+    }
+    oVal = ( index_t )val;
+    return true;
+}
+
+//-*****************************************************************************
+// Reads one of "v", "v/vt/vn", "v//vn" or "v/vt/", with -1 standing in for
+// the missing indices. Anything else after v, such as the "/vt" of "v/vt",
+// is left unread, which ends the element.
+bool parseTriplet( const char *&p, const char *e, index_t &oV, index_t &oVt,
+                   index_t &oVn )
+{
+    const char *q = skipSpace( p, e );
+    if ( !parseIndex( q, e, oV ) )
+    {
+        return false;
+    }
+
+    oVt = -1;
+    oVn = -1;
+    if ( q < e && *q == '/' )
+    {
+        const char *r = q + 1;
+        index_t vt = -1;
+        if ( parseIndex( r, e, vt ) )
+        {
+            if ( r < e && *r == '/' )
+            {
+                ++r;
+                oVt = vt;
+                parseIndex( r, e, oVn );
+                q = r;
+            }
+        }
+        else if ( r < e && *r == '/' )
+        {
+            ++r;
+            if ( parseIndex( r, e, oVn ) )
+            {
+                q = r;
+            }
+        }
+    }
+
+    p = q;
+    return true;
+}
+
+//-*****************************************************************************
+// Matches the longest of the grammar's on and off words.
+bool parseOnOff( const char *&p, const char *e, bool &oVal )
+{
+    static const char *words[] = { "on", "On", "ON", "true", "True", "TRUE",
+                                   "off", "Off", "OFF", "false", "False",
+                                   "FALSE" };
+
+    size_t best = 0;
+    for ( size_t i = 0; i < 12; ++i )
+    {
+        size_t len = strlen( words[i] );
+        if ( len > best && afterWord( p, e, words[i] ) )
+        {
+            best = len;
+            oVal = ( i < 6 );
+        }
+    }
+
+    p += best;
+    return best > 0;
+}
+
+//-*****************************************************************************
+// Parses the lines of one chunk, see ParseChunks below. Each line is tried
+// against the alternatives of ParseOBJ's grammar in the same order, and
+// like the grammar, whatever follows a match on the line is ignored.
+class ChunkParser
+{
+public:
+    ChunkParser( Chunk &ioChunk ) : m_chunk( ioChunk ) {}
+
+    void parse();
+
+private:
+    bool parseLine( const char *p, const char *e );
+    bool parseValues( const char *p, const char *e, const char *iKeyword );
+    bool parseElement( const char *p, const char *e, const char *iKeyword,
+                       size_t iMinCount );
+    bool parseName( const char *p, const char *e, const char *iKeyword,
+                    RunKind iKind );
+    bool parseBool( const char *p, const char *e, const char *iKeyword );
+    bool parseInt( const char *p, const char *e, const char *iKeyword );
+
+    Run &singleRun( RunKind iKind, const char *iKeyword, size_t iBegin );
+    Run &batchRun( RunKind iKind, size_t iBegin );
+
+    Chunk &m_chunk;
+
+    // the line being parsed, null terminated for strtod
+    std::string m_line;
+
+    std::vector<double> m_vals;
+    std::vector<index_t> m_v;
+    std::vector<index_t> m_vt;
+    std::vector<index_t> m_vn;
+};
+
+//-*****************************************************************************
+void ChunkParser::parse()
+{
+    const char *p = m_chunk.begin;
+    while ( p < m_chunk.end )
+    {
+        const char *eol = ( const char * )memchr( p, '\n',
+                                                  m_chunk.end - p );
+        const char *lineEnd = eol ? eol : m_chunk.end;
+
+        // like ParseOBJ, empty lines are skipped without being counted
+        if ( lineEnd != p )
+        {
+            ++m_chunk.numLines;
+            m_line.assign( p, lineEnd );
+
+            const char *b = m_line.c_str();
+            if ( !parseLine( b, b + m_line.size() ) )
+            {
+                m_chunk.failed = true;
+                m_chunk.errorLine = m_chunk.numLines;
+                m_chunk.error = "Syntax Error";
+                return;
+            }
+        }
+
+        p = eol ? eol + 1 : m_chunk.end;
+    }
+}
+
+//-*****************************************************************************
+Run &ChunkParser::singleRun( RunKind iKind, const char *iKeyword,
+                             size_t iBegin )
+{
+    Run run;
+    run.kind = iKind;
+    if ( iKeyword )
+    {
+        run.keyword = iKeyword;
+    }
+    run.line = m_chunk.numLines;
+    run.begin = iBegin;
+    run.end = iBegin;
+    run.indexBegin = m_chunk.vIndices.size();
+    run.textureBegin = m_chunk.vtIndices.size();
+    run.normalBegin = m_chunk.vnIndices.size();
+    run.hasTexture = false;
+    run.hasNormal = false;
+    m_chunk.runs.push_back( run );
+    return m_chunk.runs.back();
+}
+
+//-*****************************************************************************
+Run &ChunkParser::batchRun( RunKind iKind, size_t iBegin )
+{
+    if ( !m_chunk.runs.empty() && m_chunk.runs.back().kind == iKind )
+    {
+        return m_chunk.runs.back();
+    }
+
+    return singleRun( iKind, NULL, iBegin );
+}
+
+//-*****************************************************************************
+bool ChunkParser::parseLine( const char *p, const char *e )
+{
+    p = skipSpace( p, e );
+
+    return parseValues( p, e, "v" ) ||
+        parseValues( p, e, "vt" ) ||
+        parseValues( p, e, "vn" ) ||
+        parseValues( p, e, "vp" ) ||
+
+        parseElement( p, e, "f", 3 ) ||
+        parseElement( p, e, "l", 2 ) ||
+        parseElement( p, e, "p", 1 ) ||
+
+        parseName( p, e, "g", kNamesLine ) ||
+        parseName( p, e, "o", kNameLine ) ||
+        parseName( p, e, "mtllib", kNameLine ) ||
+        parseName( p, e, "maplib", kNameLine ) ||
+        parseName( p, e, "usemtl", kNameLine ) ||
+        parseName( p, e, "usemap", kNameLine ) ||
+        parseName( p, e, "trace_obj", kNameLine ) ||
+        parseName( p, e, "shadow_obj", kNameLine ) ||
+
+        parseBool( p, e, "bevel" ) ||
+        parseBool( p, e, "cinterp" ) ||
+        parseBool( p, e, "dinterp" ) ||
+
+        parseBool( p, e, "s" ) ||
+        parseInt( p, e, "s" ) ||
+
+        parseInt( p, e, "lod" ) ||
+
+        // comments
+        ( p < e && *p == '#' );
+}
+
+//-*****************************************************************************
+bool ChunkParser::parseValues( const char *p, const char *e,
+                               const char *iKeyword )
+{
+    p = afterWord( p, e, iKeyword );
+    if ( !p )
+    {
+        return false;
+    }
+
+    m_vals.clear();
+    double val = 0.0;
+    while ( parseDouble( p, e, val ) )
+    {
+        m_vals.push_back( val );
+    }
+
+    if ( m_vals.empty() )
+    {
+        return false;
+    }
+
+    size_t numVals = m_vals.size();
+    char k1 = iKeyword[1];
+
+    if ( k1 == '\0' && numVals == 3 )
+    {
+        Run &run = batchRun( kVertexRun, m_chunk.points.size() );
+        m_chunk.points.push_back( V3d( m_vals[0], m_vals[1], m_vals[2] ) );
+        run.end = m_chunk.points.size();
+    }
+    else if ( k1 == 'n' && numVals == 3 )
+    {
+        Run &run = batchRun( kNormalRun, m_chunk.points.size() );
+        m_chunk.points.push_back( V3d( m_vals[0], m_vals[1], m_vals[2] ) );
+        run.end = m_chunk.points.size();
+    }
+    else if ( k1 == 't' && numVals == 2 )
+    {
+        Run &run = batchRun( kTextureRun, m_chunk.texPoints.size() );
+        m_chunk.texPoints.push_back( V2d( m_vals[0], m_vals[1] ) );
+        run.end = m_chunk.texPoints.size();
+    }
+    else
+    {
+        // ParseReader checks the number of values when it is handed over
+        Run &run = singleRun( kValuesLine, iKeyword,
+                              m_chunk.values.size() );
+        m_chunk.values.insert( m_chunk.values.end(), m_vals.begin(),
+                               m_vals.end() );
+        run.end = m_chunk.values.size();
+    }
+    return true;
+}
+
+//-*****************************************************************************
+bool ChunkParser::parseElement( const char *p, const char *e,
+                                const char *iKeyword, size_t iMinCount )
+{
+    p = afterWord( p, e, iKeyword );
+    if ( !p )
+    {
+        return false;
+    }
+
+    m_v.clear();
+    m_vt.clear();
+    m_vn.clear();
+
+    index_t v = 0;
+    index_t vt = 0;
+    index_t vn = 0;
+    while ( parseTriplet( p, e, v, vt, vn ) )
+    {
+        m_v.push_back( v );
+        m_vt.push_back( vt );
+        m_vn.push_back( vn );
+    }
+
+    size_t count = m_v.size();
+    if ( count < iMinCount )
+    {
+        return false;
+    }
+
+    // ParseReader drops the -1 indices, so a face only has texture
+    // vertices or normals if none of them are -1
+    bool hasTexture = ( m_vt[0] != -1 );
+    bool hasNormal = ( m_vn[0] != -1 );
+    bool uniform = true;
+    for ( size_t i = 1; i < count && uniform; ++i )
+    {
+        uniform = ( ( m_vt[i] != -1 ) == hasTexture &&
+                    ( m_vn[i] != -1 ) == hasNormal );
+    }
+
+    Run *run = NULL;
+    if ( iKeyword[0] == 'f' && uniform )
+    {
+        if ( !m_chunk.runs.empty() &&
+             m_chunk.runs.back().kind == kFaceRun &&
+             m_chunk.runs.back().hasTexture == hasTexture &&
+             m_chunk.runs.back().hasNormal == hasNormal )
+        {
+            run = &m_chunk.runs.back();
+        }
+        else
+        {
+            run = &singleRun( kFaceRun, iKeyword, m_chunk.counts.size() );
+            run->hasTexture = hasTexture;
+            run->hasNormal = hasNormal;
+        }
+
+        m_chunk.vIndices.insert( m_chunk.vIndices.end(), m_v.begin(),
+                                 m_v.end() );
+        if ( hasTexture )
+        {
+            m_chunk.vtIndices.insert( m_chunk.vtIndices.end(), m_vt.begin(),
+                                      m_vt.end() );
+        }
+        if ( hasNormal )
+        {
+            m_chunk.vnIndices.insert( m_chunk.vnIndices.end(), m_vn.begin(),
+                                      m_vn.end() );
+        }
+    }
+    else
+    {
+        // lines, points and faces that mix their kinds of indices go
+        // through ParseReader with every index, -1 included
+        run = &singleRun( kElementLine, iKeyword, m_chunk.counts.size() );
+        run->hasTexture = true;
+        run->hasNormal = true;
+        m_chunk.vIndices.insert( m_chunk.vIndices.end(), m_v.begin(),
+                                 m_v.end() );
+        m_chunk.vtIndices.insert( m_chunk.vtIndices.end(), m_vt.begin(),
+                                  m_vt.end() );
+        m_chunk.vnIndices.insert( m_chunk.vnIndices.end(), m_vn.begin(),
+                                  m_vn.end() );
+    }
+
+    m_chunk.counts.push_back( ( index_t )count );
+    m_chunk.elementLines.push_back( m_chunk.numLines );
+    run->end = m_chunk.counts.size();
+    return true;
+}
+
+//-*****************************************************************************
+// A name is the rest of the line, whitespace included, up to the first
+// character that isn't ASCII.
+bool ChunkParser::parseName( const char *p, const char *e,
+                             const char *iKeyword, RunKind iKind )
+{
+    p = afterWord( p, e, iKeyword );
+    if ( !p )
+    {
+        return false;
+    }
+
+    p = skipSpace( p, e );
+    const char *nameE = p;
+    while ( nameE < e && !( *nameE & 0x80 ) ) { ++nameE; }
+    if ( nameE == p )
+    {
+        return false;
+    }
+
+    Run &run = singleRun( iKind, iKeyword, m_chunk.names.size() );
+    m_chunk.names.push_back( std::string( p, nameE ) );
+    run.end = m_chunk.names.size();
+    return true;
+}
+
+//-*****************************************************************************
+bool ChunkParser::parseBool( const char *p, const char *e,
+                             const char *iKeyword )
+{
+    p = afterWord( p, e, iKeyword );
+    if ( !p )
+    {
+        return false;
+    }
+
+    p = skipSpace( p, e );
+    bool b = false;
+    if ( !parseOnOff( p, e, b ) )
+    {
+        return false;
+    }
+
+    Run &run = singleRun( kBoolLine, iKeyword, m_chunk.ints.size() );
+    m_chunk.ints.push_back( b ? 1 : 0 );
+    run.end = m_chunk.ints.size();
+    return true;
+}
+
+//-*****************************************************************************
+bool ChunkParser::parseInt( const char *p, const char *e,
+                            const char *iKeyword )
+{
+    p = afterWord( p, e, iKeyword );
+    if ( !p )
+    {
+        return false;
+    }
+
+    p = skipSpace( p, e );
+    long long i = 0;
+    if ( !parseInteger( p, e, INT_MIN, INT_MAX, i ) )
+    {
+        return false;
+    }
+
+    Run &run = singleRun( kIntLine, iKeyword, m_chunk.ints.size() );
+    m_chunk.ints.push_back( ( int )i );
+    run.end = m_chunk.ints.size();
+    return true;
+}
+
+//-*****************************************************************************
+// Parses the chunks [iBegin, iEnd), from several threads at once.
+class ParseChunks
+{
+public:
+    ParseChunks( std::vector<Chunk> &ioChunks ) : m_chunks( ioChunks ) {}
+
+    void operator()( size_t iBegin, size_t iEnd )
+    {
+        for ( size_t i = iBegin; i < iEnd; ++i )
+        {
+            ChunkParser parser( m_chunks[i] );
+            parser.parse();
+        }
+    }
+
+private:
+    std::vector<Chunk> &m_chunks;
+};
+
+//-*****************************************************************************
+// Hands the parsed chunks to the reader in file order. Index checks need
+// to know how many vertices came before, so they happen here.
+class FastParseReader : public ParseReader
+{
+public:
+    FastParseReader( Reader &iReadInto ) : ParseReader( iReadInto ) {}
+
+    // throws, with oErrorLine set to the chunk line that failed
+    void hand( Chunk &iChunk, const Run &iRun, size_t &oErrorLine );
+
+private:
+    void handElements( Chunk &iChunk, const Run &iRun,
+                       size_t &oErrorLine );
+};
+
+//-*****************************************************************************
+void FastParseReader::hand( Chunk &iChunk, const Run &iRun,
+                            size_t &oErrorLine )
+{
+    oErrorLine = iRun.line;
+
+    switch ( iRun.kind )
+    {
+        case kVertexRun:
+            m_readInto.vertices( ( index_t )m_numV,
+                                 &iChunk.points[iRun.begin],
+                                 iRun.end - iRun.begin );
+            m_numV += iRun.end - iRun.begin;
+            break;
+
+        case kTextureRun:
+            m_readInto.textureVertices( ( index_t )m_numVt,
+                                        &iChunk.texPoints[iRun.begin],
+                                        iRun.end - iRun.begin );
+            m_numVt += iRun.end - iRun.begin;
+            break;
+
+        case kNormalRun:
+            m_readInto.normals( ( index_t )m_numVn,
+                                &iChunk.points[iRun.begin],
+                                iRun.end - iRun.begin );
+            m_numVn += iRun.end - iRun.begin;
+            break;
+
+        case kFaceRun:
+        case kElementLine:
+            handElements( iChunk, iRun, oErrorLine );
+            break;
+
+        case kValuesLine:
+        {
+            std::vector<double> vals( iChunk.values.begin() + iRun.begin,
+                                      iChunk.values.begin() + iRun.end );
+            if ( iRun.keyword == "v" ) { v( vals ); }
+            else if ( iRun.keyword == "vt" ) { vt( vals ); }
+            else if ( iRun.keyword == "vn" ) { vn( vals ); }
+            else { vp( vals ); }
+        }
+        break;
+
+        case kNamesLine:
+            g( std::vector<std::string>( iChunk.names.begin() + iRun.begin,
+                                         iChunk.names.begin() + iRun.end ) );
+            break;
+
+        case kNameLine:
+        {
+            const std::string &name = iChunk.names[iRun.begin];
+            if ( iRun.keyword == "o" ) { o( name ); }
+            else if ( iRun.keyword == "mtllib" ) { mtllib( name ); }
+            else if ( iRun.keyword == "maplib" ) { maplib( name ); }
+            else if ( iRun.keyword == "usemtl" ) { usemtl( name ); }
+            else if ( iRun.keyword == "usemap" ) { usemap( name ); }
+            else if ( iRun.keyword == "trace_obj" ) { trace_obj( name ); }
+            else { shadow_obj( name ); }
+        }
+        break;
+
+        case kBoolLine:
+        {
+            bool b = iChunk.ints[iRun.begin] != 0;
+            if ( iRun.keyword == "bevel" ) { bevel( b ); }
+            else if ( iRun.keyword == "cinterp" ) { cinterp( b ); }
+            else if ( iRun.keyword == "dinterp" ) { dinterp( b ); }
+            else { sB( b ); }
+        }
+        break;
+
+        case kIntLine:
+        {
+            int i = iChunk.ints[iRun.begin];
+            if ( iRun.keyword == "lod" ) { lod( i ); }
+            else { s( i ); }
+        }
+        break;
+    }
+}
+
+//-*****************************************************************************
+void FastParseReader::handElements( Chunk &iChunk, const Run &iRun,
+                                    size_t &oErrorLine )
+{
+    const index_t *counts = &iChunk.counts[iRun.begin];
+    size_t numElements = iRun.end - iRun.begin;
+
+    // the element lines go through ParseReader, which checks them
+    if ( iRun.kind == kElementLine )
+    {
+        std::vector<V3idx> vals( counts[0] );
+        for ( size_t i = 0; i < vals.size(); ++i )
+        {
+            vals[i].x = iChunk.vIndices[iRun.indexBegin + i];
+            vals[i].y = iRun.hasTexture ?
+                iChunk.vtIndices[iRun.textureBegin + i] : -1;
+            vals[i].z = iRun.hasNormal ?
+                iChunk.vnIndices[iRun.normalBegin + i] : -1;
+        }
+
+        if ( iRun.keyword == "f" ) { f( vals ); }
+        else if ( iRun.keyword == "l" ) { l( vals ); }
+        else { p( vals ); }
+        return;
+    }
+
+    const index_t *vIndices = &iChunk.vIndices[iRun.indexBegin];
+    const index_t *vtIndices = iRun.hasTexture ?
+        &iChunk.vtIndices[iRun.textureBegin] : NULL;
+    const index_t *vnIndices = iRun.hasNormal ?
+        &iChunk.vnIndices[iRun.normalBegin] : NULL;
+
+    size_t start = 0;
+    for ( size_t i = 0; i < numElements; ++i )
+    {
+        size_t end = start + ( size_t )counts[i];
+        for ( size_t j = start; j < end; ++j )
+        {
+            std::stringstream sstr;
+            if ( vIndices[j] < 1 || vIndices[j] >= ( index_t )m_numV )
+            {
+                sstr << "Invalid vertex index: " << vIndices[j]
+                     << ", must be 0 < v < " << m_numV;
+            }
+            else if ( vtIndices && ( vtIndices[j] < 1 ||
+                      vtIndices[j] >= ( index_t )m_numVt ) )
+            {
+                sstr << "Invalid texture vertex index: " << vtIndices[j]
+                     << ", must be 0 < vt < " << m_numVt;
+            }
+            else if ( vnIndices && ( vnIndices[j] < 1 ||
+                      vnIndices[j] >= ( index_t )m_numVn ) )
+            {
+                sstr << "Invalid normal vertex index: " << vnIndices[j]
+                     << ", must be 0 < vn < " << m_numVn;
+            }
+            else
+            {
+                continue;
+            }
+
+            // hand over the faces before the bad one, as ParseOBJ would
+            if ( i > 0 )
+            {
+                m_readInto.faces( counts, i, vIndices, vtIndices,
+                                  vnIndices );
+            }
+
+            oErrorLine = iChunk.elementLines[iRun.begin + i];
+            throw std::runtime_error( sstr.str() );
+        }
+        start = end;
+    }
+
+    m_readInto.faces( counts, numElements, vIndices, vtIndices, vnIndices );
+}
+
+//-*****************************************************************************
+// The text of a line of the chunk, as ParseOBJ prints it.
+std::string lineText( const Chunk &iChunk, size_t iLine )
+{
+    size_t line = 0;
+    const char *p = iChunk.begin;
+    while ( p < iChunk.end )
+    {
+        const char *eol = ( const char * )memchr( p, '\n',
+                                                  iChunk.end - p );
+        const char *e = eol ? eol : iChunk.end;
+        if ( e != p && ++line == iLine )
+        {
+            return std::string( p, e );
+        }
+        p = eol ? eol + 1 : iChunk.end;
+    }
+    return std::string();
+}
+
+//-*****************************************************************************
+void reportError( ParseReader &iReader, const std::string &iName,
+                  const Chunk &iChunk, size_t iChunkLine, size_t iLine,
+                  const std::string &iReason )
+{
+    std::stringstream sstr;
+    sstr << "ERROR: OBJ stream \"" << iName
+         << "\": " << std::endl
+         << "LINE: " << iLine << std::endl
+         << "---> " << lineText( iChunk, iChunkLine ) << std::endl
+         << "REASON: " << iReason << std::endl;
+
+    iReader.error( iName, sstr.str(), iLine );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void ParseOBJFast( Reader &iReadInto,
+                   const std::string &iFileName,
+                   size_t iNumThreads )
+{
+    FastParseReader reader( iReadInto );
+    reader.start( iFileName );
+
+    MappedFile file( iFileName );
+    if ( !file.valid() )
+    {
+        std::stringstream sstr;
+        sstr << "ERROR: OBJ stream \"" << iFileName
+             << "\": " << std::endl
+             << "Couldn't open file: " << iFileName << std::endl;
+        reader.error( iFileName, sstr.str(), 0 );
+        return;
+    }
+
+    if ( iNumThreads == 0 )
+    {
+        iNumThreads = Alembic::Util::thread::hardware_concurrency();
+    }
+
+    // Split the file into chunks, moving each boundary past the end of
+    // the line it falls in, so that every line belongs to one chunk.
+    const char *data = file.data();
+    size_t size = file.size();
+
+    // like ParseOBJ, a last line without a newline isn't read
+    while ( size > 0 && data[size - 1] != '\n' ) { --size; }
+
+    size_t numChunks = std::max<size_t>( 1, std::min(
+        iNumThreads * kChunksPerThread, size / kMinChunkBytes ) );
+
+    std::vector<Chunk> chunks( numChunks );
+    const char *begin = data;
+    for ( size_t i = 0; i < numChunks; ++i )
+    {
+        const char *end = data + size;
+        if ( i + 1 < numChunks )
+        {
+            end = std::max( begin, data + size / numChunks * ( i + 1 ) );
+            const char *eol = ( const char * )memchr( end, '\n',
+                                                      data + size - end );
+            end = eol ? eol + 1 : data + size;
+        }
+
+        chunks[i].begin = begin;
+        chunks[i].end = end;
+        begin = end;
+    }
+
+    ParseChunks parse( chunks );
+    Alembic::Util::parallel_for( numChunks, 1, parse, iNumThreads );
+
+    size_t lineOffset = 0;
+    for ( size_t i = 0; i < numChunks; ++i )
+    {
+        Chunk &chunk = chunks[i];
+        for ( size_t r = 0; r < chunk.runs.size(); ++r )
+        {
+            size_t errorLine = 0;
+            try
+            {
+                reader.hand( chunk, chunk.runs[r], errorLine );
+            }
+            catch ( std::exception &exc )
+            {
+                reportError( reader, iFileName, chunk, errorLine,
+                             lineOffset + errorLine, exc.what() );
+                return;
+            }
+        }
+
+        if ( chunk.failed )
+        {
+            reportError( reader, iFileName, chunk, chunk.errorLine,
+                         lineOffset + chunk.errorLine, chunk.error );
+            return;
+        }
+
+        lineOffset += chunk.numLines;
+
+        // let go of what has been handed over
+        std::vector<Run>().swap( chunk.runs );
+        std::vector<V3d>().swap( chunk.points );
+        std::vector<V2d>().swap( chunk.texPoints );
+        std::vector<index_t>().swap( chunk.counts );
+        std::vector<index_t>().swap( chunk.vIndices );
+        std::vector<index_t>().swap( chunk.vtIndices );
+        std::vector<index_t>().swap( chunk.vnIndices );
+        std::vector<size_t>().swap( chunk.elementLines );
+    }
+
+    // ParseOBJ counts from 1
+    reader.finish( iFileName, lineOffset + 1 );
+}
+
+} // End namespace WFObjConvert
+} // End namespace AbcClients
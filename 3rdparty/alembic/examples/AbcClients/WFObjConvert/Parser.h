@@ -49,6 +49,19 @@ ParseOBJ( Reader &iReadInto,
 ABC_WFOBJ_CONVERT_EXPORT void 
 ParseOBJ( Reader &iReadInto,
           const std::string &iFileName );
+
+//-*****************************************************************************
+// Parses a whole file much faster than ParseOBJ. The file is memory mapped
+// and split at line boundaries into chunks that are parsed on iNumThreads
+// threads (0 means one per core). The results are then handed to iReadInto
+// in file order, with runs of vertices, texture vertices, normals and faces
+// going through the batched Reader functions. Apart from the batching, and
+// numbers being rounded correctly, the reader sees what ParseOBJ would give
+// it, including the same error messages and line numbers.
+ABC_WFOBJ_CONVERT_EXPORT void
+ParseOBJFast( Reader &iReadInto,
+              const std::string &iFileName,
+              size_t iNumThreads = 0 );
     
 
 } // End namespace AbcClients
@@ -46,5 +46,70 @@ void Reader::v( index_t iIndex, const V3d &iPt, double iW )
     else { this->v( iIndex, iPt ); }
 }
 
+//-*****************************************************************************
+void Reader::vertices( index_t iFirstIndex, const V3d *iVals,
+                       size_t iNumVals )
+{
+    for ( size_t i = 0; i < iNumVals; ++i )
+    {
+        this->v( iFirstIndex + ( index_t )i, iVals[i] );
+    }
+}
+
+//-*****************************************************************************
+void Reader::textureVertices( index_t iFirstIndex, const V2d *iVals,
+                              size_t iNumVals )
+{
+    for ( size_t i = 0; i < iNumVals; ++i )
+    {
+        this->vt( iFirstIndex + ( index_t )i, iVals[i] );
+    }
+}
+
+//-*****************************************************************************
+void Reader::normals( index_t iFirstIndex, const V3d *iVals,
+                      size_t iNumVals )
+{
+    for ( size_t i = 0; i < iNumVals; ++i )
+    {
+        this->vn( iFirstIndex + ( index_t )i, iVals[i] );
+    }
+}
+
+//-*****************************************************************************
+void Reader::faces( const index_t *iFaceCounts, size_t iNumFaces,
+                    const index_t *iVertexIndices,
+                    const index_t *iTextureIndices,
+                    const index_t *iNormalIndices )
+{
+    IndexVec vIndices;
+    IndexVec vtIndices;
+    IndexVec vnIndices;
+
+    size_t start = 0;
+    for ( size_t i = 0; i < iNumFaces; ++i )
+    {
+        size_t end = start + ( size_t )iFaceCounts[i];
+
+        vIndices.assign( iVertexIndices + start, iVertexIndices + end );
+
+        vtIndices.clear();
+        if ( iTextureIndices )
+        {
+            vtIndices.assign( iTextureIndices + start,
+                              iTextureIndices + end );
+        }
+
+        vnIndices.clear();
+        if ( iNormalIndices )
+        {
+            vnIndices.assign( iNormalIndices + start, iNormalIndices + end );
+        }
+
+        this->f( vIndices, vtIndices, vnIndices );
+        start = end;
+    }
+}
+
 } // End namespace WFObjConvert
 } // End namespace AbcClients
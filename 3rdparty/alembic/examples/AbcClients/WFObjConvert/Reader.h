@@ -172,6 +172,39 @@ public:
                     const IndexVec &iTextureIndices,
                     const IndexVec &iNormalIndices ) {}
 
+    //-*************************************************************************
+    //! BATCHED DECLARATION
+    //! ParseOBJFast hands runs of consecutive 3-dimensional "v",
+    //! 2-dimensional "vt", "vn" and "f" lines to these functions as arrays,
+    //! in file order with respect to every other call. The default behavior
+    //! is to call the functions above once per element, so a reader only
+    //! needs to override these to avoid the per-element calls.
+    //-*************************************************************************
+
+    //! Set iNumVals three-dimensional vertices, starting at iFirstIndex.
+    //! ...
+    virtual void vertices( index_t iFirstIndex, const V3d *iVals,
+                           size_t iNumVals );
+
+    //! Set iNumVals 2-dimensional texture vertices, starting at iFirstIndex.
+    //! ...
+    virtual void textureVertices( index_t iFirstIndex, const V2d *iVals,
+                                  size_t iNumVals );
+
+    //! Set iNumVals normals, starting at iFirstIndex.
+    //! ...
+    virtual void normals( index_t iFirstIndex, const V3d *iVals,
+                          size_t iNumVals );
+
+    //! Declare iNumFaces faces. iFaceCounts holds the number of vertices
+    //! of each face and iVertexIndices their indices, one face after
+    //! another. iTextureIndices and iNormalIndices are laid out the same
+    //! way, or are NULL if those indices were unspecified for every face.
+    virtual void faces( const index_t *iFaceCounts, size_t iNumFaces,
+                        const index_t *iVertexIndices,
+                        const index_t *iTextureIndices,
+                        const index_t *iNormalIndices );
+
     //-*************************************************************************
     //! GROUPS AND OBJECT DECLARATION
     //! OBJ files have the ability to assign objects to groups, multiple
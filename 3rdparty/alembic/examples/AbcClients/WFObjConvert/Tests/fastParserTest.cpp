@@ -0,0 +1,523 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <AbcClients/WFObjConvert/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <math.h>
+#include <stdio.h>
+
+namespace OBJ = AbcClients::WFObjConvert;
+
+//-*****************************************************************************
+// One call made on the reader, with everything it was passed.
+struct Call
+{
+    std::string func;
+    OBJ::index_t index;
+    std::vector<double> vals;
+    OBJ::Reader::IndexVec v;
+    OBJ::Reader::IndexVec vt;
+    OBJ::Reader::IndexVec vn;
+    OBJ::Reader::StringVec names;
+    int i;
+};
+
+//-*****************************************************************************
+// Records every call, the batched calls of ParseOBJFast are left to the
+// base class which turns them into the per-element calls ParseOBJ makes.
+class RecordReader : public OBJ::Reader
+{
+public:
+    RecordReader() : errorLine( 0 ), numLines( 0 ), ended( false ) {}
+
+    virtual void parsingError( const std::string &iStreamName,
+                               const std::string &iErrorDesc,
+                               size_t iErrorLine )
+    {
+        error = iErrorDesc;
+        errorLine = iErrorLine;
+    }
+
+    virtual void parsingEnd( const std::string &iStreamName,
+                             size_t iNumLines )
+    {
+        numLines = iNumLines;
+        ended = true;
+    }
+
+    virtual void v( OBJ::index_t iIndex, const OBJ::V3d &iVal )
+    { add( "v", iIndex, iVal.x, iVal.y, iVal.z ); }
+
+    virtual void v( OBJ::index_t iIndex, const OBJ::V3d &iVal, double iW )
+    { add( "v4", iIndex, iVal.x, iVal.y, iVal.z, iW ); }
+
+    virtual void vt( OBJ::index_t iIndex, double iVal )
+    { add( "vt1", iIndex, iVal ); }
+
+    virtual void vt( OBJ::index_t iIndex, const OBJ::V2d &iVal )
+    { add( "vt", iIndex, iVal.x, iVal.y ); }
+
+    virtual void vt( OBJ::index_t iIndex, const OBJ::V3d &iVal )
+    { add( "vt3", iIndex, iVal.x, iVal.y, iVal.z ); }
+
+    virtual void vn( OBJ::index_t iIndex, const OBJ::V3d &iVal )
+    { add( "vn", iIndex, iVal.x, iVal.y, iVal.z ); }
+
+    virtual void vp( OBJ::index_t iIndex, double iVal )
+    { add( "vp1", iIndex, iVal ); }
+
+    virtual void vp( OBJ::index_t iIndex, const OBJ::V2d &iVal )
+    { add( "vp", iIndex, iVal.x, iVal.y ); }
+
+    virtual void f( const IndexVec &iV, const IndexVec &iVt,
+                    const IndexVec &iVn )
+    { addElement( "f", iV, iVt, iVn ); }
+
+    virtual void l( const IndexVec &iV, const IndexVec &iVt,
+                    const IndexVec &iVn )
+    { addElement( "l", iV, iVt, iVn ); }
+
+    virtual void p( const IndexVec &iV, const IndexVec &iVt,
+                    const IndexVec &iVn )
+    { addElement( "p", iV, iVt, iVn ); }
+
+    virtual void newGroup( const std::string &iName )
+    { addNames( "newGroup", StringVec( 1, iName ) ); }
+
+    virtual void activeGroups( const StringVec &iNames )
+    { addNames( "activeGroups", iNames ); }
+
+    virtual void activeObject( const std::string &iName )
+    { addNames( "activeObject", StringVec( 1, iName ) ); }
+
+    virtual void smoothingGroup( int iGroup ) { addInt( "s", iGroup ); }
+    virtual void bevel( bool iVal ) { addInt( "bevel", iVal ); }
+    virtual void cinterp( bool iVal ) { addInt( "cinterp", iVal ); }
+    virtual void dinterp( bool iVal ) { addInt( "dinterp", iVal ); }
+    virtual void lod( int iVal ) { addInt( "lod", iVal ); }
+
+    virtual void mtllib( const std::string &iName )
+    { addNames( "mtllib", StringVec( 1, iName ) ); }
+
+    virtual void usemtl( const std::string &iName )
+    { addNames( "usemtl", StringVec( 1, iName ) ); }
+
+    std::vector<Call> calls;
+    std::string error;
+    size_t errorLine;
+    size_t numLines;
+    bool ended;
+
+private:
+    Call &add( const char *iFunc )
+    {
+        calls.push_back( Call() );
+        calls.back().func = iFunc;
+        calls.back().index = 0;
+        calls.back().i = 0;
+        return calls.back();
+    }
+
+    void add( const char *iFunc, OBJ::index_t iIndex, double iA,
+              double iB = 0.0, double iC = 0.0, double iD = 0.0 )
+    {
+        Call &call = add( iFunc );
+        call.index = iIndex;
+        double vals[] = { iA, iB, iC, iD };
+        call.vals.assign( vals, vals + 4 );
+    }
+
+    void addElement( const char *iFunc, const IndexVec &iV,
+                     const IndexVec &iVt, const IndexVec &iVn )
+    {
+        Call &call = add( iFunc );
+        call.v = iV;
+        call.vt = iVt;
+        call.vn = iVn;
+    }
+
+    void addNames( const char *iFunc, const StringVec &iNames )
+    {
+        add( iFunc ).names = iNames;
+    }
+
+    void addInt( const char *iFunc, int iVal )
+    {
+        add( iFunc ).i = iVal;
+    }
+};
+
+//-*****************************************************************************
+// ParseOBJFast reads numbers with strtod, which rounds correctly, while
+// Spirit's double_ can be off in the last bit or so.
+bool sameValues( const std::vector<double> &iA, const std::vector<double> &iB )
+{
+    if ( iA.size() != iB.size() )
+    {
+        return false;
+    }
+
+    for ( size_t i = 0; i < iA.size(); ++i )
+    {
+        double a = iA[i];
+        double b = iB[i];
+        double tolerance = 4.0 * std::numeric_limits<double>::epsilon() *
+            std::max( fabs( a ), fabs( b ) );
+        if ( !( a == b || ( a != a && b != b ) ||
+                fabs( a - b ) <= tolerance ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//-*****************************************************************************
+// Parses iContents with both parsers and checks that the readers saw the
+// very same calls, errors and line counts.
+void compareParsers( const std::string &iContents, size_t iNumThreads = 4 )
+{
+    const std::string fileName = "fastParserTest.obj";
+    {
+        std::ofstream file( fileName.c_str(), std::ios::binary );
+        file << iContents;
+    }
+
+    RecordReader slow;
+    OBJ::ParseOBJ( slow, fileName );
+
+    RecordReader fast;
+    OBJ::ParseOBJFast( fast, fileName, iNumThreads );
+
+    remove( fileName.c_str() );
+
+    TESTING_MESSAGE_ASSERT( slow.error == fast.error,
+                            "\nParseOBJ:\n" << slow.error <<
+                            "ParseOBJFast:\n" << fast.error );
+    TESTING_ASSERT( slow.errorLine == fast.errorLine );
+    TESTING_ASSERT( slow.ended == fast.ended );
+    TESTING_ASSERT( slow.numLines == fast.numLines );
+    TESTING_ASSERT( slow.calls.size() == fast.calls.size() );
+
+    for ( size_t i = 0; i < slow.calls.size(); ++i )
+    {
+        const Call &a = slow.calls[i];
+        const Call &b = fast.calls[i];
+        TESTING_MESSAGE_ASSERT( a.func == b.func, "call " << i << ": " <<
+                                a.func << " vs " << b.func );
+        TESTING_MESSAGE_ASSERT( a.index == b.index, "call " << i );
+        TESTING_MESSAGE_ASSERT( sameValues( a.vals, b.vals ), "call " << i );
+        TESTING_MESSAGE_ASSERT( a.v == b.v, "call " << i );
+        TESTING_MESSAGE_ASSERT( a.vt == b.vt, "call " << i );
+        TESTING_MESSAGE_ASSERT( a.vn == b.vn, "call " << i );
+        TESTING_MESSAGE_ASSERT( a.names == b.names, "call " << i );
+        TESTING_MESSAGE_ASSERT( a.i == b.i, "call " << i );
+    }
+}
+
+//-*****************************************************************************
+// Ends every line that isn't empty with "\r\n". ParseOBJ reads a line of
+// just "\r" as a syntax error, so the empty ones are left alone.
+std::string withCRLF( const std::string &iContents )
+{
+    std::string result;
+    for ( size_t i = 0; i < iContents.size(); ++i )
+    {
+        if ( iContents[i] == '\n' && i > 0 && iContents[i - 1] != '\n' )
+        {
+            result += '\r';
+        }
+        result += iContents[i];
+    }
+    return result;
+}
+
+//-*****************************************************************************
+// A cube with a bit of everything, in the forms the batched runs are
+// broken up by.
+const char *kCube =
+    "# a cube\n"
+    "mtllib cube.mtl\n"
+    "o cube\n"
+    "v 0 0 0\n"
+    "v 1 0 0\n"
+    "v 1 1 0\n"
+    "v 0 1 0\n"
+    "v 0 0 1 1.0\n"
+    "v 1.5e-3 0 1\n"
+    "v   1 1 1\n"
+    "v\t0 1 -1.25\n"
+    "vt 0 0\n"
+    "vt 1 0\n"
+    "vt 1 1\n"
+    "vt 0.5\n"
+    "vt 0 1 0\n"
+    "vn 0 0 -1\n"
+    "vn 0 0 1\n"
+    "vp 0.5 0.5\n"
+    "g front back\n"
+    "usemtl red\n"
+    "s 1\n"
+    "f 1 2 3 4\n"
+    "f 5/1/ 6/2/ 7/3/ 8/4/\n"
+    "f 1//1 2//1 3//1\n"
+    "f 5/1/2 6/2/2 7/3/2\n"
+    "g back\n"
+    "s off\n"
+    "f 1 2 3\n"
+    "l 1 2 3\n"
+    "p 4 5\n"
+    "bevel on\n"
+    "cinterp off\n"
+    "dinterp on\n"
+    "lod 2\n";
+
+//-*****************************************************************************
+void cubeTest()
+{
+    compareParsers( kCube );
+    compareParsers( kCube, 1 );
+}
+
+//-*****************************************************************************
+void crlfTest()
+{
+    compareParsers( withCRLF( kCube ) );
+}
+
+//-*****************************************************************************
+// Neither parser resolves relative indices. A texture or normal index of -1
+// reads as a missing one, any other index below 1 is an error.
+void negativeIndexTest()
+{
+    const std::string head =
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 1 1 0\n"
+        "vt 0 0\n"
+        "vn 0 0 1\n"
+        "f 1 2 3\n";
+
+    const char *faces[] = {
+        "f -3 -2 -1\n",
+        "f 1/-1/ 2/-1/ 3/-1/\n",
+        "f 1//-1 2//-1 3//-1\n",
+        "f 1/-1/-1 2/-1/-1 3/-1/-1\n",
+        "f 1/-2/ 2/-2/ 3/-2/\n",
+        "f 1//-2 2//-2 3//-2\n",
+        "f 1/1/-1 2/1/1 3/1/1\n",
+        "f 1/-1/1 2/1/1 3/1/1\n",
+        "l 1/-1/ -2/1/\n",
+        "p -1\n",
+        NULL
+    };
+
+    for ( size_t i = 0; faces[i]; ++i )
+    {
+        compareParsers( head + faces[i] + "f 1 2 3\n" );
+    }
+}
+
+//-*****************************************************************************
+void missingTextureNormalTest()
+{
+    // no texture vertices or normals at all
+    compareParsers(
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 1 1 0\n"
+        "f 1 2 3\n"
+        "l 1 2\n"
+        "p 1\n" );
+
+    // normals without texture vertices, then texture vertices alone
+    compareParsers(
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 1 1 0\n"
+        "vn 0 0 1\n"
+        "f 1//1 2//1 3//1\n"
+        "vt 0 0\n"
+        "f 1/1 2/1 3/1\n"
+        "f 1/1/ 2/1/ 3/1/\n" );
+}
+
+//-*****************************************************************************
+void malformedTest()
+{
+    const std::string head =
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 1 1 0\n"
+        "vt 0 0\n"
+        "f 1 2 3\n";
+
+    // broken lines, and lines the grammar reads in surprising ways
+    const char *bad[] = {
+        "v 1 2 x\n",
+        "v 1 2\n",
+        "v 1 2 3 4 5\n",
+        "vt\n",
+        "vn 1 2\n",
+        "f 1 2\n",
+        "f 1 2 4\n",
+        "f 0 1 2\n",
+        "f -4 1 2\n",
+        "f 1/1 2 3\n",
+        "f 1/2 2/1 3/1\n",
+        "f 1//1 2//1 3//1\n",
+        "f 1/1 2/1 3/1\n",
+        "f 1// 2// 3//\n",
+        "f 1 2 3x\n",
+        "f 1 2 3/1\n",
+        "f1 2 3\n",
+        "l 1\n",
+        "p\n",
+        " \n",
+        "\r\n",
+        "o\n",
+        "o \n",
+        "lod x\n",
+        "s 99999999999\n",
+        "f 1 2 99999999999999999999\n",
+        "v 1 2 3 # comment\n",
+        "v 0x10 2 3\n",
+        "v nan(1) 2 3\n",
+        "v 1e 2 3\n",
+        "v 1-2 3\n",
+        "vt0.5 0.5\n",
+        "g\n",
+        "s maybe\n",
+        "bogus line\n",
+        NULL
+    };
+
+    for ( size_t i = 0; bad[i]; ++i )
+    {
+        // the error is followed by lines that must not be read
+        compareParsers( head + bad[i] + "v 2 2 2\nf 1 2 3\n" );
+        compareParsers( withCRLF( head + bad[i] + "v 2 2 2\n" ) );
+    }
+}
+
+//-*****************************************************************************
+void lastLineTest()
+{
+    compareParsers( "" );
+    compareParsers( "\n\n" );
+    compareParsers( "v 0 0 0" );
+
+    // the last line is only read when it ends in a newline
+    compareParsers( "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3" );
+    compareParsers( "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3\n" );
+}
+
+//-*****************************************************************************
+// Big enough to be split into several chunks, with lines of every length
+// and kind so that the chunk boundaries land in the middle of them.
+std::string bigFile( size_t iNumLoops )
+{
+    std::stringstream sstr;
+    sstr.precision( 17 );
+    size_t numV = 0;
+    for ( size_t i = 0; i < iNumLoops; ++i )
+    {
+        double x = 0.1 * ( double )i;
+        sstr << "v " << x << " " << -x << " " << x * 1e-7 << "\n";
+        sstr << "v " << i << " 0 1\n";
+        sstr << "v 1 " << i << " 0\n";
+        sstr << "v 0 1 " << i << "\n";
+        sstr << "vt " << x << " " << 1.0 / ( 1.0 + x ) << "\n";
+        sstr << "vn 0 0 " << ( i % 2 ? "1" : "-1" ) << "\n";
+        numV += 4;
+
+        switch ( i % 5 )
+        {
+            case 0:
+                sstr << "f " << numV - 3 << " " << numV - 2 << " "
+                     << numV - 1 << " " << numV << "\n";
+                break;
+            case 1:
+                sstr << "f -1/-1/-1 -2/-1/-1 -3/-1/-1\n";
+                break;
+            case 2:
+                sstr << "# comment " << i << "\n\n"
+                     << "f " << numV << "//1 1//1 2//1\n";
+                break;
+            case 3:
+                sstr << "g group" << i % 7 << "\n"
+                     << "f 1/1 2/2 -1/-1\n";
+                break;
+            case 4:
+                sstr << "s " << i % 3 << "\n"
+                     << "f 1 2 3\n"
+                     << "f 4 5 6\n";
+                break;
+        }
+    }
+    return sstr.str();
+}
+
+//-*****************************************************************************
+void chunkBoundaryTest()
+{
+    std::string big = bigFile( 30000 );
+    compareParsers( big );
+    compareParsers( withCRLF( big ), 3 );
+
+    // an error well past the first chunk
+    compareParsers( big + "f 1 2\n" + big );
+    compareParsers( big + "f 1 2 999999999\n" );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    cubeTest();
+    crlfTest();
+    negativeIndexTest();
+    missingTextureNormalTest();
+    malformedTest();
+    lastLineTest();
+    chunkBoundaryTest();
+    return 0;
+}
@@ -75,22 +75,33 @@ public:
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
-    if ( argc != 3 )
+    bool fast = ( argc == 4 && std::string( argv[1] ) == "-fast" );
+    if ( argc != 3 && !fast )
     {
-        std::cerr << "USAGE: " << argv[0] << " <objFile> <abcFile>"
+        std::cerr << "USAGE: " << argv[0] << " [-fast] <objFile> <abcFile>"
                   << std::endl;
         return -1;
     }
 
+    const char *objFile = argv[argc - 2];
+    const char *abcFile = argv[argc - 1];
+
     try
     {
         Abc::OArchive archive( Alembic::AbcCoreHDF5::WriteArchive(),
-                               argv[2] );
+                               abcFile );
         Abc::OObject topObj( archive, Abc::kTop );
 
         MyReader reader( topObj );
-        
-        OBJ::ParseOBJ( reader, argv[1] );
+
+        if ( fast )
+        {
+            OBJ::ParseOBJFast( reader, objFile );
+        }
+        else
+        {
+            OBJ::ParseOBJ( reader, objFile );
+        }
     }
     catch ( std::exception &exc )
     {
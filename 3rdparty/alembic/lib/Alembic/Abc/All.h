@@ -43,6 +43,7 @@
 #include <Alembic/Abc/Foundation.h>
 
 #include <Alembic/Abc/ArchiveInfo.h>
+#include <Alembic/Abc/ArchiveVerify.h>
 #include <Alembic/Abc/Argument.h>
 #include <Alembic/Abc/IArchive.h>
 #include <Alembic/Abc/IArrayProperty.h>
@@ -61,6 +62,7 @@
 #include <Alembic/Abc/OBaseProperty.h>
 #include <Alembic/Abc/OCompoundProperty.h>
 #include <Alembic/Abc/OObject.h>
+#include <Alembic/Abc/ObjectCopy.h>
 #include <Alembic/Abc/OScalarProperty.h>
 #include <Alembic/Abc/OSchema.h>
 #include <Alembic/Abc/OSchemaObject.h>
@@ -0,0 +1,329 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/Abc/ArchiveVerify.h>
+#include <Alembic/Abc/IObject.h>
+#include <Alembic/Util/Thread.h>
+
+#include <algorithm>
+#include <map>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+struct ArrayProp
+{
+    std::string objectPath;
+    std::string propertyPath;
+    AbcA::ArrayPropertyReaderPtr reader;
+};
+
+//-*****************************************************************************
+// a sample of a property that refers to a block
+struct BlockRef
+{
+    size_t prop;
+    index_t sample;
+};
+
+//-*****************************************************************************
+// one stored sample, identified by its key
+struct Block
+{
+    Block() : numBytes( 0 ), corrupt( false ) {}
+
+    Util::uint64_t numBytes;
+    std::vector< BlockRef > refs;
+    bool corrupt;
+    std::string message;
+};
+
+//-*****************************************************************************
+// A block is only shared within the file it is stored in, the layers of a
+// layered archive may each hold their own copy of the same sample.
+typedef std::pair< const AbcA::ArchiveReader *, Util::Digest > BlockId;
+
+//-*****************************************************************************
+// Finds every array property and, through the stored keys (which are cheap
+// to read), the distinct blocks their samples refer to.
+class BlockCollector
+{
+public:
+    BlockCollector( std::vector< ArrayProp > & oProps,
+                    std::vector< Block > & oBlocks,
+                    VerifyStats & oStats )
+      : m_props( oProps )
+      , m_blocks( oBlocks )
+      , m_stats( oStats ) {}
+
+    void walkObject( AbcA::ObjectReaderPtr iObject )
+    {
+        walkCompound( iObject->getFullName(), "", iObject->getProperties() );
+
+        for ( size_t i = 0; i < iObject->getNumChildren(); ++i )
+        {
+            walkObject( iObject->getChild( i ) );
+        }
+    }
+
+private:
+    void walkCompound( const std::string & iObjectPath,
+                       const std::string & iPrefix,
+                       AbcA::CompoundPropertyReaderPtr iCompound )
+    {
+        for ( size_t i = 0; i < iCompound->getNumProperties(); ++i )
+        {
+            const AbcA::PropertyHeader & header =
+                iCompound->getPropertyHeader( i );
+            std::string path = iPrefix + header.getName();
+
+            if ( header.isCompound() )
+            {
+                walkCompound( iObjectPath, path + "/",
+                              iCompound->getCompoundProperty( i ) );
+            }
+            else if ( header.isArray() )
+            {
+                ArrayProp prop;
+                prop.objectPath = iObjectPath;
+                prop.propertyPath = path;
+                prop.reader = iCompound->getArrayProperty( i );
+                m_props.push_back( prop );
+                addSamples( m_props.size() - 1 );
+            }
+        }
+    }
+
+    void addSamples( size_t iProp )
+    {
+        AbcA::ArrayPropertyReaderPtr reader = m_props[iProp].reader;
+        size_t numSamples = reader->getNumSamples();
+
+        // the file the samples are stored in, layered archives hand out
+        // the properties of the layer they come from
+        const AbcA::ArchiveReader * archive =
+            reader->getObject()->getArchive().get();
+
+        m_stats.numArrayProperties ++;
+        m_stats.numSamples += numSamples;
+
+        // repeated samples are stored once, so they go to the same block
+        // as the previous sample without looking it up again
+        AbcA::ArraySampleKey prevKey;
+        size_t prevBlock = 0;
+        bool hasPrev = false;
+        for ( size_t i = 0; i < numSamples; ++i )
+        {
+            AbcA::ArraySampleKey key;
+
+            // nothing is stored for empty samples, so nothing to check
+            if ( !reader->getKey( i, key ) || key.numBytes == 0 )
+            {
+                hasPrev = false;
+                continue;
+            }
+
+            BlockRef ref;
+            ref.prop = iProp;
+            ref.sample = i;
+
+            if ( !hasPrev || !( key.digest == prevKey.digest ) )
+            {
+                BlockId id( archive, key.digest );
+                std::map< BlockId, size_t >::iterator it =
+                    m_blockIndex.find( id );
+                if ( it == m_blockIndex.end() )
+                {
+                    prevBlock = m_blocks.size();
+                    m_blockIndex[id] = prevBlock;
+                    m_blocks.push_back( Block() );
+                    m_blocks.back().numBytes = key.numBytes;
+                }
+                else
+                {
+                    prevBlock = it->second;
+                }
+
+                prevKey = key;
+                hasPrev = true;
+            }
+
+            m_blocks[prevBlock].refs.push_back( ref );
+        }
+    }
+
+    std::vector< ArrayProp > & m_props;
+    std::vector< Block > & m_blocks;
+    VerifyStats & m_stats;
+    std::map< BlockId, size_t > m_blockIndex;
+};
+
+//-*****************************************************************************
+// Reads and hashes the blocks, every thread pulls the next block from a
+// shared counter since blocks vary a lot in size.  Blocks were found in
+// file order, more or less, so the reads stay close to sequential.
+class BlockVerifier
+{
+public:
+    BlockVerifier( std::vector< ArrayProp > & iProps,
+                   std::vector< Block > & ioBlocks )
+      : m_props( iProps )
+      , m_blocks( ioBlocks )
+      , m_next( 0 ) {}
+
+    void operator()( size_t, size_t )
+    {
+        for ( ;; )
+        {
+            size_t index = 0;
+            {
+                Util::scoped_lock l( m_lock );
+                if ( m_next >= m_blocks.size() )
+                {
+                    return;
+                }
+                index = m_next ++;
+            }
+
+            verify( m_blocks[index] );
+        }
+    }
+
+private:
+    void verify( Block & ioBlock )
+    {
+        const BlockRef & ref = ioBlock.refs.front();
+        AbcA::ArrayPropertyReaderPtr reader = m_props[ref.prop].reader;
+
+        try
+        {
+            AbcA::ArraySampleKey stored;
+            reader->getKey( ref.sample, stored );
+
+            AbcA::ArraySamplePtr samp;
+            reader->getSample( ref.sample, samp );
+
+            if ( samp->getKey().digest != stored.digest )
+            {
+                ioBlock.corrupt = true;
+                ioBlock.message = "digest mismatch";
+            }
+        }
+        catch ( std::exception & e )
+        {
+            ioBlock.corrupt = true;
+            ioBlock.message = e.what();
+        }
+    }
+
+    std::vector< ArrayProp > & m_props;
+    std::vector< Block > & m_blocks;
+    Util::mutex m_lock;
+    size_t m_next;
+};
+
+//-*****************************************************************************
+bool errorLess( const VerifyError & iA, const VerifyError & iB )
+{
+    if ( iA.objectPath != iB.objectPath )
+    {
+        return iA.objectPath < iB.objectPath;
+    }
+
+    if ( iA.propertyPath != iB.propertyPath )
+    {
+        return iA.propertyPath < iB.propertyPath;
+    }
+
+    return iA.sampleIndex < iB.sampleIndex;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+bool VerifyArchive( IArchive iArchive, VerifyStats & oStats,
+                    size_t iNumThreads )
+{
+    oStats = VerifyStats();
+
+    std::vector< ArrayProp > props;
+    std::vector< Block > blocks;
+
+    BlockCollector collector( props, blocks, oStats );
+    collector.walkObject( iArchive.getTop().getPtr() );
+
+    size_t numThreads = iNumThreads > 0 ? iNumThreads :
+        Util::thread::hardware_concurrency();
+    numThreads = std::max( std::min( numThreads, blocks.size() ),
+                           ( size_t ) 1 );
+
+    BlockVerifier verifier( props, blocks );
+    Util::parallel_for( numThreads, 1, verifier, numThreads );
+
+    for ( std::vector< Block >::iterator it = blocks.begin();
+          it != blocks.end(); ++it )
+    {
+        oStats.numBlocks ++;
+        oStats.numBytes += it->numBytes;
+
+        if ( !it->corrupt )
+        {
+            continue;
+        }
+
+        for ( std::vector< BlockRef >::iterator r = it->refs.begin();
+              r != it->refs.end(); ++r )
+        {
+            VerifyError error;
+            error.objectPath = props[r->prop].objectPath;
+            error.propertyPath = props[r->prop].propertyPath;
+            error.sampleIndex = r->sample;
+            error.message = it->message;
+            oStats.errors.push_back( error );
+        }
+    }
+
+    std::sort( oStats.errors.begin(), oStats.errors.end(), errorLess );
+
+    return oStats.errors.empty();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,121 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_Abc_ArchiveVerify_h
+#define Alembic_Abc_ArchiveVerify_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/IArchive.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! One array sample whose data no longer matches the key stored with it.
+struct VerifyError
+{
+    VerifyError() : sampleIndex( 0 ) {}
+
+    //! Full name of the object, e.g. /root/geo/shape
+    std::string objectPath;
+
+    //! Name of the property below the object's top compound property, with
+    //! the enclosing compound properties separated by /, e.g. .geom/P
+    std::string propertyPath;
+
+    index_t sampleIndex;
+
+    //! What was wrong, either a digest mismatch or the error that was
+    //! thrown while the sample was read.
+    std::string message;
+};
+
+//-*****************************************************************************
+//! Counters and errors filled in by VerifyArchive.
+struct VerifyStats
+{
+    VerifyStats()
+      : numArrayProperties( 0 )
+      , numSamples( 0 )
+      , numBlocks( 0 )
+      , numBytes( 0 ) {}
+
+    //! Number of array properties that were found.
+    size_t numArrayProperties;
+
+    //! Number of array samples, over all of those properties.
+    size_t numSamples;
+
+    //! Number of distinct stored samples that were read and hashed.
+    size_t numBlocks;
+
+    //! Number of bytes of sample data that were hashed.
+    Util::uint64_t numBytes;
+
+    //! Every sample that refers to a corrupt block, sorted by object path,
+    //! property path and sample index.
+    std::vector< VerifyError > errors;
+};
+
+//-*****************************************************************************
+//! Reads every array sample of iArchive once, recomputes its digest and
+//! compares it with the key that was stored when the sample was written.
+//!
+//! Samples that share a key (repeated samples, and samples the archive
+//! deduplicated on write) are stored once and so are only read once, a
+//! corrupt one is reported for every sample that refers to it.  Scalar
+//! samples and the object and property headers carry no key and are not
+//! checked, beyond having to be readable for the walk to get anywhere.
+//!
+//! The stored samples are read on up to iNumThreads threads (0 means
+//! Alembic::Util::thread::hardware_concurrency()).  For Ogawa archives the
+//! archive should be opened with at least as many streams, ideally memory
+//! mapped, HDF5 reads are serialized by the library anyway.
+//!
+//! Returns true if no errors were found.
+ALEMBIC_EXPORT bool
+VerifyArchive( IArchive iArchive, VerifyStats & oStats,
+               size_t iNumThreads = 0 );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
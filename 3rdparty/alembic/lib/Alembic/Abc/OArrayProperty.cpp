@@ -88,6 +88,18 @@ void OArrayProperty::setFromPrevious()
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+bool OArrayProperty::copySample( IArrayProperty iProperty, index_t iIndex )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::copySample()" );
+
+    return m_property->copySample( iProperty.getPtr(), iIndex );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return false;
+}
+
 //-*****************************************************************************
 void OArrayProperty::setTimeSampling( uint32_t iIndex )
 {
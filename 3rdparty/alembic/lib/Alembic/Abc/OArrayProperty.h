@@ -42,6 +42,7 @@
 #include <Alembic/Abc/Argument.h>
 #include <Alembic/Abc/OBaseProperty.h>
 #include <Alembic/Abc/OCompoundProperty.h>
+#include <Alembic/Abc/IArrayProperty.h>
 
 namespace Alembic {
 namespace Abc {
@@ -115,6 +116,13 @@ public:
     //! ...
     void setFromPrevious( );
 
+    //! Set the next sample to sample iIndex of iProperty by copying it as
+    //! stored, without decoding or rehashing it.  This only works when
+    //! both archives use a core that supports it (Ogawa to Ogawa), and
+    //! returns false, having written nothing, when they don't.  The caller
+    //! should then get() the sample and set() it instead.
+    bool copySample( IArrayProperty iProperty, index_t iIndex );
+
     //! Changes the TimeSampling used by this property.
     //! If the TimeSampling is changed to Acyclic and the number of samples
     //! currently set is more than the number of times provided in the Acyclic
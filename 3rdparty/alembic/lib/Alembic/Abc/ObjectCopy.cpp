@@ -0,0 +1,263 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/Abc/ObjectCopy.h>
+#include <Alembic/Abc/IArrayProperty.h>
+#include <Alembic/Abc/IScalarProperty.h>
+#include <Alembic/Abc/OArrayProperty.h>
+#include <Alembic/Abc/OScalarProperty.h>
+#include <Alembic/Abc/OTypedScalarProperty.h>
+
+#include <map>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+struct SubtreeKey : public Alembic::Util::totally_ordered<SubtreeKey>
+{
+    Util::Digest properties;
+    Util::Digest children;
+    std::string metaData;
+
+    bool operator==( const SubtreeKey &iRhs ) const
+    {
+        return properties == iRhs.properties &&
+            children == iRhs.children && metaData == iRhs.metaData;
+    }
+
+    bool operator<( const SubtreeKey &iRhs ) const
+    {
+        if ( properties != iRhs.properties )
+        {
+            return properties < iRhs.properties;
+        }
+
+        if ( children != iRhs.children )
+        {
+            return children < iRhs.children;
+        }
+
+        return metaData < iRhs.metaData;
+    }
+};
+
+// subtree -> full name of the first copy of it, holding on to the writer
+// instead would keep every keyed subtree open until the copy is done
+typedef std::map< SubtreeKey, std::string > SubtreeMap;
+
+//-*****************************************************************************
+bool getSubtreeKey( IObject & iObject, SubtreeKey & oKey )
+{
+    // an object with nothing to share costs less to copy than to instance
+    if ( iObject.getNumChildren() == 0 &&
+         iObject.getProperties().getNumProperties() == 0 )
+    {
+        return false;
+    }
+
+    if ( !iObject.getPropertiesHash( oKey.properties ) ||
+         !iObject.getChildrenHash( oKey.children ) )
+    {
+        return false;
+    }
+
+    oKey.metaData = iObject.getMetaData().serialize();
+    return true;
+}
+
+//-*****************************************************************************
+size_t countObjects( IObject iObject )
+{
+    size_t count = 1;
+    for ( size_t i = 0; i < iObject.getNumChildren(); ++i )
+    {
+        count += countObjects( iObject.getChild( i ) );
+    }
+    return count;
+}
+
+//-*****************************************************************************
+// What OObject::addChildInstance writes, for a target whose writer may
+// already be gone.  Targets are only registered once they are complete,
+// so they are never an ancestor of iParent.
+void addInstance( OObject & iParent, const std::string & iTargetFullName,
+                  const std::string & iName )
+{
+    AbcA::MetaData md;
+    md.set( "isInstance", "1" );
+
+    OObject instanceChild( iParent, iName, md );
+    OStringProperty instanceProp( instanceChild.getProperties(),
+                                  ".instanceSource" );
+    instanceProp.set( iTargetFullName );
+}
+
+//-*****************************************************************************
+void copyObject( IObject & iIn, OObject & iOut, SubtreeMap * ioSubtrees,
+                 CopyStats & ioStats )
+{
+    CopyProperties( iIn.getProperties(), iOut.getProperties() );
+    ioStats.numObjects ++;
+
+    size_t numChildren = iIn.getNumChildren();
+    for ( size_t i = 0; i < numChildren; ++i )
+    {
+        IObject childIn( iIn.getChild( i ) );
+
+        SubtreeKey key;
+        bool hasKey = ioSubtrees && getSubtreeKey( childIn, key );
+
+        if ( hasKey )
+        {
+            SubtreeMap::iterator found = ioSubtrees->find( key );
+            if ( found != ioSubtrees->end() )
+            {
+                addInstance( iOut, found->second, childIn.getName() );
+                ioStats.numInstances ++;
+                ioStats.numInstancedObjects += countObjects( childIn );
+                continue;
+            }
+        }
+
+        OObject childOut( iOut, childIn.getName(), childIn.getMetaData() );
+        copyObject( childIn, childOut, ioSubtrees, ioStats );
+
+        // only register once the copy is complete, so nothing inside of
+        // it can ever be pointed back at it
+        if ( hasKey )
+        {
+            ioSubtrees->insert( std::make_pair( key,
+                                                childOut.getFullName() ) );
+        }
+    }
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void CopyProperties( ICompoundProperty iIn, OCompoundProperty iOut )
+{
+    size_t numChildren = iIn.getNumProperties();
+    for ( size_t i = 0; i < numChildren; ++i )
+    {
+        const AbcA::PropertyHeader & header = iIn.getPropertyHeader( i );
+        if ( header.isArray() )
+        {
+            IArrayProperty inProp( iIn, header.getName() );
+            OArrayProperty outProp( iOut, header.getName(),
+                header.getDataType(), header.getMetaData(),
+                header.getTimeSampling() );
+
+            size_t numSamples = inProp.getNumSamples();
+            for ( size_t j = 0; j < numSamples; ++j )
+            {
+                // straight copy of the stored data when the cores allow it
+                if ( outProp.copySample( inProp, ( index_t ) j ) )
+                {
+                    continue;
+                }
+
+                AbcA::ArraySamplePtr samp;
+                inProp.get( samp, ISampleSelector( ( index_t ) j ) );
+                outProp.set( *samp );
+            }
+        }
+        else if ( header.isScalar() )
+        {
+            IScalarProperty inProp( iIn, header.getName() );
+            OScalarProperty outProp( iOut, header.getName(),
+                header.getDataType(), header.getMetaData(),
+                header.getTimeSampling() );
+
+            const AbcA::DataType & dataType = header.getDataType();
+            std::vector< std::string > strSamp;
+            std::vector< std::wstring > wstrSamp;
+            std::vector< Util::uint8_t > samp;
+            void * dst = NULL;
+
+            if ( dataType.getPod() == Util::kStringPOD )
+            {
+                strSamp.resize( dataType.getExtent() );
+                dst = &strSamp.front();
+            }
+            else if ( dataType.getPod() == Util::kWstringPOD )
+            {
+                wstrSamp.resize( dataType.getExtent() );
+                dst = &wstrSamp.front();
+            }
+            else
+            {
+                samp.resize( dataType.getNumBytes() );
+                dst = &samp.front();
+            }
+
+            size_t numSamples = inProp.getNumSamples();
+            for ( size_t j = 0; j < numSamples; ++j )
+            {
+                inProp.get( dst, ISampleSelector( ( index_t ) j ) );
+                outProp.set( dst );
+            }
+        }
+        else if ( header.isCompound() )
+        {
+            ICompoundProperty inProp( iIn, header.getName() );
+            OCompoundProperty outProp( iOut, header.getName(),
+                header.getMetaData() );
+            CopyProperties( inProp, outProp );
+        }
+    }
+}
+
+//-*****************************************************************************
+void CopyObject( IObject iIn, OObject iOut, bool iInstance,
+                 CopyStats * oStats )
+{
+    CopyStats stats;
+    SubtreeMap subtrees;
+    copyObject( iIn, iOut, iInstance ? &subtrees : NULL, stats );
+
+    if ( oStats )
+    {
+        *oStats = stats;
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
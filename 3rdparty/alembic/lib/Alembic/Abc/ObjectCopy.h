@@ -0,0 +1,101 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_Abc_ObjectCopy_h
+#define Alembic_Abc_ObjectCopy_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/ICompoundProperty.h>
+#include <Alembic/Abc/IObject.h>
+#include <Alembic/Abc/OCompoundProperty.h>
+#include <Alembic/Abc/OObject.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Counters filled in by CopyObject.
+struct CopyStats
+{
+    CopyStats()
+      : numObjects( 0 )
+      , numInstances( 0 )
+      , numInstancedObjects( 0 ) {}
+
+    //! Number of objects written out with their own properties.
+    size_t numObjects;
+
+    //! Number of instance references written in place of a copy.
+    size_t numInstances;
+
+    //! Number of source objects (whole subtrees) that were replaced by
+    //! instance references and therefore not written.
+    size_t numInstancedObjects;
+};
+
+//-*****************************************************************************
+//! Copies every property and every sample of iIn into iOut, recursing into
+//! compound properties.  Array samples are copied without being decoded
+//! when both archives are Ogawa.
+ALEMBIC_EXPORT void
+CopyProperties( ICompoundProperty iIn, OCompoundProperty iOut );
+
+//-*****************************************************************************
+//! Copies the properties of iIn onto iOut, and then recreates the children of
+//! iIn (recursively) underneath iOut.
+//!
+//! If iInstance is true, every child subtree is keyed by its properties
+//! hash, its children hash and its MetaData, as reported by
+//! IObject::getPropertiesHash and IObject::getChildrenHash.  The first
+//! occurrence of a key is copied, every later occurrence becomes an
+//! instance reference (OObject::addChildInstance) to that first copy, so
+//! identical hierarchies are only stored once.  The names of the instanced
+//! roots themselves are not part of the key.  Objects whose archive does not
+//! store hashes (HDF5) and subtrees without any properties or children are
+//! always copied.
+ALEMBIC_EXPORT void
+CopyObject( IObject iIn, OObject iOut, bool iInstance = false,
+            CopyStats * oStats = NULL );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
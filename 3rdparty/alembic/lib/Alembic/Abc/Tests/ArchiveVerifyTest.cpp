@@ -0,0 +1,207 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+namespace AbcF = Alembic::AbcCoreFactory;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject a( archive.getTop(), "a" );
+    OObject b( a, "b" );
+    OObject c( archive.getTop(), "c" );
+
+    // easy to find in the file
+    std::vector< float > marker( 100, 1234.5f );
+    std::vector< float > other( 50, 3.0f );
+
+    OCompoundProperty geom( b.getProperties(), ".geom" );
+    OFloatArrayProperty bP( geom, "P" );
+    bP.set( other );
+    bP.set( marker );
+    bP.set( marker );
+    bP.set( other );
+
+    // the same sample, stored once
+    OFloatArrayProperty cP( c.getProperties(), "P" );
+    cP.set( marker );
+
+    std::vector< std::string > strs;
+    strs.push_back( "one" );
+    strs.push_back( "" );
+    strs.push_back( "three" );
+    OStringArrayProperty names( c.getProperties(), "names" );
+    names.set( strs );
+    names.set( StringArraySample( NULL, 0 ) );
+
+    std::vector< std::wstring > wstrs;
+    wstrs.push_back( L"w" );
+    wstrs.push_back( L"wide" );
+    OWstringArrayProperty wnames( c.getProperties(), "wnames" );
+    wnames.set( wstrs );
+
+    OInt32Property count( c.getProperties(), "count" );
+    count.set( 3 );
+}
+
+//-*****************************************************************************
+// flips a bit in the middle of the marker sample
+void corruptArchive( const std::string & iName )
+{
+    std::vector< char > buf;
+    {
+        std::ifstream in( iName.c_str(), std::ios::binary );
+        buf.assign( std::istreambuf_iterator< char >( in ),
+                    std::istreambuf_iterator< char >() );
+    }
+
+    float value = 1234.5f;
+    std::vector< char > pattern( 4 * sizeof( float ) );
+    for ( size_t i = 0; i < 4; ++i )
+    {
+        memcpy( &pattern[i * sizeof( float )], &value, sizeof( float ) );
+    }
+
+    std::vector< char >::iterator it = std::search( buf.begin(), buf.end(),
+        pattern.begin(), pattern.end() );
+    TESTING_ASSERT( it != buf.end() );
+    it[ 40 * sizeof( float ) + 1 ] ^= 0x10;
+
+    std::ofstream out( iName.c_str(), std::ios::binary | std::ios::trunc );
+    out.write( &buf.front(), buf.size() );
+}
+
+//-*****************************************************************************
+void verifyTest( size_t iNumThreads )
+{
+    writeArchive( "archiveVerify.abc" );
+
+    AbcF::IFactory factory;
+    factory.setOgawaNumStreams( iNumThreads );
+    factory.setOgawaReadStrategy( AbcF::IFactory::kMemoryMappedFiles );
+
+    VerifyStats stats;
+    {
+        IArchive archive = factory.getArchive( "archiveVerify.abc" );
+        TESTING_ASSERT( VerifyArchive( archive, stats, iNumThreads ) );
+    }
+
+    TESTING_ASSERT( stats.numArrayProperties == 4 );
+    TESTING_ASSERT( stats.numSamples == 8 );
+
+    // other, marker, the strings and the wide strings
+    TESTING_ASSERT( stats.numBlocks == 4 );
+    TESTING_ASSERT( stats.errors.empty() );
+
+    corruptArchive( "archiveVerify.abc" );
+
+    {
+        IArchive archive = factory.getArchive( "archiveVerify.abc" );
+        TESTING_ASSERT( !VerifyArchive( archive, stats, iNumThreads ) );
+    }
+
+    // the marker is read once but every sample using it is listed
+    TESTING_ASSERT( stats.numBlocks == 4 );
+    TESTING_ASSERT( stats.errors.size() == 3 );
+    TESTING_ASSERT( stats.errors[0].objectPath == "/a/b" );
+    TESTING_ASSERT( stats.errors[0].propertyPath == ".geom/P" );
+    TESTING_ASSERT( stats.errors[0].sampleIndex == 1 );
+    TESTING_ASSERT( stats.errors[0].message == "digest mismatch" );
+    TESTING_ASSERT( stats.errors[1].objectPath == "/a/b" );
+    TESTING_ASSERT( stats.errors[1].propertyPath == ".geom/P" );
+    TESTING_ASSERT( stats.errors[1].sampleIndex == 2 );
+    TESTING_ASSERT( stats.errors[1].message == "digest mismatch" );
+    TESTING_ASSERT( stats.errors[2].objectPath == "/c" );
+    TESTING_ASSERT( stats.errors[2].propertyPath == "P" );
+    TESTING_ASSERT( stats.errors[2].sampleIndex == 0 );
+}
+
+//-*****************************************************************************
+void writeLayer( const std::string & iName, const std::string & iObject )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject obj( archive.getTop(), iObject );
+    OFloatArrayProperty p( obj.getProperties(), "P" );
+    p.set( std::vector< float >( 100, 1234.5f ) );
+}
+
+//-*****************************************************************************
+void layeredTest()
+{
+    // the same sample is stored in both layers, only the second is corrupt
+    writeLayer( "archiveVerifyLayer0.abc", "x" );
+    writeLayer( "archiveVerifyLayer1.abc", "y" );
+    corruptArchive( "archiveVerifyLayer1.abc" );
+
+    std::vector< std::string > layers;
+    layers.push_back( "archiveVerifyLayer0.abc" );
+    layers.push_back( "archiveVerifyLayer1.abc" );
+
+    AbcF::IFactory factory;
+    VerifyStats stats;
+    {
+        IArchive archive = factory.getArchive( layers );
+        TESTING_ASSERT( !VerifyArchive( archive, stats, 1 ) );
+    }
+
+    // one block per layer
+    TESTING_ASSERT( stats.numBlocks == 2 );
+    TESTING_ASSERT( stats.errors.size() == 1 );
+    TESTING_ASSERT( stats.errors[0].objectPath == "/y" );
+    TESTING_ASSERT( stats.errors[0].propertyPath == "P" );
+    TESTING_ASSERT( stats.errors[0].sampleIndex == 0 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    verifyTest( 1 );
+    verifyTest( 4 );
+    layeredTest();
+    return 0;
+}
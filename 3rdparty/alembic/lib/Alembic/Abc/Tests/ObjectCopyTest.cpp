@@ -0,0 +1,272 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <sstream>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+namespace AbcF = Alembic::AbcCoreFactory;
+
+//-*****************************************************************************
+void writeTree( OObject & iParent, const std::string & iName, float iScale )
+{
+    OObject tree( iParent, iName );
+    OObject trunk( tree, "trunk" );
+    OObject leaves( tree, "leaves" );
+
+    std::vector< float > vals;
+    for ( size_t i = 0; i < 30; ++i )
+    {
+        vals.push_back( iScale * i );
+    }
+
+    OFloatArrayProperty trunkProp( trunk.getProperties(), "P" );
+    trunkProp.set( vals );
+
+    OFloatArrayProperty leavesProp( leaves.getProperties(), "P" );
+    leavesProp.set( vals );
+    vals.push_back( iScale );
+    leavesProp.set( vals );
+
+    OStringProperty nameProp( tree.getProperties(), "species" );
+    nameProp.set( "oak" );
+}
+
+//-*****************************************************************************
+void writeForest( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject top = archive.getTop();
+    OObject forest( top, "forest" );
+
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        std::ostringstream strm;
+        strm << "tree" << i;
+        writeTree( forest, strm.str(), i == 5 ? 2.0f : 1.0f );
+    }
+
+    // a lone trunk elsewhere that matches the trunk inside the trees
+    OObject lone( top, "lone" );
+    OObject trunk( lone, "trunk" );
+    std::vector< float > vals;
+    for ( size_t i = 0; i < 30; ++i )
+    {
+        vals.push_back( ( float ) i );
+    }
+    OFloatArrayProperty trunkProp( trunk.getProperties(), "P" );
+    trunkProp.set( vals );
+
+    // empty objects are never instanced
+    OObject empty0( top, "empty0" );
+    OObject empty1( top, "empty1" );
+}
+
+//-*****************************************************************************
+void copyArchive( const std::string & iIn, const std::string & iOut,
+                  bool iInstance, CopyStats & oStats )
+{
+    AbcF::IFactory factory;
+    IArchive in = factory.getArchive( iIn );
+    OArchive out( Alembic::AbcCoreOgawa::WriteArchive(), iOut );
+    CopyObject( in.getTop(), out.getTop(), iInstance, &oStats );
+}
+
+//-*****************************************************************************
+void checkTree( IObject iTree, float iScale )
+{
+    TESTING_ASSERT( iTree.getNumChildren() == 2 );
+
+    IStringProperty nameProp( iTree.getProperties(), "species" );
+    TESTING_ASSERT( nameProp.getValue() == "oak" );
+
+    IFloatArrayProperty trunkProp( iTree.getChild( "trunk" ).getProperties(),
+                                   "P" );
+    TESTING_ASSERT( trunkProp.getNumSamples() == 1 );
+    TESTING_ASSERT( ( *trunkProp.getValue() )[7] == 7.0f * iScale );
+
+    IFloatArrayProperty leavesProp(
+        iTree.getChild( "leaves" ).getProperties(), "P" );
+    TESTING_ASSERT( leavesProp.getNumSamples() == 2 );
+    FloatArraySamplePtr samp = leavesProp.getValue( ISampleSelector(
+        ( index_t ) 1 ) );
+    TESTING_ASSERT( samp->size() == 31 );
+    TESTING_ASSERT( ( *samp )[30] == iScale );
+}
+
+//-*****************************************************************************
+void instanceTest()
+{
+    writeForest( "objectCopyIn.abc" );
+
+    CopyStats stats;
+    copyArchive( "objectCopyIn.abc", "objectCopyFlat.abc", false, stats );
+
+    // top, forest, 10 * 3 tree objects, lone, trunk, 2 empties
+    TESTING_ASSERT( stats.numObjects == 36 );
+    TESTING_ASSERT( stats.numInstances == 0 );
+    TESTING_ASSERT( stats.numInstancedObjects == 0 );
+
+    copyArchive( "objectCopyIn.abc", "objectCopyInst.abc", true, stats );
+
+    // tree0 and tree5 are copied, 8 trees are instanced along with the
+    // lone trunk which points at /forest/tree0/trunk
+    TESTING_ASSERT( stats.numInstances == 9 );
+    TESTING_ASSERT( stats.numInstancedObjects == 8 * 3 + 1 );
+    TESTING_ASSERT( stats.numObjects == 36 - stats.numInstancedObjects );
+
+    AbcF::IFactory factory;
+    IArchive archive = factory.getArchive( "objectCopyInst.abc" );
+    IObject forest = archive.getTop().getChild( "forest" );
+    TESTING_ASSERT( forest.getNumChildren() == 10 );
+
+    for ( size_t i = 0; i < 10; ++i )
+    {
+        IObject tree = forest.getChild( i );
+        bool instanced = ( i != 0 && i != 5 );
+        TESTING_ASSERT( forest.isChildInstance( i ) == instanced );
+        if ( instanced )
+        {
+            TESTING_ASSERT( tree.instanceSourcePath() == "/forest/tree0" );
+        }
+
+        checkTree( tree, i == 5 ? 2.0f : 1.0f );
+    }
+
+    IObject lone = archive.getTop().getChild( "lone" );
+    TESTING_ASSERT( lone.isChildInstance( "trunk" ) );
+    TESTING_ASSERT( lone.getChild( "trunk" ).instanceSourcePath() ==
+                    "/forest/tree0/trunk" );
+
+    TESTING_ASSERT( !archive.getTop().isChildInstance( "empty0" ) );
+    TESTING_ASSERT( !archive.getTop().isChildInstance( "empty1" ) );
+
+    // copying the instanced archive again expands and re-instances it
+    copyArchive( "objectCopyInst.abc", "objectCopyInst2.abc", true, stats );
+    TESTING_ASSERT( stats.numInstances == 9 );
+    TESTING_ASSERT( stats.numInstancedObjects == 8 * 3 + 1 );
+}
+
+//-*****************************************************************************
+void storedCopyTest()
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "objectCopyStored.abc" );
+        OObject obj( archive.getTop(), "obj" );
+
+        std::vector< float > a( 20, 1.0f );
+        std::vector< float > b( 7, 2.0f );
+        OFloatArrayProperty floats( obj.getProperties(), "floats" );
+        floats.set( a );
+        floats.set( a );
+        floats.set( b );
+        floats.set( FloatArraySample( NULL, 0 ) );
+        floats.set( a );
+
+        std::vector< std::string > strs;
+        strs.push_back( "one" );
+        strs.push_back( "" );
+        strs.push_back( "three" );
+        OStringArrayProperty strings( obj.getProperties(), "strings" );
+        strings.set( strs );
+        strs.push_back( "four" );
+        strings.set( strs );
+
+    }
+
+    CopyStats stats;
+    copyArchive( "objectCopyStored.abc", "objectCopyStored2.abc", false, stats );
+
+    AbcF::IFactory factory;
+    IArchive src = factory.getArchive( "objectCopyStored.abc" );
+    IArchive dst = factory.getArchive( "objectCopyStored2.abc" );
+    IObject srcObj = src.getTop().getChild( "obj" );
+    IObject dstObj = dst.getTop().getChild( "obj" );
+
+    // the stored keys were copied, so the hashes come out the same
+    Alembic::Util::Digest srcHash, dstHash;
+    TESTING_ASSERT( srcObj.getPropertiesHash( srcHash ) );
+    TESTING_ASSERT( dstObj.getPropertiesHash( dstHash ) );
+    TESTING_ASSERT( srcHash == dstHash );
+
+    IFloatArrayProperty floats( dstObj.getProperties(), "floats" );
+    TESTING_ASSERT( floats.getNumSamples() == 5 );
+    TESTING_ASSERT( floats.getValue( 0 )->size() == 20 );
+    TESTING_ASSERT( floats.getValue( 2 )->size() == 7 );
+    TESTING_ASSERT( ( *floats.getValue( 2 ) )[6] == 2.0f );
+    TESTING_ASSERT( floats.getValue( 3 )->size() == 0 );
+    TESTING_ASSERT( floats.getValue( 4 )->size() == 20 );
+
+    IStringArrayProperty strings( dstObj.getProperties(), "strings" );
+    TESTING_ASSERT( strings.getNumSamples() == 2 );
+    TESTING_ASSERT( strings.getValue( 0 )->size() == 3 );
+    TESTING_ASSERT( ( *strings.getValue( 0 ) )[1] == "" );
+    TESTING_ASSERT( ( *strings.getValue( 1 ) )[3] == "four" );
+
+    // an array property can be copied sample by sample too
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "objectCopyStored3.abc" );
+        OFloatArrayProperty out( archive.getTop().getProperties(), "floats" );
+        TESTING_ASSERT( out.copySample( floats, 2 ) );
+        TESTING_ASSERT( out.copySample( floats, 2 ) );
+        TESTING_ASSERT( out.getNumSamples() == 2 );
+
+        OInt32ArrayProperty wrongType( archive.getTop().getProperties(),
+                                       "wrongType" );
+        TESTING_ASSERT_THROW( wrongType.copySample( floats, 0 ),
+                              Alembic::Util::Exception );
+    }
+
+    IArchive third = factory.getArchive( "objectCopyStored3.abc" );
+    IFloatArrayProperty thirdFloats( third.getTop().getProperties(), "floats" );
+    TESTING_ASSERT( thirdFloats.isConstant() );
+    TESTING_ASSERT( thirdFloats.getValue( 1 )->size() == 7 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    instanceTest();
+    storedCopyTest();
+    return 0;
+}
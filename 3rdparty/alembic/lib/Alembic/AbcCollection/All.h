@@ -38,6 +38,7 @@
 #define Alembic_AbcCollection_All_h
 
 #include <Alembic/Util/Export.h>
+#include <Alembic/AbcCollection/CollectionsIndex.h>
 #include <Alembic/AbcCollection/ICollections.h>
 #include <Alembic/AbcCollection/OCollections.h>
 
@@ -0,0 +1,150 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcCollection/CollectionsIndex.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcCollection {
+namespace ALEMBIC_VERSION_NS {
+
+size_t CollectionsIndex::addCollection( const std::string & iName,
+                                        const Abc::StringArraySample & iPaths )
+{
+    Util::uint32_t collection = ( Util::uint32_t ) m_names.size();
+    m_names.push_back( iName );
+    m_nameIndices.insert( std::make_pair( iName, ( size_t ) collection ) );
+    m_members.push_back( std::vector< Util::uint32_t >() );
+    std::vector< Util::uint32_t > & members = m_members.back();
+
+    size_t numPaths = iPaths.size();
+    members.reserve( numPaths );
+
+    for ( size_t i = 0; i < numPaths; ++i )
+    {
+        std::pair< PathMap::iterator, bool > found = m_paths.insert(
+            std::make_pair( iPaths[i], ( Util::uint32_t ) m_pathNames.size() ) );
+
+        Util::uint32_t id = found.first->second;
+        if ( found.second )
+        {
+            m_pathNames.push_back( &( found.first->first ) );
+            m_pathCollections.push_back( CollectionList() );
+        }
+
+        // collections are added in ascending order, so a repeated path
+        // within this collection is always at the back
+        CollectionList & collections = m_pathCollections[id];
+        if ( collections.empty() || collections.back() != collection )
+        {
+            collections.push_back( collection );
+            members.push_back( id );
+        }
+    }
+
+    return collection;
+}
+
+std::string CollectionsIndex::getCollectionName( size_t i ) const
+{
+    if ( i < m_names.size() )
+    {
+        return m_names[i];
+    }
+
+    return std::string();
+}
+
+bool CollectionsIndex::getCollectionIndex( const std::string & iName,
+                                           size_t & oIndex ) const
+{
+    NameMap::const_iterator it = m_nameIndices.find( iName );
+    if ( it == m_nameIndices.end() )
+    {
+        return false;
+    }
+
+    oIndex = it->second;
+    return true;
+}
+
+void CollectionsIndex::getCollectionPaths( size_t i,
+    std::vector< std::string > & oPaths ) const
+{
+    oPaths.clear();
+
+    if ( i >= m_members.size() )
+    {
+        return;
+    }
+
+    const std::vector< Util::uint32_t > & members = m_members[i];
+    oPaths.reserve( members.size() );
+    for ( size_t j = 0; j < members.size(); ++j )
+    {
+        oPaths.push_back( *m_pathNames[ members[j] ] );
+    }
+}
+
+bool CollectionsIndex::contains( size_t i, const std::string & iPath ) const
+{
+    const CollectionList & collections = getCollections( iPath );
+    return std::binary_search( collections.begin(), collections.end(),
+                               ( Util::uint32_t ) i );
+}
+
+bool CollectionsIndex::contains( const std::string & iName,
+                                 const std::string & iPath ) const
+{
+    size_t i = 0;
+    return getCollectionIndex( iName, i ) && contains( i, iPath );
+}
+
+const CollectionsIndex::CollectionList &
+CollectionsIndex::getCollections( const std::string & iPath ) const
+{
+    PathMap::const_iterator it = m_paths.find( iPath );
+    if ( it == m_paths.end() )
+    {
+        return m_empty;
+    }
+
+    return m_pathCollections[ it->second ];
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCollection
+} // End namespace Alembic
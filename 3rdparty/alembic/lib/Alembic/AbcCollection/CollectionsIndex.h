@@ -0,0 +1,127 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcCollection_CollectionsIndex_h
+#define Alembic_AbcCollection_CollectionsIndex_h
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/Util/Export.h>
+
+namespace Alembic {
+namespace AbcCollection {
+namespace ALEMBIC_VERSION_NS {
+
+//! A lookup structure over the collections of one sample of an
+//! ICollectionsSchema.  Every object path found in any collection is interned
+//! once, and each interned path knows which collections it belongs to, so
+//! both membership tests and object -> collections queries are a single
+//! hash lookup rather than a scan over the string arrays.  The index refers
+//! into its own path table, so it can't be copied and is shared through
+//! CollectionsIndexPtr instead.
+class ALEMBIC_EXPORT CollectionsIndex : public Alembic::Util::noncopyable
+{
+public:
+
+    typedef std::vector< Util::uint32_t > CollectionList;
+
+    //! Creates an empty index.
+    CollectionsIndex() {}
+
+    //! Adds a collection, and all of its paths, to the index.  Returns the
+    //! index of the newly added collection.
+    size_t addCollection( const std::string & iName,
+                          const Abc::StringArraySample & iPaths );
+
+    //! Returns the number of collections that were added.
+    size_t getNumCollections() const { return m_names.size(); }
+
+    //! Returns the name of collection i, or an empty string.
+    std::string getCollectionName( size_t i ) const;
+
+    //! Finds the collection called iName, returns false if there isn't one.
+    bool getCollectionIndex( const std::string & iName,
+                             size_t & oIndex ) const;
+
+    //! Returns the number of unique paths over all of the collections.
+    size_t getNumPaths() const { return m_paths.size(); }
+
+    //! Returns the unique (deduplicated) paths of collection i.
+    void getCollectionPaths( size_t i,
+                             std::vector< std::string > & oPaths ) const;
+
+    //! Returns whether iPath is a member of collection i.
+    bool contains( size_t i, const std::string & iPath ) const;
+
+    //! Returns whether iPath is a member of the collection called iName.
+    bool contains( const std::string & iName,
+                   const std::string & iPath ) const;
+
+    //! Returns the indices of the collections that iPath is a member of,
+    //! in ascending order.  The list is empty if iPath isn't in any of them.
+    const CollectionList & getCollections( const std::string & iPath ) const;
+
+private:
+
+    typedef Util::unordered_map< std::string, Util::uint32_t > PathMap;
+    typedef Util::unordered_map< std::string, size_t > NameMap;
+
+    // interned path -> id
+    PathMap m_paths;
+
+    // id -> interned path, the keys of m_paths
+    std::vector< const std::string * > m_pathNames;
+
+    // id -> collections it's a member of
+    std::vector< CollectionList > m_pathCollections;
+
+    // collection -> member ids
+    std::vector< std::vector< Util::uint32_t > > m_members;
+
+    std::vector< std::string > m_names;
+    NameMap m_nameIndices;
+
+    CollectionList m_empty;
+};
+
+typedef Util::shared_ptr< const CollectionsIndex > CollectionsIndexPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCollection
+} // End namespace Alembic
+
+#endif
@@ -40,6 +40,15 @@ namespace Alembic {
 namespace AbcCollection {
 namespace ALEMBIC_VERSION_NS {
 
+struct ICollectionsSchema::IndexCache
+{
+    Util::mutex lock;
+
+    // the sample index of every collection that index was built from
+    std::vector< Abc::index_t > sampleIndices;
+    CollectionsIndexPtr index;
+};
+
 void ICollectionsSchema::init( const Abc::Argument &iArg0,
                                const Abc::Argument &iArg1 )
 {
@@ -47,6 +56,7 @@ void ICollectionsSchema::init( const Abc::Argument &iArg0,
 
     AbcCoreAbstract::CompoundPropertyReaderPtr _this = this->getPtr();
     m_collections.clear();
+    m_indexCache.reset( new IndexCache() );
 
     size_t numProps = this->getNumProperties();
     for ( size_t i = 0; i < numProps; ++i )
@@ -110,6 +120,47 @@ std::string ICollectionsSchema::getCollectionName( size_t i )
     return std::string();
 }
 
+CollectionsIndexPtr
+ICollectionsSchema::getIndex( const Abc::ISampleSelector &iSS )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ICollectionsSchema::getIndex" );
+
+    if ( m_indexCache )
+    {
+        std::vector< Abc::index_t > sampleIndices( m_collections.size() );
+        for ( size_t i = 0; i < m_collections.size(); ++i )
+        {
+            sampleIndices[i] = iSS.getIndex(
+                m_collections[i].getTimeSampling(),
+                m_collections[i].getNumSamples() );
+        }
+
+        Util::scoped_lock l( m_indexCache->lock );
+        if ( m_indexCache->index &&
+             m_indexCache->sampleIndices == sampleIndices )
+        {
+            return m_indexCache->index;
+        }
+
+        Util::shared_ptr< CollectionsIndex > index( new CollectionsIndex() );
+        for ( size_t i = 0; i < m_collections.size(); ++i )
+        {
+            Abc::StringArraySamplePtr samp;
+            m_collections[i].get( samp,
+                Abc::ISampleSelector( sampleIndices[i] ) );
+            index->addCollection( m_collections[i].getName(), *samp );
+        }
+
+        m_indexCache->sampleIndices.swap( sampleIndices );
+        m_indexCache->index = index;
+        return m_indexCache->index;
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return CollectionsIndexPtr( new CollectionsIndex() );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCollection
 } // End namespace Alembic
@@ -40,6 +40,7 @@
 #include <Alembic/Abc/All.h>
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcCollection/SchemaInfoDeclarations.h>
+#include <Alembic/AbcCollection/CollectionsIndex.h>
 
 namespace Alembic {
 namespace AbcCollection {
@@ -101,6 +102,12 @@ public:
     //! Returns the name of a collection at a given index
     std::string getCollectionName( size_t i );
 
+    //! Returns a membership index over all of the collections at iSS.
+    //! The index is built on first use and shared until a query resolves
+    //! to a different sample of any of the collections.
+    CollectionsIndexPtr getIndex(
+        const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
     //! Returns whether this function set is valid.
     bool valid() const
     {
@@ -113,6 +120,9 @@ protected:
 
     std::vector< Abc::IStringArrayProperty > m_collections;
 
+    struct IndexCache;
+    Util::shared_ptr< IndexCache > m_indexCache;
+
 };
 
 //! Object declaration
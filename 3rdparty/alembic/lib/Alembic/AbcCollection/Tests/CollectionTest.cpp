@@ -118,10 +118,70 @@ void read()
     TESTING_ASSERT((*samp)[2] == "/a/b/c/3");
 }
 
+void readIndex()
+{
+    Abc::IArchive archive(Alembic::AbcCoreOgawa::ReadArchive(), "Collection.abc");
+    Abc::IObject test(archive.getTop(), "test");
+    AbcCol::ICollections group(test, "Group1");
+
+    AbcCol::CollectionsIndexPtr index = group.getSchema().getIndex();
+    TESTING_ASSERT(index->getNumCollections() == 2);
+
+    // asking again for the same samples shares the index
+    TESTING_ASSERT(group.getSchema().getIndex(0) == index);
+
+    size_t propIndex = 0;
+    size_t coolIndex = 0;
+    TESTING_ASSERT(index->getCollectionIndex("prop", propIndex));
+    TESTING_ASSERT(index->getCollectionIndex("cool", coolIndex));
+    TESTING_ASSERT(!index->getCollectionIndex("potato", coolIndex));
+    TESTING_ASSERT(index->getCollectionName(propIndex) == "prop");
+
+    TESTING_ASSERT(index->getNumPaths() == 5);
+    TESTING_ASSERT(index->contains("prop", "/a/b/c/2"));
+    TESTING_ASSERT(!index->contains("prop", "/foo"));
+    TESTING_ASSERT(index->contains(coolIndex, "/foo"));
+    TESTING_ASSERT(!index->contains("nope", "/foo"));
+    TESTING_ASSERT(index->getCollections("/bar").size() == 1);
+    TESTING_ASSERT(index->getCollections("/bar")[0] == coolIndex);
+    TESTING_ASSERT(index->getCollections("/nothing").empty());
+
+    // the second sample of cool only holds potato
+    AbcCol::CollectionsIndexPtr index1 = group.getSchema().getIndex(1);
+    TESTING_ASSERT(index1 != index);
+    TESTING_ASSERT(index1->getNumPaths() == 4);
+    TESTING_ASSERT(index1->contains("cool", "potato"));
+    TESTING_ASSERT(!index1->contains("cool", "/foo"));
+    TESTING_ASSERT(index1->contains("prop", "/a/b/c/3"));
+
+    // repeated paths are only recorded once per collection
+    std::vector< std::string > strVec;
+    strVec.push_back("/a");
+    strVec.push_back("/b");
+    strVec.push_back("/a");
+    AbcCol::CollectionsIndex manual;
+    TESTING_ASSERT(manual.addCollection("x", Abc::StringArraySample(strVec)) ==
+        0);
+    strVec.push_back("/c");
+    TESTING_ASSERT(manual.addCollection("y", Abc::StringArraySample(strVec)) ==
+        1);
+
+    TESTING_ASSERT(manual.getNumPaths() == 3);
+    TESTING_ASSERT(manual.getCollections("/a").size() == 2);
+    TESTING_ASSERT(manual.getCollections("/c").size() == 1);
+    TESTING_ASSERT(manual.getCollections("/c")[0] == 1);
+
+    std::vector< std::string > paths;
+    manual.getCollectionPaths(1, paths);
+    TESTING_ASSERT(paths.size() == 3);
+    TESTING_ASSERT(paths[0] == "/a" && paths[1] == "/b" && paths[2] == "/c");
+}
+
 int main(int argc, char *argv[])
 {
     write();
     read();
+    readIndex();
     return 0;
 }
 
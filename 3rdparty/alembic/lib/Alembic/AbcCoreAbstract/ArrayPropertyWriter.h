@@ -79,6 +79,15 @@ public:
     //! An important feature!
     virtual void setFromPreviousSample() = 0;
 
+    //! Sets the next sample to sample iSampleIndex of iReader, copying it
+    //! as stored without decoding or rehashing it, when the implementation
+    //! knows how to read iReader's storage directly.
+    //! Returns false, without writing anything, when it doesn't, in which
+    //! case the sample has to be read and set with setSample instead.
+    //! The default implementation always returns false.
+    virtual bool copySample( ArrayPropertyReaderPtr iReader,
+                             index_t iSampleIndex );
+
     //! Return the number of samples that have been written so far.
     //! This changes as samples are written.
     virtual size_t getNumSamples() = 0;
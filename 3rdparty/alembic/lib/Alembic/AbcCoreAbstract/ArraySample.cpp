@@ -37,6 +37,8 @@
 #include <Alembic/AbcCoreAbstract/ArraySample.h>
 #include <Alembic/Util/Murmur3.h>
 
+#include <algorithm>
+
 namespace Alembic {
 namespace AbcCoreAbstract {
 namespace ALEMBIC_VERSION_NS {
@@ -77,53 +79,56 @@ ArraySample::Key ArraySample::getKey() const
 
     case kStringPOD:
     {
-        std::vector <int8_t> v;
+        // hashed as the characters of every string, each followed by a 0
+        // for the NULL seperator character, without gathering them first
+        const std::string * strs = static_cast<const std::string*>( m_data );
+        const int8_t nullChar = 0;
+
+        Murmur3Hash hash( sizeof(int8_t) );
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::string &str =
-                static_cast<const std::string*>( m_data )[j];
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            hash.Update( strs[j].data(), strs[j].length() );
+            hash.Update( &nullChar, 1 );
         }
-
-        int8_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int8_t), k.digest.words );
+        hash.Final( k.digest.words );
     }
     break;
 
     case kWstringPOD:
     {
-        std::vector <int32_t> v;
+        // hashed as int32 characters with a 0 after every string, but only
+        // the first (number of characters) bytes of that, which is what
+        // has always been stored with the sample
+        const std::wstring * wstrs =
+            static_cast<const std::wstring*>( m_data );
+
+        size_t toHash = 0;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::wstring &wstr =
-                static_cast<const std::wstring*>( m_data )[j];
+            toHash += wstrs[j].length() + 1;
+        }
 
+        Murmur3Hash hash( sizeof(int32_t) );
+        int32_t buf[256];
+        size_t numBuf = 0;
+        for ( size_t j = 0; j < numPods && toHash > 0; ++j )
+        {
+            const std::wstring &wstr = wstrs[j];
             size_t wlen = wstr.length();
-            for (size_t k = 0; k < wlen; ++k)
+            for ( size_t c = 0; c <= wlen && toHash > 0; ++c )
             {
-                v.push_back(wstr[k]);
+                buf[numBuf++] = c < wlen ? wstr[c] : 0;
+                if ( numBuf == 256 || numBuf * sizeof(int32_t) >= toHash )
+                {
+                    size_t numBytes = std::min( numBuf * sizeof(int32_t),
+                                                toHash );
+                    hash.Update( buf, numBytes );
+                    toHash -= numBytes;
+                    numBuf = 0;
+                }
             }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
         }
-
-        int32_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int32_t), k.digest.words );
+        hash.Final( k.digest.words );
     }
     break;
 
@@ -50,7 +50,9 @@ namespace ALEMBIC_VERSION_NS {
 IFactory::IFactory()
 {
     m_cacheHierarchy = true;
+    m_directRead = false;
     m_numStreams = 1;
+    m_poolMaxBytes = 0;
     m_readStrategy = kMemoryMappedFiles;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
 }
@@ -67,6 +69,7 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
     Alembic::AbcCoreOgawa::ReadArchive ogawa(
         m_numStreams,
         m_readStrategy == kMemoryMappedFiles);
+    ogawa.setSampleBufferPoolSize( m_poolMaxBytes );
     Alembic::Abc::IArchive archive( ogawa, iFileName,
         Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
 
@@ -78,7 +81,7 @@ Alembic::Abc::IArchive IFactory::getArchive( const std::string & iFileName,
     }
 
 #ifdef ALEMBIC_WITH_HDF5
-    Alembic::AbcCoreHDF5::ReadArchive hdf( m_cacheHierarchy );
+    Alembic::AbcCoreHDF5::ReadArchive hdf( m_cacheHierarchy, m_directRead );
     archive = Alembic::Abc::IArchive( hdf, iFileName,
         Alembic::Abc::ErrorHandler::kQuietNoopPolicy, m_cachePtr );
     if ( archive.valid() )
@@ -169,6 +172,7 @@ Alembic::Abc::IArchive IFactory::getArchive(
 {
     // Ogawa is the only one which can do this
     Alembic::AbcCoreOgawa::ReadArchive ogawa( iStreams );
+    ogawa.setSampleBufferPoolSize( m_poolMaxBytes );
     Alembic::Abc::IArchive archive( ogawa, "", m_policy, m_cachePtr );
     if ( archive.valid() )
     {
@@ -99,6 +99,17 @@ public:
     //! Gets whether an HDF5 file will use the cached hierarchy
     bool getHDF5CacheHierarchy() const { return m_cacheHierarchy; }
 
+    //! If opening an HDF5 file, sets whether the offsets of contiguous
+    //! datasets are indexed at open time so numeric array samples can be read
+    //! without going through HDF5, the default value is false
+    void setHDF5DirectRead( bool iDirectRead )
+    {
+        m_directRead = iDirectRead;
+    }
+
+    //! Gets whether an HDF5 file will be opened for direct reads
+    bool getHDF5DirectRead() const { return m_directRead; }
+
     //! Set the array sample cache, the HDF5 implementation optionally uses this
     void setSampleCache(
         Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCachePtr )
@@ -123,6 +134,18 @@ public:
         m_numStreams = iNumStreams;
     }
 
+    //! Gets the most bytes of released array sample buffers an Ogawa
+    //! archive keeps for reuse
+    size_t getOgawaSampleBufferPoolSize() const { return m_poolMaxBytes; }
+
+    //! Sets the most bytes of released array sample buffers an Ogawa archive
+    //! keeps for reuse instead of freeing, the default is 0 which turns the
+    //! pool off
+    void setOgawaSampleBufferPoolSize( size_t iMaxBytes )
+    {
+        m_poolMaxBytes = iMaxBytes;
+    }
+
     enum OgawaReadStrategy
     {
         kFileStreams,
@@ -151,7 +174,9 @@ public:
 
 private:
     bool m_cacheHierarchy;
+    bool m_directRead;
     size_t m_numStreams;
+    size_t m_poolMaxBytes;
     OgawaReadStrategy m_readStrategy;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
     Alembic::Abc::ErrorHandler::Policy m_policy;
@@ -51,6 +51,8 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
   : SimplePrImpl<AbcA::ArrayPropertyReader, AprImpl, AbcA::ArraySamplePtr&>
     ( iParent, iParentGroup, iHeader, iNumSamples, iFirstChangedIndex,
       iLastChangedIndex )
+  , m_parentRef( 0 )
+  , m_samplesRef( 0 )
 {
     if ( m_header->getPropertyType() != AbcA::kArrayProperty )
     {
@@ -59,6 +61,57 @@ AprImpl::AprImpl( AbcA::CompoundPropertyReaderPtr iParent,
     }
 
     m_isScalarLike = iIsScalarLike;
+
+    // strings always go through HDF5
+    PlainOldDataType pod = m_header->getDataType().getPod();
+    if ( pod == kStringPOD || pod == kWstringPOD )
+    {
+        return;
+    }
+
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader >(
+            this->getObject()->getArchive() );
+
+    if ( !archive || !archive->getDatasetIndex() )
+    {
+        return;
+    }
+
+    ReadLock lock;
+    if ( H5Rcreate( &m_parentRef, m_parentGroup.getObject(), ".",
+                    H5R_OBJECT, -1 ) >= 0 )
+    {
+        m_datasetIndex = archive->getDatasetIndex();
+    }
+}
+
+//-*****************************************************************************
+const DatasetIndex::Entry * AprImpl::findDirect( index_t iSampleIndex )
+{
+    if ( !m_datasetIndex )
+    {
+        return NULL;
+    }
+
+    hobj_ref_t groupRef = m_parentRef;
+    if ( iSampleIndex > 0 )
+    {
+        Alembic::Util::scoped_lock l( m_samplesRefMutex );
+
+        if ( m_samplesRef == 0 )
+        {
+            ReadLock lock;
+            checkSamplesIGroup();
+            H5Rcreate( &m_samplesRef, m_samplesIGroup.getObject(), ".",
+                       H5R_OBJECT, -1 );
+        }
+
+        groupRef = m_samplesRef;
+    }
+
+    return m_datasetIndex->find( groupRef,
+        getSampleName( m_header->getName(), iSampleIndex ) );
 }
 
 //-*****************************************************************************
@@ -78,6 +131,16 @@ void AprImpl::getDimensions( index_t iSampleIndex, Dimensions & oDim )
 {
     iSampleIndex = verifySampleIndex( iSampleIndex );
 
+    const DatasetIndex::Entry * entry = findDirect( iSampleIndex );
+    if ( entry && m_datasetIndex->getDimensions( *entry,
+                                                 m_header->getDataType(),
+                                                 oDim ) )
+    {
+        return;
+    }
+
+    ReadLock lock;
+
     std::string sampleName = getSampleName( m_header->getName(), iSampleIndex );
     H5Node parent;
 
@@ -114,6 +177,10 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
         curPod != kFloat16POD) || ( iPod == curPod ),
         "Cannot convert the data to or from a string, wstring or float16_t." );
 
+    iSampleIndex = verifySampleIndex( iSampleIndex );
+
+    ReadLock lock;
+
     hid_t nativeType = -1;
     bool clean = false;
 
@@ -123,8 +190,6 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
         nativeType = GetNativeH5T(dtype, clean);
     }
 
-    iSampleIndex = verifySampleIndex( iSampleIndex );
-
     std::string sampleName = getSampleName( m_header->getName(), iSampleIndex );
     H5Node parent;
 
@@ -167,6 +232,30 @@ void AprImpl::readSample( hid_t iGroup,
                             m_nativeDataType );
 }
 
+//-*****************************************************************************
+bool AprImpl::readDirect( index_t iSampleIndex,
+                          AbcA::ArraySamplePtr& oSamplePtr )
+{
+    const DatasetIndex::Entry * entry = findDirect( iSampleIndex );
+    if ( !entry )
+    {
+        return false;
+    }
+
+    AbcA::ReadArraySampleCachePtr cachePtr =
+        this->getObject()->getArchive()->getReadArraySampleCachePtr();
+    AbcA::ArraySamplePtr samp = m_datasetIndex->read( *entry,
+        m_header->getDataType(), cachePtr );
+
+    if ( !samp )
+    {
+        return false;
+    }
+
+    oSamplePtr = samp;
+    return true;
+}
+
 //-*****************************************************************************
 bool AprImpl::readKey( hid_t iGroup,
                        const std::string &iSampleName,
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreHDF5/Foundation.h>
 #include <Alembic/AbcCoreHDF5/SimplePrImpl.h>
+#include <Alembic/AbcCoreHDF5/DatasetIndex.h>
 
 namespace Alembic {
 namespace AbcCoreHDF5 {
@@ -80,8 +81,25 @@ protected:
                   const std::string &iSampleName,
                   AbcA::ArraySampleKey & oSamplePtr );
 
+    //-*************************************************************************
+    // This function is called by SimplePrImpl before taking the read lock,
+    // it only succeeds if the archive has a DatasetIndex covering the sample.
+    bool readDirect( index_t iSampleIndex,
+                     AbcA::ArraySamplePtr& oSamplePtr );
+
 private:
+    const DatasetIndex::Entry * findDirect( index_t iSampleIndex );
+
     bool m_isScalarLike;
+
+    // Only set when the archive was opened with direct reads.
+    DatasetIndexPtr m_datasetIndex;
+
+    // Object references of the groups holding sample 0 and the rest of the
+    // samples, the latter is looked up the first time it is needed.
+    hobj_ref_t m_parentRef;
+    hobj_ref_t m_samplesRef;
+    Alembic::Util::mutex m_samplesRefMutex;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -41,6 +41,7 @@
 #include <Alembic/AbcCoreHDF5/HDF5Util.h>
 #include <Alembic/AbcCoreHDF5/HDF5Util.h>
 #include <Alembic/AbcCoreHDF5/HDF5HierarchyReader.h>
+#include <Alembic/AbcCoreHDF5/ReadLock.h>
 
 namespace Alembic {
 namespace AbcCoreHDF5 {
@@ -49,11 +50,14 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 ArImpl::ArImpl( const std::string &iFileName,
                 AbcA::ReadArraySampleCachePtr iCache,
-                const bool iCacheHierarchy )
+                const bool iCacheHierarchy,
+                const bool iDirectRead )
   : m_fileName( iFileName )
   , m_file( -1 )
   , m_readArraySampleCache( iCache )
 {
+    ReadLock lock;
+
     // OPEN THE FILE!
     htri_t exi = H5Fis_hdf5( m_fileName.c_str() );
     ABCA_ASSERT( exi == 1, "Nonexistent or not an Alembic file: "
@@ -84,6 +88,15 @@ ArImpl::ArImpl( const std::string &iFileName,
     }
     m_archiveVersion = fileVersion;
 
+    if ( iDirectRead )
+    {
+        m_datasetIndex.reset( new DatasetIndex( m_file, m_fileName ) );
+        if ( !m_datasetIndex->valid() )
+        {
+            m_datasetIndex.reset();
+        }
+    }
+
     HDF5HierarchyReader reader( m_file, m_H5H, iCacheHierarchy );
     H5Node node = m_H5H.createNode( m_file );
     H5Node abcRoot = OpenGroup( node, "ABC" );
@@ -189,6 +202,7 @@ AbcA::index_t ArImpl::getMaxNumSamplesForTimeSamplingIndex( uint32_t iIndex )
 //-*****************************************************************************
 ArImpl::~ArImpl()
 {
+    ReadLock lock;
 
     m_data.reset();
 
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreHDF5/Foundation.h>
 #include <Alembic/AbcCoreHDF5/HDF5Hierarchy.h>
+#include <Alembic/AbcCoreHDF5/DatasetIndex.h>
 
 namespace Alembic {
 namespace AbcCoreHDF5 {
@@ -57,7 +58,8 @@ private:
 
     ArImpl( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache,
-            const bool iCacheHierarchy );
+            const bool iCacheHierarchy,
+            const bool iDirectRead );
 
 public:
     virtual ~ArImpl();
@@ -100,6 +102,12 @@ public:
         return m_archiveVersion;
     }
 
+    // Empty unless the archive was opened with direct reads turned on.
+    DatasetIndexPtr getDatasetIndex()
+    {
+        return m_datasetIndex;
+    }
+
 private:
     std::string m_fileName;
     hid_t m_file;
@@ -117,6 +125,8 @@ private:
     AbcA::ReadArraySampleCachePtr m_readArraySampleCache;
 
     HDF5Hierarchy m_H5H;
+
+    DatasetIndexPtr m_datasetIndex;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -37,6 +37,7 @@
 #include <Alembic/AbcCoreHDF5/CprData.h>
 #include <Alembic/AbcCoreHDF5/ReadUtil.h>
 #include <Alembic/AbcCoreHDF5/HDF5Util.h>
+#include <Alembic/AbcCoreHDF5/ReadLock.h>
 #include <Alembic/AbcCoreHDF5/CprImpl.h>
 #include <Alembic/AbcCoreHDF5/SprImpl.h>
 #include <Alembic/AbcCoreHDF5/AprImpl.h>
@@ -109,6 +110,8 @@ CprData::CprData( H5Node & iParentGroup, int32_t iArchiveVersion,
 {
     ABCA_ASSERT( iParentGroup.isValidObject(), "invalid parent group" );
 
+    ReadLock lock;
+
     // If our group exists, open it. If it does not, this is not a problem!
     // It just means we don't have any subproperties.
     if ( !GroupExists( iParentGroup, iName ) )
@@ -182,6 +185,8 @@ CprData::CprData( H5Node & iParentGroup, int32_t iArchiveVersion,
 CprData::~CprData()
 {
     delete[] m_subPropertyMutexes;
+
+    ReadLock lock;
     CloseObject( m_group );
 }
 
@@ -210,11 +215,14 @@ CprData::getPropertyHeader( AbcA::CompoundPropertyReaderPtr iParent, size_t i )
         uint32_t tsid = 0;
 
         PropertyHeaderPtr iPtr( new AbcA::PropertyHeader() );
-        ReadPropertyHeader( m_group, m_propertyHeaders[i].name, *iPtr,
-                            m_propertyHeaders[i].isScalarLike,
-                            m_propertyHeaders[i].numSamples,
-                            m_propertyHeaders[i].firstChangedIndex,
-                            m_propertyHeaders[i].lastChangedIndex, tsid );
+        {
+            ReadLock lock;
+            ReadPropertyHeader( m_group, m_propertyHeaders[i].name, *iPtr,
+                                m_propertyHeaders[i].isScalarLike,
+                                m_propertyHeaders[i].numSamples,
+                                m_propertyHeaders[i].firstChangedIndex,
+                                m_propertyHeaders[i].lastChangedIndex, tsid );
+        }
 
         if ( iPtr->isSimple() )
         {
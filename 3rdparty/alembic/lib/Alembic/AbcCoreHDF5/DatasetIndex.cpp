@@ -0,0 +1,421 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreHDF5/DatasetIndex.h>
+#include <Alembic/AbcCoreHDF5/ReadLock.h>
+#include <Alembic/AbcCoreHDF5/ReadUtil.h>
+#include <Alembic/AbcCoreHDF5/HDF5Util.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <errno.h>
+#endif
+
+namespace Alembic {
+namespace AbcCoreHDF5 {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Platform support functions for positional reads, these mirror the ones
+// used by Ogawa's file stream reader.
+#ifdef _WIN32
+
+static int OpenFile( const std::string &iFileName )
+{
+    int fid = -1;
+    _sopen_s( &fid, iFileName.c_str(), _O_RDONLY | _O_BINARY | _O_RANDOM,
+              _SH_DENYNO, _S_IREAD );
+    return fid;
+}
+
+static void CloseFile( int iFid )
+{
+    if ( iFid > -1 )
+    {
+        _close( iFid );
+    }
+}
+
+static bool ReadFileBytes( int iFid, void * oBuf,
+                           Alembic::Util::uint64_t iOffset,
+                           Alembic::Util::uint64_t iSize )
+{
+    char * buf = static_cast< char * >( oBuf );
+    Alembic::Util::uint64_t offset = iOffset;
+    Alembic::Util::uint64_t totalRead = 0;
+
+    HANDLE hFile = reinterpret_cast<HANDLE>( _get_osfhandle( iFid ) );
+    DWORD numRead = 0;
+    do
+    {
+        DWORD numToRead = MAXDWORD;
+        if ( ( iSize - totalRead ) < MAXDWORD )
+        {
+            numToRead = static_cast<DWORD>( iSize - totalRead );
+        }
+
+        OVERLAPPED overlapped;
+        memset( &overlapped, 0, sizeof( overlapped ) );
+        overlapped.Offset = static_cast<DWORD>( offset );
+        overlapped.OffsetHigh = static_cast<DWORD>( offset >> 32 );
+
+        if ( !ReadFile( hFile, buf, numToRead, &numRead, &overlapped ) )
+        {
+            return false;
+        }
+        totalRead += numRead;
+        offset += numRead;
+        buf += numRead;
+    }
+    while ( numRead > 0 && totalRead < iSize );
+
+    return totalRead == iSize;
+}
+
+#else
+
+static int OpenFile( const std::string &iFileName )
+{
+    return open( iFileName.c_str(), O_RDONLY );
+}
+
+static void CloseFile( int iFid )
+{
+    if ( iFid > -1 )
+    {
+        close( iFid );
+    }
+}
+
+static bool ReadFileBytes( int iFid, void * oBuf,
+                           Alembic::Util::uint64_t iOffset,
+                           Alembic::Util::uint64_t iSize )
+{
+    char * buf = static_cast< char * >( oBuf );
+    off_t offset = iOffset;
+    Alembic::Util::uint64_t totalRead = 0;
+
+    ssize_t numRead = 0;
+    do
+    {
+        Alembic::Util::uint64_t readCount = iSize - totalRead;
+
+        // if over 1 GB read it 1 GB chunk at a time to accomodate OSX
+        if ( readCount > 1073741824 )
+        {
+            readCount = 1073741824;
+        }
+
+        numRead = pread( iFid, buf, readCount, offset );
+        if ( numRead > 0 )
+        {
+            totalRead += numRead;
+            offset += numRead;
+            buf += numRead;
+        }
+
+        if ( numRead < 0 && errno != EINTR )
+        {
+            return false;
+        }
+    }
+    while ( numRead != 0 && totalRead < iSize );
+
+    return totalRead == iSize;
+}
+
+#endif
+
+//-*****************************************************************************
+static herr_t IndexDatasetsCB( hid_t iGroup,
+                               const char *iName,
+                               const H5L_info_t *iLinfo,
+                               void *iOpData )
+{
+    DatasetIndex *index = ( DatasetIndex * )iOpData;
+
+    H5O_info_t Oinfo;
+    if ( H5Oget_info_by_name( iGroup, iName, &Oinfo, H5P_DEFAULT ) < 0 )
+    {
+        return 0;
+    }
+
+    if ( Oinfo.type == H5O_TYPE_GROUP )
+    {
+        H5Literate_by_name( iGroup, iName,
+                            H5_INDEX_NAME,
+                            H5_ITER_INC,
+                            NULL,
+                            IndexDatasetsCB,
+                            iOpData,
+                            H5P_DEFAULT );
+    }
+    else if ( Oinfo.type == H5O_TYPE_DATASET )
+    {
+        // don't let a badly formed key or dims attribute escape through
+        // HDF5's C iteration, that dataset just won't be read directly
+        try
+        {
+            index->addDataset( iGroup, iName );
+        }
+        catch ( ... )
+        {
+        }
+    }
+
+    // Keep iterating!
+    return 0;
+}
+
+//-*****************************************************************************
+DatasetIndex::DatasetIndex( hid_t iFile, const std::string &iFileName )
+  : m_fid( -1 )
+{
+    m_fid = OpenFile( iFileName );
+    if ( m_fid < 0 )
+    {
+        return;
+    }
+
+    H5Literate( iFile,
+                H5_INDEX_NAME,
+                H5_ITER_INC,
+                NULL,
+                IndexDatasetsCB,
+                ( void * )this );
+}
+
+//-*****************************************************************************
+DatasetIndex::~DatasetIndex()
+{
+    CloseFile( m_fid );
+}
+
+//-*****************************************************************************
+void DatasetIndex::addDataset( hid_t iGroup, const char *iName )
+{
+    hid_t dsetId = H5Dopen( iGroup, iName, H5P_DEFAULT );
+    if ( dsetId < 0 )
+    {
+        return;
+    }
+    DsetCloser dsetCloser( dsetId );
+
+    // Only plain contiguous storage has all of its bytes in one place.
+    hid_t plistId = H5Dget_create_plist( dsetId );
+    PlistCloser plistCloser( plistId );
+    if ( plistId < 0 || H5Pget_layout( plistId ) != H5D_CONTIGUOUS ||
+         H5Pget_external_count( plistId ) != 0 ||
+         H5Pget_nfilters( plistId ) != 0 )
+    {
+        return;
+    }
+
+    // Not allocated yet, which is the case for empty samples.
+    haddr_t offset = H5Dget_offset( dsetId );
+    if ( offset == HADDR_UNDEF )
+    {
+        return;
+    }
+
+    hid_t dspaceId = H5Dget_space( dsetId );
+    DspaceCloser dspaceCloser( dspaceId );
+    if ( dspaceId < 0 || H5Sget_simple_extent_type( dspaceId ) != H5S_SIMPLE ||
+         H5Sget_simple_extent_ndims( dspaceId ) != 1 )
+    {
+        return;
+    }
+
+    hssize_t numPoints = H5Sget_simple_extent_npoints( dspaceId );
+    if ( numPoints < 1 )
+    {
+        return;
+    }
+
+    // The bytes on disk have to be usable as is, so no byte swapping and
+    // nothing that HDF5 would otherwise have to convert for us.
+    hid_t dtypeId = H5Dget_type( dsetId );
+    DtypeCloser dtypeCloser( dtypeId );
+    if ( dtypeId < 0 || H5Tget_class( dtypeId ) == H5T_STRING )
+    {
+        return;
+    }
+
+    hid_t nativeId = H5Tget_native_type( dtypeId, H5T_DIR_ASCEND );
+    DtypeCloser nativeCloser( nativeId );
+    if ( nativeId < 0 || H5Tequal( dtypeId, nativeId ) <= 0 )
+    {
+        return;
+    }
+
+    Entry entry;
+    entry.offset = offset;
+    entry.numPoints = numPoints;
+    entry.elementSize = H5Tget_size( dtypeId );
+
+    if ( H5Dget_storage_size( dsetId ) < entry.numPoints * entry.elementSize )
+    {
+        return;
+    }
+
+    entry.hasKey = ReadKey( dsetId, "key", entry.key );
+
+    std::string dimName = std::string( iName ) + ".dims";
+    if ( H5Aexists( iGroup, dimName.c_str() ) > 0 )
+    {
+        ReadDimensions( iGroup, dimName, entry.dims );
+        entry.hasDims = true;
+    }
+
+    hobj_ref_t groupRef;
+    if ( H5Rcreate( &groupRef, iGroup, ".", H5R_OBJECT, -1 ) < 0 )
+    {
+        return;
+    }
+
+    m_entries[ EntryKey( groupRef, iName ) ] = entry;
+}
+
+//-*****************************************************************************
+const DatasetIndex::Entry *
+DatasetIndex::find( hobj_ref_t iGroup, const std::string &iName ) const
+{
+    EntryMap::const_iterator it = m_entries.find( EntryKey( iGroup, iName ) );
+    if ( it == m_entries.end() )
+    {
+        return NULL;
+    }
+
+    return &( it->second );
+}
+
+//-*****************************************************************************
+bool DatasetIndex::getDimensions( const Entry &iEntry,
+                                  const AbcA::DataType &iDataType,
+                                  Dimensions &oDims ) const
+{
+    PlainOldDataType pod = iDataType.getPod();
+    size_t extent = iDataType.getExtent();
+
+    if ( pod == kStringPOD || pod == kWstringPOD ||
+         PODNumBytes( pod ) != iEntry.elementSize ||
+         extent == 0 || iEntry.numPoints % extent != 0 )
+    {
+        return false;
+    }
+
+    if ( iEntry.hasDims )
+    {
+        oDims = iEntry.dims;
+    }
+    else
+    {
+        oDims = Dimensions( iEntry.numPoints / extent );
+    }
+
+    return oDims.numPoints() * extent == iEntry.numPoints;
+}
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+DatasetIndex::read( const Entry &iEntry,
+                    const AbcA::DataType &iDataType,
+                    AbcA::ReadArraySampleCachePtr iCache ) const
+{
+    Dimensions dims;
+    if ( !getDimensions( iEntry, iDataType, dims ) )
+    {
+        return AbcA::ArraySamplePtr();
+    }
+
+    AbcA::ArraySample::Key key;
+    key.origPOD = iDataType.getPod();
+    key.readPOD = key.origPOD;
+    key.numBytes = iEntry.numPoints * iEntry.elementSize;
+    key.digest = iEntry.key.digest;
+
+    bool useCache = iCache && iEntry.hasKey;
+    if ( useCache )
+    {
+        AbcA::ReadArraySampleID found = iCache->find( key );
+
+        if ( found )
+        {
+            AbcA::ArraySamplePtr ret = found.getSample();
+            assert( ret );
+            if ( ret->getDataType().getPod() != iDataType.getPod() )
+            {
+                ABCA_THROW( "ERROR: Read data type for direct read: "
+                            << ret->getDataType()
+                            << " does not match expected data type: "
+                            << iDataType );
+            }
+
+            return ret;
+        }
+    }
+
+    AbcA::ArraySamplePtr ret = AbcA::AllocateArraySample( iDataType, dims );
+    assert( ret->getData() );
+
+    ABCA_ASSERT( ReadFileBytes( m_fid, const_cast<void*>( ret->getData() ),
+                                iEntry.offset, key.numBytes ),
+                 "Direct read of " << key.numBytes << " bytes at offset "
+                 << iEntry.offset << " failed." );
+
+    CountDirectRead( key.numBytes );
+
+    if ( useCache )
+    {
+        AbcA::ReadArraySampleID stored = iCache->store( key, ret );
+        if ( stored )
+        {
+            return stored.getSample();
+        }
+    }
+
+    return ret;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreHDF5
+} // End namespace Alembic
@@ -0,0 +1,117 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreHDF5_DatasetIndex_h
+#define Alembic_AbcCoreHDF5_DatasetIndex_h
+
+#include <Alembic/AbcCoreHDF5/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreHDF5 {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// Built once when an archive is opened with direct reads turned on.
+// Every rank 1 dataset whose data is stored contiguously, unfiltered and
+// already in the native layout is recorded along with its file offset, key
+// and dimensions, so that array samples can later be read with a plain
+// positional read instead of a round trip through HDF5.
+class DatasetIndex : Alembic::Util::noncopyable
+{
+public:
+    struct Entry
+    {
+        Entry() : offset( 0 ), numPoints( 0 ), elementSize( 0 ),
+                  hasKey( false ), hasDims( false ) {}
+
+        Alembic::Util::uint64_t offset;
+
+        // number of HDF5 elements and the size in bytes of each of them
+        Alembic::Util::uint64_t numPoints;
+        size_t elementSize;
+
+        bool hasKey;
+        AbcA::ArraySample::Key key;
+
+        bool hasDims;
+        Dimensions dims;
+    };
+
+    DatasetIndex( hid_t iFile, const std::string &iFileName );
+    ~DatasetIndex();
+
+    // false if the file could not be opened for reading
+    bool valid() const { return m_fid > -1; }
+
+    size_t size() const { return m_entries.size(); }
+
+    // iGroup is the object reference of the group holding the dataset
+    const Entry * find( hobj_ref_t iGroup, const std::string &iName ) const;
+
+    // Fills in the sample dimensions, returns false if the entry can't hold
+    // samples of iDataType.
+    bool getDimensions( const Entry &iEntry,
+                        const AbcA::DataType &iDataType,
+                        Dimensions &oDims ) const;
+
+    // Reads the sample, going through iCache if it is set. Returns an empty
+    // pointer if the entry can't hold samples of iDataType, it is up to the
+    // caller to fall back to HDF5 in that case.
+    AbcA::ArraySamplePtr read( const Entry &iEntry,
+                               const AbcA::DataType &iDataType,
+                               AbcA::ReadArraySampleCachePtr iCache ) const;
+
+    // called while walking the file
+    void addDataset( hid_t iGroup, const char *iName );
+
+private:
+    typedef std::pair< hobj_ref_t, std::string > EntryKey;
+    typedef std::map< EntryKey, Entry > EntryMap;
+
+    EntryMap m_entries;
+    int m_fid;
+};
+
+typedef Alembic::Util::shared_ptr<DatasetIndex> DatasetIndexPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreHDF5
+} // End namespace Alembic
+
+#endif
@@ -40,6 +40,7 @@
 #include <Alembic/AbcCoreHDF5/CprImpl.h>
 #include <Alembic/AbcCoreHDF5/ReadUtil.h>
 #include <Alembic/AbcCoreHDF5/HDF5Util.h>
+#include <Alembic/AbcCoreHDF5/ReadLock.h>
 
 namespace Alembic {
 namespace AbcCoreHDF5 {
@@ -74,6 +75,8 @@ OrData::OrData( ObjectHeaderPtr iHeader,
     ABCA_ASSERT( iHeader, "Invalid header" );
     ABCA_ASSERT( iParentGroup.isValidObject(), "Invalid group" );
 
+    ReadLock lock;
+
     m_group = OpenGroup( iParentGroup, iHeader->getName().c_str() );
     ABCA_ASSERT( m_group.isValidObject(),
         "Could not open object group: "
@@ -124,6 +127,7 @@ OrData::OrData( ObjectHeaderPtr iHeader,
 //-*****************************************************************************
 OrData::~OrData()
 {
+    ReadLock lock;
     CloseObject( m_oldGroup );
     delete [] m_children;
 }
@@ -162,6 +166,8 @@ OrData::getChildHeader( AbcA::ObjectReaderPtr iParent, size_t i )
     Alembic::Util::scoped_lock l( m_childObjectsMutex );
     if ( ! m_children[i].loadedMetaData )
     {
+        ReadLock lock;
+
         H5Node group = OpenGroup( m_group,
             m_children[i].header->getName().c_str() );
 ;
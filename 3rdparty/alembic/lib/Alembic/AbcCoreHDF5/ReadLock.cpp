@@ -0,0 +1,248 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreHDF5/ReadLock.h>
+#include <Alembic/AbcCoreHDF5/ReadWrite.h>
+
+#ifndef _MSC_VER
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+namespace Alembic {
+namespace AbcCoreHDF5 {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// How many ReadLocks the calling thread holds, kept in native thread local
+// storage since thread_local isn't available to every build.
+class ThreadDepth : Alembic::Util::noncopyable
+{
+public:
+    ThreadDepth()
+    {
+#ifdef _MSC_VER
+        m_key = TlsAlloc();
+#else
+        pthread_key_create( &m_key, NULL );
+#endif
+    }
+
+    ~ThreadDepth()
+    {
+#ifdef _MSC_VER
+        TlsFree( m_key );
+#else
+        pthread_key_delete( m_key );
+#endif
+    }
+
+    size_t get() const
+    {
+#ifdef _MSC_VER
+        return ( size_t ) TlsGetValue( m_key );
+#else
+        return ( size_t ) pthread_getspecific( m_key );
+#endif
+    }
+
+    void set( size_t iDepth )
+    {
+#ifdef _MSC_VER
+        TlsSetValue( m_key, ( LPVOID ) iDepth );
+#else
+        pthread_setspecific( m_key, ( void * ) iDepth );
+#endif
+    }
+
+private:
+#ifdef _MSC_VER
+    DWORD m_key;
+#else
+    pthread_key_t m_key;
+#endif
+};
+
+//-*****************************************************************************
+Alembic::Util::mutex g_readMutex;
+
+// only touched while g_readMutex is held
+ReadLockProfile g_profile;
+
+ThreadDepth g_depth;
+
+// guards the profiling switch and the direct read counters, which are
+// touched without holding g_readMutex
+Alembic::Util::mutex g_countMutex;
+bool g_profiling = false;
+Alembic::Util::uint64_t g_numDirectReads = 0;
+Alembic::Util::uint64_t g_numDirectBytes = 0;
+
+//-*****************************************************************************
+bool IsProfiling()
+{
+    Alembic::Util::scoped_lock l( g_countMutex );
+    return g_profiling;
+}
+
+//-*****************************************************************************
+double Now()
+{
+#ifdef _MSC_VER
+    LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    QueryPerformanceFrequency( &freq );
+    QueryPerformanceCounter( &now );
+    return ( double ) now.QuadPart / ( double ) freq.QuadPart;
+#else
+    timeval t;
+    gettimeofday( &t, 0 );
+    return ( double ) t.tv_sec + ( double ) t.tv_usec / 1000000.0;
+#endif
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+ReadLockProfile::ReadLockProfile()
+  : numAcquires( 0 )
+  , waitSeconds( 0.0 )
+  , maxWaitSeconds( 0.0 )
+  , heldSeconds( 0.0 )
+  , numDirectReads( 0 )
+  , numDirectBytes( 0 )
+{
+}
+
+//-*****************************************************************************
+ReadLock::ReadLock()
+  : m_outer( g_depth.get() == 0 )
+  , m_profile( m_outer && IsProfiling() )
+  , m_acquired( 0.0 )
+{
+    g_depth.set( g_depth.get() + 1 );
+    if ( !m_outer )
+    {
+        return;
+    }
+
+    if ( !m_profile )
+    {
+        g_readMutex.lock();
+        return;
+    }
+
+    double start = Now();
+    g_readMutex.lock();
+    m_acquired = Now();
+
+    double wait = m_acquired - start;
+    g_profile.numAcquires ++;
+    g_profile.waitSeconds += wait;
+    if ( wait > g_profile.maxWaitSeconds )
+    {
+        g_profile.maxWaitSeconds = wait;
+    }
+}
+
+//-*****************************************************************************
+ReadLock::~ReadLock()
+{
+    g_depth.set( g_depth.get() - 1 );
+    if ( !m_outer )
+    {
+        return;
+    }
+
+    if ( m_profile )
+    {
+        g_profile.heldSeconds += Now() - m_acquired;
+    }
+
+    g_readMutex.unlock();
+}
+
+//-*****************************************************************************
+void CountDirectRead( Alembic::Util::uint64_t iNumBytes )
+{
+    Alembic::Util::scoped_lock l( g_countMutex );
+    if ( g_profiling )
+    {
+        g_numDirectReads ++;
+        g_numDirectBytes += iNumBytes;
+    }
+}
+
+//-*****************************************************************************
+void SetReadLockProfiling( bool iEnable )
+{
+    Alembic::Util::scoped_lock l( g_countMutex );
+    g_profiling = iEnable;
+}
+
+//-*****************************************************************************
+ReadLockProfile GetReadLockProfile()
+{
+    ReadLockProfile ret;
+    {
+        Alembic::Util::scoped_lock l( g_readMutex );
+        ret = g_profile;
+    }
+
+    Alembic::Util::scoped_lock l( g_countMutex );
+    ret.numDirectReads = g_numDirectReads;
+    ret.numDirectBytes = g_numDirectBytes;
+    return ret;
+}
+
+//-*****************************************************************************
+void ResetReadLockProfile()
+{
+    {
+        Alembic::Util::scoped_lock l( g_readMutex );
+        g_profile = ReadLockProfile();
+    }
+
+    Alembic::Util::scoped_lock l( g_countMutex );
+    g_numDirectReads = 0;
+    g_numDirectBytes = 0;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreHDF5
+} // End namespace Alembic
@@ -80,12 +80,21 @@ CreateCache()
 ReadArchive::ReadArchive()
 {
     m_cacheHierarchy = false;
+    m_directRead = false;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( bool iCacheHierarchy )
 {
     m_cacheHierarchy = iCacheHierarchy;
+    m_directRead = false;
+}
+
+//-*****************************************************************************
+ReadArchive::ReadArchive( bool iCacheHierarchy, bool iDirectRead )
+{
+    m_cacheHierarchy = iCacheHierarchy;
+    m_directRead = iDirectRead;
 }
 
 //-*****************************************************************************
@@ -95,7 +104,8 @@ ReadArchive::operator()( const std::string &iFileName ) const
 {
     AbcA::ReadArraySampleCachePtr cachePtr = CreateCache();
     Alembic::Util::shared_ptr<ArImpl> archivePtr(
-        new ArImpl( iFileName, cachePtr, m_cacheHierarchy ) );
+        new ArImpl( iFileName, cachePtr, m_cacheHierarchy,
+                    m_directRead ) );
 
     return archivePtr;
 }
@@ -107,7 +117,8 @@ ReadArchive::operator()( const std::string &iFileName,
                          AbcA::ReadArraySampleCachePtr iCachePtr ) const
 {
     Alembic::Util::shared_ptr<ArImpl> archivePtr(
-        new ArImpl( iFileName, iCachePtr, m_cacheHierarchy ) );
+        new ArImpl( iFileName, iCachePtr, m_cacheHierarchy,
+                    m_directRead ) );
     return archivePtr;
 }
 
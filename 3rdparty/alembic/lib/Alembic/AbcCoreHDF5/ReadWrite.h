@@ -78,6 +78,12 @@ public:
     ReadArchive();
     explicit ReadArchive( bool iCacheHierarchy );
 
+    //! When iDirectRead is true the location of every contiguous,
+    //! uncompressed dataset is indexed when the archive is opened, and
+    //! numeric array samples stored that way are read straight from the file
+    //! without going through HDF5 (or the lock that serializes it).
+    ReadArchive( bool iCacheHierarchy, bool iDirectRead );
+
     // Make our own cache.
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
@@ -89,8 +95,49 @@ public:
               ) const;
 private:
     bool m_cacheHierarchy;
+    bool m_directRead;
 };
 
+//-*****************************************************************************
+//! HDF5 is not safe to call from several threads at once, so every HDF5 call
+//! the reader makes (opening archives, walking objects and properties,
+//! reading samples and closing handles) is serialized on a single library
+//! wide lock owned by AbcCoreHDF5. These counters describe how much that lock
+//! is costing readers.
+//!
+//! They only measure waiting on, and holding, that lock. A thread safe HDF5
+//! build serializes calls on its own internal lock too, which is taken inside
+//! the calls and so shows up here as held time, never as wait time.
+struct ALEMBIC_EXPORT ReadLockProfile
+{
+    ReadLockProfile();
+
+    //! Number of times the lock was taken while profiling was on.
+    Alembic::Util::uint64_t numAcquires;
+
+    //! Total and worst case seconds spent waiting to take the lock.
+    double waitSeconds;
+    double maxWaitSeconds;
+
+    //! Total seconds the lock was held.
+    double heldSeconds;
+
+    //! Array samples, and their bytes, read directly from the file without
+    //! taking the lock.
+    Alembic::Util::uint64_t numDirectReads;
+    Alembic::Util::uint64_t numDirectBytes;
+};
+
+//-*****************************************************************************
+//! Turns the read lock instrumentation on or off, it is off by default.
+ALEMBIC_EXPORT void SetReadLockProfiling( bool iEnable );
+
+//! Returns the counters gathered since the last reset.
+ALEMBIC_EXPORT ReadLockProfile GetReadLockProfile();
+
+//! Zeroes the counters.
+ALEMBIC_EXPORT void ResetReadLockProfile();
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
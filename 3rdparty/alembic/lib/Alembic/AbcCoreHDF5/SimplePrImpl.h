@@ -44,6 +44,7 @@
 #include <Alembic/AbcCoreHDF5/ReadUtil.h>
 #include <Alembic/AbcCoreHDF5/DataTypeRegistry.h>
 #include <Alembic/AbcCoreHDF5/HDF5Util.h>
+#include <Alembic/AbcCoreHDF5/ReadLock.h>
 
 namespace Alembic {
 namespace AbcCoreHDF5 {
@@ -69,6 +70,12 @@ namespace ALEMBIC_VERSION_NS {
 //                  index_t iSampleIndex,
 //                  SAMPLE oSample );
 //
+// bool readDirect( index_t iSampleIndex, SAMPLE oSample );
+//
+// readDirect is tried first, outside of the ReadLock, and should return false
+// when the sample has to be read through HDF5. readSample and readKey are
+// called with the ReadLock held.
+//
 //-*****************************************************************************
 template <class ABSTRACT, class IMPL, class SAMPLE>
 class SimplePrImpl : public ABSTRACT
@@ -194,6 +201,7 @@ SimplePrImpl<ABSTRACT,IMPL,SAMPLE>::SimplePrImpl
     PlainOldDataType POD = m_header->getDataType().getPod();
     if ( POD != kStringPOD && POD != kWstringPOD )
     {
+        ReadLock lock;
         m_fileDataType = GetFileH5T( m_header->getDataType(),
                                      m_cleanFileDataType );
         m_nativeDataType = GetNativeH5T( m_header->getDataType(),
@@ -341,6 +349,13 @@ SimplePrImpl<ABSTRACT,IMPL,SAMPLE>::getSample( index_t iSampleIndex,
 {
     iSampleIndex = verifySampleIndex( iSampleIndex );
 
+    if ( static_cast<IMPL *>( this )->readDirect( iSampleIndex, oSample ) )
+    {
+        return;
+    }
+
+    ReadLock lock;
+
     // Get our name.
     const std::string &myName = m_header->getName();
 
@@ -389,6 +404,8 @@ SimplePrImpl<ABSTRACT,IMPL,SAMPLE>::getKey( index_t iSampleIndex,
 {
     iSampleIndex = verifySampleIndex( iSampleIndex );
 
+    ReadLock lock;
+
     // Get our name.
     const std::string &myName = m_header->getName();
 
@@ -431,6 +448,8 @@ SimplePrImpl<ABSTRACT,IMPL,SAMPLE>::getKey( index_t iSampleIndex,
 template <class ABSTRACT, class IMPL, class SAMPLE>
 SimplePrImpl<ABSTRACT,IMPL,SAMPLE>::~SimplePrImpl()
 {
+    ReadLock lock;
+
     // Clean up our samples group, if necessary.
     CloseObject( m_samplesIGroup );
 
@@ -93,6 +93,12 @@ protected:
                   const std::string &iSampleName,
                   AbcA::ArraySampleKey & oSamplePtr ) { return false; }
 
+    //-*************************************************************************
+    // This function is called by SimplePrImpl, scalar samples live in
+    // attributes and are always read through HDF5.
+    bool readDirect( index_t iSampleIndex, void *oSampleBytes )
+    { return false; }
+
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -1756,6 +1756,114 @@ void testArrayStringsRepeats()
     }
 }
 
+//-*****************************************************************************
+void testDirectRead()
+{
+    std::string archiveName = "directRead.abc";
+
+    ABCA::DataType v3fd(Alembic::Util::kFloat32POD, 3);
+    ABCA::DataType u16d(Alembic::Util::kUint16POD, 1);
+    ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+
+    {
+        A5::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr pwp =
+            parent->createArrayProperty("P", ABCA::MetaData(), v3fd, 0);
+        ABCA::ArrayPropertyWriterPtr gwp =
+            parent->createArrayProperty("grid", ABCA::MetaData(), u16d, 0);
+        ABCA::ArrayPropertyWriterPtr swp =
+            parent->createArrayProperty("str", ABCA::MetaData(), strd, 0);
+
+        // the last sample repeats the first to exercise the cache
+        std::vector< Alembic::Util::float32_t > pts(12);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < pts.size(); ++j)
+            {
+                pts[j] = (Alembic::Util::float32_t)((i % 3) * 100 + j);
+            }
+
+            pwp->setSample(ABCA::ArraySample(&(pts.front()), v3fd,
+                Alembic::Util::Dimensions(4)));
+        }
+
+        std::vector< Alembic::Util::uint16_t > grid(6);
+        for (size_t i = 0; i < grid.size(); ++i)
+        {
+            grid[i] = (Alembic::Util::uint16_t)(i * 3);
+        }
+        Alembic::Util::Dimensions gridDims;
+        gridDims.setRank(2);
+        gridDims[0] = 2;
+        gridDims[1] = 3;
+        gwp->setSample(ABCA::ArraySample(&(grid.front()), u16d, gridDims));
+
+        std::vector< Alembic::Util::string > strs(2);
+        strs[0] = "direct";
+        strs[1] = "read";
+        swp->setSample(ABCA::ArraySample(&(strs.front()), strd,
+            Alembic::Util::Dimensions(2)));
+    }
+
+    {
+        A5::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r(archiveName);
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+        A5::ReadArchive rd(false, true);
+        ABCA::ArchiveReaderPtr ad = rd(archiveName);
+        ABCA::CompoundPropertyReaderPtr parentd =
+            ad->getTop()->getProperties();
+
+        A5::ResetReadLockProfile();
+        A5::SetReadLockProfiling(true);
+
+        const char * names[3] = { "P", "grid", "str" };
+        for (size_t n = 0; n < 3; ++n)
+        {
+            ABCA::ArrayPropertyReaderPtr ap =
+                parent->getArrayProperty(names[n]);
+            ABCA::ArrayPropertyReaderPtr apd =
+                parentd->getArrayProperty(names[n]);
+            TESTING_ASSERT(ap->getNumSamples() == apd->getNumSamples());
+
+            for (size_t i = 0; i < ap->getNumSamples(); ++i)
+            {
+                ABCA::ArraySamplePtr samp;
+                ABCA::ArraySamplePtr sampd;
+                ap->getSample(i, samp);
+                apd->getSample(i, sampd);
+
+                TESTING_ASSERT(samp->getDimensions() ==
+                               sampd->getDimensions());
+                TESTING_ASSERT(samp->getDataType() == sampd->getDataType());
+                TESTING_ASSERT(samp->getKey() == sampd->getKey());
+
+                Alembic::Util::Dimensions dims;
+                apd->getDimensions(i, dims);
+                TESTING_ASSERT(dims == samp->getDimensions());
+            }
+        }
+
+        // the repeated float sample comes out of the cache, and the strings
+        // always go through HDF5
+        A5::ReadLockProfile profile = A5::GetReadLockProfile();
+        TESTING_ASSERT(profile.numDirectReads == 4);
+        TESTING_ASSERT(profile.numDirectBytes == 3 * 48 + 12);
+        TESTING_ASSERT(profile.numAcquires > 0);
+
+        A5::SetReadLockProfiling(false);
+        A5::ResetReadLockProfile();
+        profile = A5::GetReadLockProfile();
+        TESTING_ASSERT(profile.numAcquires == 0 &&
+                       profile.numDirectReads == 0);
+    }
+}
+
 int main ( int argc, char *argv[] )
 {
     testEmptyArray();
@@ -1763,5 +1871,6 @@ int main ( int argc, char *argv[] )
     testReadWriteArrays();
     testExtentArrayStrings();
     testArrayStringsRepeats();
+    testDirectRead();
     return 0;
 }
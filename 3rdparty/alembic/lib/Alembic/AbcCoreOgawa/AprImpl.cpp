@@ -104,14 +104,17 @@ void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+            getObject()->getArchive() );
+    StreamIDPtr streamId = archive->getStreamID();
 
     std::size_t id = streamId->getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
     Ogawa::IDataPtr data = m_group->getData(index, id);
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample,
+                     archive->getSampleBufferPool() );
 }
 
 //-*****************************************************************************
@@ -202,6 +205,32 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
     ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod );
 }
 
+//-*****************************************************************************
+bool AprImpl::getStoredSample( index_t iSampleIndex,
+                               Alembic::Util::Dimensions & oDim,
+                               std::vector< Util::uint8_t > & oData )
+{
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr dims = m_group->getData( index + 1, id );
+    Ogawa::IDataPtr data = m_group->getData( index, id );
+
+    if ( !data || data->getSize() < 16 )
+    {
+        return false;
+    }
+
+    ReadDimensions( dims, data, id, m_header->header.getDataType(), oDim );
+
+    oData.resize( data->getSize() );
+    data->read( data->getSize(), &oData.front(), 0, id );
+    return true;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -74,6 +74,13 @@ public:
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         Alembic::Util::PlainOldDataType iPod );
 
+    // Reads the dimensions of a sample and its data exactly as stored,
+    // with the 16 byte key in front of the data, for ApwImpl::copySample.
+    // Returns false if the stored data is too small to hold a key.
+    bool getStoredSample( index_t iSampleIndex,
+                          Alembic::Util::Dimensions & oDim,
+                          std::vector< Util::uint8_t > & oData );
+
 private:
 
     // Parent compound property writer. It must exist.
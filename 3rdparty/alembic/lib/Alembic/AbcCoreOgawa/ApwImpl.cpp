@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
+#include <Alembic/AbcCoreOgawa/AprImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
@@ -128,6 +129,80 @@ void ApwImpl::setFromPreviousSample()
 
 //-*****************************************************************************
 void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
+{
+    ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
+        "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
+        ", does not match the DataType of the Array property: " <<
+        m_header->header.getDataType() );
+
+    // strings are laid out once and hashed from, and written from, the
+    // same buffer
+    Alembic::Util::PlainOldDataType pod = iSamp.getDataType().getPod();
+    if ( pod == Alembic::Util::kStringPOD ||
+         pod == Alembic::Util::kWstringPOD )
+    {
+        std::vector< Util::uint8_t > data;
+        AbcA::ArraySample::Key key = SerializeStrings( iSamp, data );
+        writeSample( key, iSamp.getDimensions(), NULL, &data );
+        return;
+    }
+
+    // The Key helps us analyze the sample.
+    AbcA::ArraySample::Key key = iSamp.getKey();
+
+    writeSample( key, iSamp.getDimensions(), &iSamp, NULL );
+}
+
+//-*****************************************************************************
+bool ApwImpl::copySample( AbcA::ArrayPropertyReaderPtr iReader,
+                          index_t iSampleIndex )
+{
+    AprImpl * reader = dynamic_cast< AprImpl * >( iReader.get() );
+    if ( !reader )
+    {
+        return false;
+    }
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    ABCA_ASSERT( reader->getHeader().getDataType() == dataType,
+        "DataType on ArrayPropertyReader iReader: " <<
+        reader->getHeader().getDataType() <<
+        ", does not match the DataType of the Array property: " <<
+        dataType );
+
+    AbcA::Dimensions dims;
+    std::vector< Util::uint8_t > data;
+    if ( !reader->getStoredSample( iSampleIndex, dims, data ) )
+    {
+        return false;
+    }
+
+    // rebuild the key that setSample would have made for this data, the
+    // digest is the one that was stored in front of it
+    AbcA::ArraySample::Key key;
+    key.numBytes = dataType.getNumBytes() * dims.numPoints();
+    key.origPOD = dataType.getPod();
+    key.readPOD = key.origPOD;
+    memcpy( key.digest.d, &data.front(), 16 );
+
+    // strings aren't stored at their in memory size, so only the others
+    // can be sanity checked
+    if ( key.origPOD != Alembic::Util::kStringPOD &&
+         key.origPOD != Alembic::Util::kWstringPOD &&
+         key.numBytes + 16 != data.size() )
+    {
+        return false;
+    }
+
+    writeSample( key, dims, NULL, &data );
+    return true;
+}
+
+//-*****************************************************************************
+void ApwImpl::writeSample( const AbcA::ArraySample::Key & iKey,
+                           const AbcA::Dimensions & iDims,
+                           const AbcA::ArraySample * iSamp,
+                           const std::vector< Util::uint8_t > * iStored )
 {
     // Make sure we aren't writing more samples than we have times for
     // This applies to acyclic sampling only
@@ -138,13 +213,8 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         "Can not write more samples than we have times for when using "
         "Acyclic sampling." );
 
-    ABCA_ASSERT( iSamp.getDataType() == m_header->header.getDataType(),
-        "DataType on ArraySample iSamp: " << iSamp.getDataType() <<
-        ", does not match the DataType of the Array property: " <<
-        m_header->header.getDataType() );
-
-    // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = iSamp.getKey();
+    AbcA::ArraySample::Key key = iKey;
+    const AbcA::DataType & dataType = m_header->header.getDataType();
 
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
@@ -172,8 +242,7 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
             {
                 assert( smpI > 0 );
                 CopyWrittenData( m_group, m_previousWrittenSampleID );
-                WriteDimensions( m_group, m_dims,
-                                 iSamp.getDataType().getPod() );
+                WriteDimensions( m_group, m_dims, dataType.getPod() );
             }
         }
 
@@ -183,11 +252,20 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( iSamp )
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, *iSamp, key );
+        }
+        else
+        {
+            m_previousWrittenSampleID =
+                WriteStoredData( GetWrittenSampleMap( awp ), m_group,
+                    *iStored, key, dataType.getExtent() * iDims.numPoints() );
+        }
 
-        m_dims = iSamp.getDimensions();
-        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
+        m_dims = iDims;
+        WriteDimensions( m_group, m_dims, dataType.getPod() );
 
         // if we haven't written this already, isScalarLike will be true
         if ( m_header->isScalarLike && m_dims.numPoints() != 1 )
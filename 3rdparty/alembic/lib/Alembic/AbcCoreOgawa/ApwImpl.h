@@ -66,6 +66,8 @@ public:
     // ArrayPropertyWriter overrides
     virtual void setSample( const AbcA::ArraySample & iSamp );
     virtual void setFromPreviousSample();
+    virtual bool copySample( AbcA::ArrayPropertyReaderPtr iReader,
+                             index_t iSampleIndex );
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
 
@@ -75,6 +77,13 @@ public:
     virtual AbcA::CompoundPropertyWriterPtr getParent();
 
 protected:
+    // Writes a sample with the key iKey, either from iSamp, or from iStored
+    // which is the data as stored by another Ogawa archive.
+    void writeSample( const AbcA::ArraySample::Key & iKey,
+                      const AbcA::Dimensions & iDims,
+                      const AbcA::ArraySample * iSamp,
+                      const std::vector< Util::uint8_t > * iStored );
+
     // Previous written array sample identifier!
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
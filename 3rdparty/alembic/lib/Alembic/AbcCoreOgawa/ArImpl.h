@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
+#include <Alembic/AbcCoreOgawa/SampleBufferPool.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -105,9 +106,17 @@ public:
 
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
+    // NULL unless the archive was opened with a sample buffer pool
+    SampleBufferPoolPtr getSampleBufferPool() { return m_samplePool; }
+
 private:
     void init();
 
+    void setSampleBufferPool( SampleBufferPoolPtr iPool )
+    {
+        m_samplePool = iPool;
+    }
+
     std::string m_fileName;
     size_t m_numStreams;
 
@@ -127,6 +136,8 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    SampleBufferPoolPtr m_samplePool;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
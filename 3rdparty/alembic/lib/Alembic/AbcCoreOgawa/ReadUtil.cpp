@@ -1431,13 +1431,21 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample )
+                 AbcA::ArraySamplePtr &oSample,
+                 SampleBufferPoolPtr iPool )
 {
     // get our dimensions
     Util::Dimensions dims;
     ReadDimensions( iDims, iData, iThreadId, iDataType, dims );
 
-    oSample = AbcA::AllocateArraySample( iDataType, dims );
+    if ( iPool )
+    {
+        oSample = iPool->allocate( iDataType, dims );
+    }
+    else
+    {
+        oSample = AbcA::AllocateArraySample( iDataType, dims );
+    }
 
     ReadData( const_cast<void*>( oSample->getData() ), iData,
         iThreadId, iDataType, iDataType.getPod() );
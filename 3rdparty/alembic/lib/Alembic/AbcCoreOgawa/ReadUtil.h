@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_ReadUtil_h
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/SampleBufferPool.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -70,7 +71,8 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample );
+                 AbcA::ArraySamplePtr &oSample,
+                 SampleBufferPoolPtr iPool = SampleBufferPoolPtr() );
 
 //-*****************************************************************************
 void
@@ -38,6 +38,7 @@
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
 #include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/SampleBufferPool.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -73,6 +74,7 @@ ReadArchive::ReadArchive()
 {
     m_numStreams = 1;
     m_useMMap = true;
+    m_poolMaxBytes = 0;
 }
 
 //-*****************************************************************************
@@ -80,11 +82,13 @@ ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap )
 {
     m_numStreams = iNumStreams;
     m_useMMap = iUseMMap;
+    m_poolMaxBytes = 0;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
     : m_numStreams( 1 ), m_useMMap(true), m_streams( iStreams )
+    , m_poolMaxBytes( 0 )
 {
 }
 
@@ -92,7 +96,7 @@ ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    Alembic::Util::shared_ptr<ArImpl> archivePtr;
 
     if ( m_streams.empty() )
     {
@@ -104,6 +108,12 @@ ReadArchive::operator()( const std::string &iFileName ) const
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
             new ArImpl( m_streams ) );
     }
+
+    if ( m_poolMaxBytes > 0 )
+    {
+        archivePtr->setSampleBufferPool( SampleBufferPoolPtr(
+            new SampleBufferPool( m_poolMaxBytes ) ) );
+    }
     return archivePtr;
 }
 
@@ -113,19 +123,45 @@ AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    return ( *this )( iFileName );
+}
 
-    if ( m_streams.empty() )
+//-*****************************************************************************
+static SampleBufferPoolPtr GetPool( AbcA::ArchiveReaderPtr iArchive )
+{
+    Alembic::Util::shared_ptr<ArImpl> archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader >(
+            iArchive );
+
+    if ( archive )
     {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
+        return archive->getSampleBufferPool();
     }
-    else
+    return SampleBufferPoolPtr();
+}
+
+//-*****************************************************************************
+bool GetSampleBufferPoolStats( AbcA::ArchiveReaderPtr iArchive,
+                               SampleBufferPoolStats & oStats )
+{
+    SampleBufferPoolPtr pool = GetPool( iArchive );
+    if ( !pool )
     {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( m_streams ) );
+        return false;
+    }
+
+    oStats = pool->getStats();
+    return true;
+}
+
+//-*****************************************************************************
+void ResetSampleBufferPoolStats( AbcA::ArchiveReaderPtr iArchive )
+{
+    SampleBufferPoolPtr pool = GetPool( iArchive );
+    if ( pool )
+    {
+        pool->resetStats();
     }
-    return archivePtr;
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -77,6 +77,16 @@ public:
     // delete them
     ReadArchive( const std::vector< std::istream * > & iStreams );
 
+    // Recycle the buffers numeric array samples are read into, keeping up to
+    // iMaxBytes of released buffers per archive. 0, the default, turns the
+    // pool off.
+    void setSampleBufferPoolSize( size_t iMaxBytes )
+    {
+        m_poolMaxBytes = iMaxBytes;
+    }
+
+    size_t getSampleBufferPoolSize() const { return m_poolMaxBytes; }
+
     // open the file
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
@@ -91,8 +101,42 @@ private:
     size_t m_numStreams;
     bool m_useMMap;
     std::vector< std::istream * > m_streams;
+    size_t m_poolMaxBytes;
 };
 
+//-*****************************************************************************
+//! Counters for an archive's sample buffer pool.
+struct ALEMBIC_EXPORT SampleBufferPoolStats
+{
+    SampleBufferPoolStats();
+
+    //! Samples whose buffer came from the pool, and ones that had to
+    //! allocate a new buffer.
+    Alembic::Util::uint64_t hits;
+    Alembic::Util::uint64_t misses;
+
+    //! Released buffers kept for reuse, and ones freed because the pool
+    //! was full.
+    Alembic::Util::uint64_t recycled;
+    Alembic::Util::uint64_t discarded;
+
+    //! Bytes currently held on the free lists.
+    Alembic::Util::uint64_t cachedBytes;
+};
+
+//-*****************************************************************************
+//! Fills oStats for an Ogawa archive opened with a sample buffer pool.
+//! Returns false if the archive isn't Ogawa or has no pool.
+ALEMBIC_EXPORT bool
+GetSampleBufferPoolStats(
+    ::Alembic::AbcCoreAbstract::ArchiveReaderPtr iArchive,
+    SampleBufferPoolStats & oStats );
+
+//! Zeroes the counters, except cachedBytes, of an archive's pool.
+ALEMBIC_EXPORT void
+ResetSampleBufferPoolStats(
+    ::Alembic::AbcCoreAbstract::ArchiveReaderPtr iArchive );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -0,0 +1,223 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcCoreOgawa/SampleBufferPool.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+SampleBufferPoolStats::SampleBufferPoolStats()
+  : hits( 0 )
+  , misses( 0 )
+  , recycled( 0 )
+  , discarded( 0 )
+  , cachedBytes( 0 )
+{
+}
+
+//-*****************************************************************************
+// the smallest size class is 64 bytes, each power of two above it is split
+// into four evenly spaced classes, so a buffer is never more than a quarter
+// bigger than the sample in it
+static const std::size_t kMinLog2 = 6;
+static const std::size_t kStepsLog2 = 2;
+static const std::size_t kNumSteps = ( std::size_t ) 1 << kStepsLog2;
+
+//-*****************************************************************************
+static std::size_t SizeClassBytes( std::size_t iSizeClass )
+{
+    std::size_t log2 = kMinLog2 + iSizeClass / kNumSteps;
+    std::size_t step = iSizeClass % kNumSteps;
+    return ( kNumSteps + step ) << ( log2 - kStepsLog2 );
+}
+
+//-*****************************************************************************
+static std::size_t SizeClass( std::size_t iNumBytes )
+{
+    if ( iNumBytes <= ( ( std::size_t ) 1 << kMinLog2 ) )
+    {
+        return 0;
+    }
+
+    // iNumBytes is in ( 2^log2, 2^( log2 + 1 ) ]
+    std::size_t log2 = kMinLog2;
+    while ( ( ( std::size_t ) 1 << ( log2 + 1 ) ) < iNumBytes )
+    {
+        ++log2;
+    }
+
+    std::size_t stepBytes = ( std::size_t ) 1 << ( log2 - kStepsLog2 );
+    std::size_t step = ( iNumBytes - ( ( std::size_t ) 1 << log2 ) +
+                         stepBytes - 1 ) / stepBytes;
+
+    // the last step is the next power of two
+    return ( log2 - kMinLog2 ) * kNumSteps + step;
+}
+
+//-*****************************************************************************
+struct SampleBufferPool::Deleter
+{
+    Deleter( SampleBufferPoolPtr iPool, std::size_t iSizeClass )
+      : pool( iPool ), sizeClass( iSizeClass ) {}
+
+    void operator()( AbcA::ArraySample * iSample ) const
+    {
+        if ( iSample )
+        {
+            char * buffer = static_cast< char * >(
+                const_cast< void * >( iSample->getData() ) );
+
+            // the archive may already be gone
+            SampleBufferPoolPtr p = pool.lock();
+            if ( p )
+            {
+                p->release( buffer, sizeClass );
+            }
+            else
+            {
+                delete [] buffer;
+            }
+        }
+        delete iSample;
+    }
+
+    Alembic::Util::weak_ptr< SampleBufferPool > pool;
+    std::size_t sizeClass;
+};
+
+//-*****************************************************************************
+SampleBufferPool::SampleBufferPool( std::size_t iMaxBytes )
+    : m_maxBytes( iMaxBytes )
+    , m_free( ( sizeof( std::size_t ) * 8 - kMinLog2 ) * kNumSteps )
+{
+}
+
+//-*****************************************************************************
+SampleBufferPool::~SampleBufferPool()
+{
+    for ( std::size_t i = 0; i < m_free.size(); ++i )
+    {
+        for ( std::size_t j = 0; j < m_free[i].size(); ++j )
+        {
+            delete [] m_free[i][j];
+        }
+    }
+}
+
+//-*****************************************************************************
+AbcA::ArraySamplePtr
+SampleBufferPool::allocate( const AbcA::DataType &iDataType,
+                            const Util::Dimensions &iDims )
+{
+    Util::PlainOldDataType pod = iDataType.getPod();
+    std::size_t numBytes = iDims.numPoints() * iDataType.getNumBytes();
+
+    if ( pod == Util::kStringPOD || pod == Util::kWstringPOD ||
+         numBytes == 0 )
+    {
+        return AbcA::AllocateArraySample( iDataType, iDims );
+    }
+
+    std::size_t sizeClass = SizeClass( numBytes );
+    char * buffer = NULL;
+
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        std::vector< char * > & freeList = m_free[sizeClass];
+        if ( !freeList.empty() )
+        {
+            buffer = freeList.back();
+            freeList.pop_back();
+            m_stats.cachedBytes -= SizeClassBytes( sizeClass );
+            m_stats.hits ++;
+        }
+        else
+        {
+            m_stats.misses ++;
+        }
+    }
+
+    if ( !buffer )
+    {
+        buffer = new char[ SizeClassBytes( sizeClass ) ];
+    }
+
+    return AbcA::ArraySamplePtr(
+        new AbcA::ArraySample( buffer, iDataType, iDims ),
+        Deleter( shared_from_this(), sizeClass ) );
+}
+
+//-*****************************************************************************
+void SampleBufferPool::release( char * iBuffer, std::size_t iSizeClass )
+{
+    std::size_t numBytes = SizeClassBytes( iSizeClass );
+
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        if ( m_stats.cachedBytes + numBytes <= m_maxBytes )
+        {
+            m_free[iSizeClass].push_back( iBuffer );
+            m_stats.cachedBytes += numBytes;
+            m_stats.recycled ++;
+            return;
+        }
+
+        m_stats.discarded ++;
+    }
+
+    delete [] iBuffer;
+}
+
+//-*****************************************************************************
+SampleBufferPoolStats SampleBufferPool::getStats()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_stats;
+}
+
+//-*****************************************************************************
+void SampleBufferPool::resetStats()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    Util::uint64_t cachedBytes = m_stats.cachedBytes;
+    m_stats = SampleBufferPoolStats();
+    m_stats.cachedBytes = cachedBytes;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
@@ -0,0 +1,94 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcCoreOgawa_SampleBufferPool_h
+#define Alembic_AbcCoreOgawa_SampleBufferPool_h
+
+#include <Alembic/AbcCoreOgawa/Foundation.h>
+#include <Alembic/AbcCoreOgawa/ReadWrite.h>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+class SampleBufferPool;
+typedef Alembic::Util::shared_ptr< SampleBufferPool > SampleBufferPoolPtr;
+
+//-*****************************************************************************
+// Recycles the buffers that numeric array samples are read into. Buffers are
+// rounded up to a size class, four to each power of two, and when the last
+// reference to a sample goes away its buffer goes back onto the free list for
+// its class instead of being deleted. At most iMaxBytes are kept on the free
+// lists, anything returned past that is freed. Buffers still held by samples
+// don't count against iMaxBytes.
+class SampleBufferPool
+    : Alembic::Util::noncopyable
+    , public Alembic::Util::enable_shared_from_this< SampleBufferPool >
+{
+public:
+    SampleBufferPool( std::size_t iMaxBytes );
+    ~SampleBufferPool();
+
+    // String and wstring samples, and empty ones, are allocated the usual way.
+    AbcA::ArraySamplePtr allocate( const AbcA::DataType &iDataType,
+                                   const Util::Dimensions &iDims );
+
+    SampleBufferPoolStats getStats();
+
+    void resetStats();
+
+private:
+    struct Deleter;
+    friend struct Deleter;
+
+    void release( char * iBuffer, std::size_t iSizeClass );
+
+    std::size_t m_maxBytes;
+
+    // free buffers, indexed by size class
+    std::vector< std::vector< char * > > m_free;
+
+    SampleBufferPoolStats m_stats;
+    Alembic::Util::mutex m_lock;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -139,8 +139,16 @@ void SpwImpl::setSample( const void *iSamp )
     AbcA::ArraySample samp( iSamp, m_header->header.getDataType(),
                             AbcA::Dimensions(1) );
 
+    // strings are laid out once and hashed from, and written from, the
+    // same buffer
+    Alembic::Util::PlainOldDataType pod = samp.getDataType().getPod();
+    bool isString = ( pod == Alembic::Util::kStringPOD ||
+                      pod == Alembic::Util::kWstringPOD );
+    std::vector< Util::uint8_t > strData;
+
      // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = samp.getKey();
+     AbcA::ArraySample::Key key = isString ?
+        SerializeStrings( samp, strData ) : samp.getKey();
 
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
@@ -177,8 +185,17 @@ void SpwImpl::setSample( const void *iSamp )
 
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, samp, key );
+        if ( isString )
+        {
+            m_previousWrittenSampleID =
+                WriteStoredData( GetWrittenSampleMap( awp ), m_group,
+                    strData, key, m_header->header.getDataType().getExtent() );
+        }
+        else
+        {
+            m_previousWrittenSampleID =
+                WriteData( GetWrittenSampleMap( awp ), m_group, samp, key );
+        }
 
         if (m_header->firstChangedIndex == 0)
         {
@@ -0,0 +1,226 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+//-*****************************************************************************
+// Counts every heap allocation made by this process, so we can see how many
+// the read and write hot paths cost per sample.
+static size_t g_numAllocs = 0;
+
+void * operator new( std::size_t iSize )
+{
+    ++g_numAllocs;
+    void * p = std::malloc( iSize ? iSize : 1 );
+    if ( !p )
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void * operator new[]( std::size_t iSize )
+{
+    return operator new( iSize );
+}
+
+void operator delete( void * iPtr ) throw()
+{
+    std::free( iPtr );
+}
+
+void operator delete[]( void * iPtr ) throw()
+{
+    std::free( iPtr );
+}
+
+void operator delete( void * iPtr, std::size_t ) throw()
+{
+    std::free( iPtr );
+}
+
+void operator delete[]( void * iPtr, std::size_t ) throw()
+{
+    std::free( iPtr );
+}
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void testDimensionsAllocs()
+{
+    size_t start = g_numAllocs;
+    {
+        Dimensions rank1( 35 );
+        Dimensions rank1Copy( rank1 );
+
+        Dimensions rank2;
+        rank2.setRank( 2 );
+        rank2[0] = 10;
+        rank2[1] = 3;
+        rank1Copy = rank2;
+
+        BaseDimensions<int> intDims( rank2 );
+        TESTING_ASSERT( intDims == rank2 );
+    }
+
+    // rank 2 and lower stay inline
+    TESTING_ASSERT( g_numAllocs == start );
+
+    {
+        Dimensions rank3;
+        rank3.setRank( 3 );
+    }
+
+    TESTING_ASSERT( g_numAllocs == start + 1 );
+}
+
+//-*****************************************************************************
+void testHotPathAllocs( bool iUseMMap )
+{
+    std::string archiveName = "allocationCount.abc";
+
+    const size_t numSamples = 1000;
+    const size_t numVals = 35;
+
+    std::vector< Alembic::Util::int32_t > vals( numVals );
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w( archiveName, ABCA::MetaData() );
+        ABCA::ObjectWriterPtr archive = a->getTop();
+
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty( "a", ABCA::MetaData(), i32d, 0 );
+
+        size_t start = g_numAllocs;
+        for ( size_t i = 0; i < numSamples; ++i )
+        {
+            vals[0] = i;
+            Dimensions dims( numVals );
+            awp->setSample( ABCA::ArraySample( &vals.front(), i32d, dims ) );
+        }
+
+        std::cout << "write: " << double( g_numAllocs - start ) / numSamples
+                  << " allocations per setSample" << std::endl;
+    }
+
+    {
+        AO::ReadArchive r( 1, iUseMMap );
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::ObjectReaderPtr archive = a->getTop();
+        ABCA::CompoundPropertyReaderPtr parent = archive->getProperties();
+        ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty( "a" );
+
+        TESTING_ASSERT( ap->getNumSamples() == numSamples );
+
+        size_t start = g_numAllocs;
+        for ( size_t i = 0; i < numSamples; ++i )
+        {
+            Dimensions dims;
+            ap->getDimensions( i, dims );
+            TESTING_ASSERT( dims.numPoints() == numVals );
+        }
+
+        std::cout << "read: " << double( g_numAllocs - start ) / numSamples
+                  << " allocations per getDimensions" << std::endl;
+
+        start = g_numAllocs;
+        for ( size_t i = 0; i < numSamples; ++i )
+        {
+            ABCA::ArraySamplePtr samp;
+            ap->getSample( i, samp );
+            TESTING_ASSERT( samp->getDimensions().numPoints() == numVals );
+            TESTING_ASSERT( ( ( Alembic::Util::int32_t * )
+                              samp->getData() )[0] == ( int ) i );
+        }
+
+        std::cout << "read: " << double( g_numAllocs - start ) / numSamples
+                  << " allocations per getSample" << std::endl;
+    }
+
+    {
+        AO::ReadArchive r( 1, iUseMMap );
+        r.setSampleBufferPoolSize( 1024 * 1024 );
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::ObjectReaderPtr archive = a->getTop();
+        ABCA::CompoundPropertyReaderPtr parent = archive->getProperties();
+        ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty( "a" );
+
+        size_t start = g_numAllocs;
+        for ( size_t i = 0; i < numSamples; ++i )
+        {
+            ABCA::ArraySamplePtr samp;
+            ap->getSample( i, samp );
+            TESTING_ASSERT( ( ( Alembic::Util::int32_t * )
+                              samp->getData() )[0] == ( int ) i );
+        }
+
+        AO::SampleBufferPoolStats stats;
+        TESTING_ASSERT( AO::GetSampleBufferPoolStats( a, stats ) );
+        TESTING_ASSERT( stats.hits == numSamples - 1 );
+        TESTING_ASSERT( stats.misses == 1 );
+
+        std::cout << "pooled read: "
+                  << double( g_numAllocs - start ) / numSamples
+                  << " allocations per getSample" << std::endl;
+    }
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    testDimensionsAllocs();
+    testHotPathAllocs( true );     // Use mmap
+    testHotPathAllocs( false );    // Use streams
+    return 0;
+}
@@ -2017,6 +2017,106 @@ void testBigData(bool iUseMMap)
     }
 }
 
+//-*****************************************************************************
+void testSampleBufferPool(bool iUseMMap)
+{
+    std::string archiveName = "sampleBufferPool.abc";
+
+    std::vector <Alembic::Util::int32_t> vali(100);
+    std::vector <std::string> vals(3, "pooled");
+    ABCA::DataType i32d(Alembic::Util::kInt32POD, 1);
+    ABCA::DataType strd(Alembic::Util::kStringPOD, 1);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
+        ABCA::ObjectWriterPtr archive = a->getTop();
+        ABCA::CompoundPropertyWriterPtr parent = archive->getProperties();
+
+        ABCA::ArrayPropertyWriterPtr awp =
+            parent->createArrayProperty("a", ABCA::MetaData(), i32d, 0);
+        ABCA::ArrayPropertyWriterPtr swp =
+            parent->createArrayProperty("s", ABCA::MetaData(), strd, 0);
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            vali[0] = i;
+            awp->setSample(ABCA::ArraySample(&(vali.front()), i32d,
+                                             Dimensions(vali.size())));
+        }
+
+        swp->setSample(ABCA::ArraySample(&(vals.front()), strd,
+                                         Dimensions(vals.size())));
+    }
+
+    // a pool big enough to keep one buffer, 400 bytes of samples are
+    // rounded up to 448 rather than 512
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        r.setSampleBufferPoolSize(800);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+        ABCA::ArrayPropertyReaderPtr ap = parent->getArrayProperty("a");
+
+        ABCA::ArraySamplePtr held;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            ABCA::ArraySamplePtr samp;
+            ap->getSample(i, samp);
+            TESTING_ASSERT(samp->getDimensions().numPoints() == vali.size());
+            TESTING_ASSERT(
+                ((Alembic::Util::int32_t *)samp->getData())[0] == (int)i);
+
+            // keep sample 1 alive past the others
+            if (i == 1)
+            {
+                held = samp;
+            }
+        }
+
+        AO::SampleBufferPoolStats stats;
+        TESTING_ASSERT(AO::GetSampleBufferPoolStats(a, stats));
+        TESTING_ASSERT(stats.misses == 2);
+        TESTING_ASSERT(stats.hits == 2);
+        TESTING_ASSERT(stats.recycled == 3);
+        TESTING_ASSERT(stats.cachedBytes == 448);
+
+        // no room for a second buffer
+        held.reset();
+        TESTING_ASSERT(AO::GetSampleBufferPoolStats(a, stats));
+        TESTING_ASSERT(stats.discarded == 1);
+        TESTING_ASSERT(stats.cachedBytes == 448);
+
+        // strings don't go through the pool
+        ABCA::ArrayPropertyReaderPtr sp = parent->getArrayProperty("s");
+        ABCA::ArraySamplePtr strSamp;
+        sp->getSample(0, strSamp);
+        TESTING_ASSERT(((std::string *)strSamp->getData())[2] == "pooled");
+
+        AO::ResetSampleBufferPoolStats(a);
+        TESTING_ASSERT(AO::GetSampleBufferPoolStats(a, stats));
+        TESTING_ASSERT(stats.hits == 0 && stats.misses == 0);
+        TESTING_ASSERT(stats.cachedBytes == 448);
+
+        // samples can outlive the archive and its pool
+        ap->getSample(3, held);
+        ap.reset();
+        sp.reset();
+        parent.reset();
+        a.reset();
+        TESTING_ASSERT(
+            ((Alembic::Util::int32_t *)held->getData())[0] == 3);
+    }
+
+    // no pool by default
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r( archiveName );
+        AO::SampleBufferPoolStats stats;
+        TESTING_ASSERT(!AO::GetSampleBufferPoolStats(a, stats));
+    }
+}
+
 void runTests(bool iUseMMap)
 {
     testEmptyArray(iUseMMap);
@@ -2025,6 +2125,7 @@ void runTests(bool iUseMMap)
     testExtentArrayStrings(iUseMMap);
     testArrayStringsRepeats(iUseMMap);
     testArraySamples(iUseMMap);
+    testSampleBufferPool(iUseMMap);
 
     if (!iUseMMap)
     {
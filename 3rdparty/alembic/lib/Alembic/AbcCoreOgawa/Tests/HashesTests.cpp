@@ -728,22 +728,30 @@ void testObjectHashes(bool iUseMMap)
 void testStringHashes(bool iUseMMap)
 {
     std::string archiveName = "stringsHashTest.abc";
+
+    ABCA::DataType wdtype(Alembic::Util::kWstringPOD, 1);
+    std::vector < Alembic::Util::wstring > wvals(4);
+    wvals[0] = L"Mash potatoes ";
+    wvals[1] = L"with some delicious gravy.";
+    wvals[2] = L"";
+    wvals[3] = L"\uf8e4 \uf8e2 \uf8d3";
+
+    ABCA::DataType sdtype(Alembic::Util::kStringPOD, 1);
+    std::vector < Alembic::Util::string > svals(4);
+    svals[0] = "Sunday, Monday";
+    svals[1] = "Tuesday, Wednesday, Thursday";
+    svals[2] = "";
+    svals[3] = "Some other days";
+
     {
         AO::WriteArchive w;
         ABCA::ArchiveWriterPtr a = w(archiveName, ABCA::MetaData());
         ABCA::ObjectWriterPtr archive = a->getTop();
         ABCA::CompoundPropertyWriterPtr props = archive->getProperties();
 
-        ABCA::DataType wdtype(Alembic::Util::kWstringPOD, 1);
         ABCA::ArrayPropertyWriterPtr wstrWrtPtr =
             props->createArrayProperty("wstr", ABCA::MetaData(), wdtype, 0);
 
-        std::vector < Alembic::Util::wstring > wvals(4);
-        wvals[0] = L"Mash potatoes ";
-        wvals[1] = L"with some delicious gravy.";
-        wvals[2] = L"";
-        wvals[3] = L"\uf8e4 \uf8e2 \uf8d3";
-
         for (size_t i = 0; i < wvals.size(); ++i)
         {
             Alembic::Util::Dimensions wdims(i);
@@ -751,16 +759,9 @@ void testStringHashes(bool iUseMMap)
                 ABCA::ArraySample(&(wvals.front()), wdtype, wdims));
         }
 
-        ABCA::DataType sdtype(Alembic::Util::kStringPOD, 1);
         ABCA::ArrayPropertyWriterPtr strWrtPtr =
             props->createArrayProperty("str", ABCA::MetaData(), sdtype, 0);
 
-        std::vector < Alembic::Util::string > svals(4);
-        svals[0] = "Sunday, Monday";
-        svals[1] = "Tuesday, Wednesday, Thursday";
-        svals[2] = "";
-        svals[3] = "Some other days";
-
         for (size_t i = 0; i < svals.size(); ++i)
         {
             Alembic::Util::Dimensions sdims(i);
@@ -779,6 +780,11 @@ void testStringHashes(bool iUseMMap)
         for (size_t i = 0; i < wap->getNumSamples(); ++i)
         {
             wap->getKey( (ABCA::index_t) i, keys[i] );
+
+            // what was stored is what the sample hashes to in memory
+            Alembic::Util::Dimensions wdims(i);
+            TESTING_ASSERT( keys[i].digest == ABCA::ArraySample(
+                &(wvals.front()), wdtype, wdims).getKey().digest );
         }
 
         for (size_t i = 0; i < keys.size(); ++i)
@@ -794,6 +800,10 @@ void testStringHashes(bool iUseMMap)
         for (size_t i = 0; i < sap->getNumSamples(); ++i)
         {
             sap->getKey( (ABCA::index_t) i, keys[i] );
+
+            Alembic::Util::Dimensions sdims(i);
+            TESTING_ASSERT( keys[i].digest == ABCA::ArraySample(
+                &(svals.front()), sdtype, sdims).getKey().digest );
         }
 
         for (size_t i = 0; i < keys.size(); ++i)
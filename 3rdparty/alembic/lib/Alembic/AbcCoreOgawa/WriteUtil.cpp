@@ -178,6 +178,93 @@ void WriteDimensions( Ogawa::OGroupPtr iGroup,
                      ( const void * )iDims.rootPtr() );
 }
 
+//-*****************************************************************************
+AbcA::ArraySample::Key
+SerializeStrings( const AbcA::ArraySample &iSamp,
+                  std::vector< Util::uint8_t > &oData )
+{
+    const AbcA::DataType &dataType = iSamp.getDataType();
+    size_t numPods = dataType.getExtent() * iSamp.getDimensions().numPoints();
+
+    AbcA::ArraySample::Key key;
+    key.numBytes = dataType.getNumBytes() * iSamp.getDimensions().numPoints();
+    key.origPOD = dataType.getPod();
+    key.readPOD = key.origPOD;
+
+    if ( dataType.getPod() == Alembic::Util::kStringPOD )
+    {
+        const std::string * strs =
+            static_cast<const std::string*>( iSamp.getData() );
+
+        size_t numChars = 0;
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            ABCA_ASSERT( strs[j].find( '\0' ) == std::string::npos,
+                     "Illegal NULL character found in string data " );
+
+            // plus a 0 for the NULL seperator character
+            numChars += strs[j].length() + 1;
+        }
+
+        oData.resize( 16 + numChars );
+        Util::uint8_t * ptr = &oData.front() + 16;
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            size_t strLen = strs[j].length();
+            if ( strLen > 0 )
+            {
+                memcpy( ptr, strs[j].data(), strLen );
+            }
+            ptr[strLen] = 0;
+            ptr += strLen + 1;
+        }
+
+        Util::MurmurHash3_x64_128( &oData.front() + 16, numChars,
+                                   sizeof( Util::int8_t ), key.digest.words );
+    }
+    else
+    {
+        ABCA_ASSERT( dataType.getPod() == Alembic::Util::kWstringPOD,
+                     "SerializeStrings called on " << dataType );
+
+        const std::wstring * wstrs =
+            static_cast<const std::wstring*>( iSamp.getData() );
+
+        size_t numChars = 0;
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            wchar_t nullChar = 0;
+            ABCA_ASSERT( wstrs[j].find( nullChar ) == std::wstring::npos,
+                     "Illegal NULL character found in wstring data" );
+
+            numChars += wstrs[j].length() + 1;
+        }
+
+        oData.resize( 16 + numChars * sizeof( Util::int32_t ) );
+        Util::uint8_t * ptr = &oData.front() + 16;
+        for ( size_t j = 0; j < numPods; ++j )
+        {
+            const std::wstring &wstr = wstrs[j];
+            size_t strLen = wstr.length();
+            for ( size_t k = 0; k <= strLen; ++k )
+            {
+                Util::int32_t c = k < strLen ? wstr[k] : 0;
+                memcpy( ptr, &c, sizeof( Util::int32_t ) );
+                ptr += sizeof( Util::int32_t );
+            }
+        }
+
+        // only the first numChars bytes are hashed, as ArraySample::getKey
+        // does
+        Util::MurmurHash3_x64_128( &oData.front() + 16, numChars,
+                                   sizeof( Util::int32_t ),
+                                   key.digest.words );
+    }
+
+    memcpy( &oData.front(), key.digest.d, 16 );
+    return key;
+}
+
 //-*****************************************************************************
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
@@ -203,59 +290,12 @@ WriteData( WrittenSampleMap &iMap,
 
     const AbcA::DataType &dataType = iSamp.getDataType();
 
-    if ( dataType.getPod() == Alembic::Util::kStringPOD )
+    if ( dataType.getPod() == Alembic::Util::kStringPOD ||
+         dataType.getPod() == Alembic::Util::kWstringPOD )
     {
-        size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int8_t> v;
-        for ( size_t j = 0; j < numPods; ++j )
-        {
-            const std::string &str =
-                static_cast<const std::string*>( iSamp.getData() )[j];
-
-            ABCA_ASSERT( str.find( '\0' ) == std::string::npos,
-                     "Illegal NULL character found in string data " );
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
-        }
-
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
-    }
-    else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
-    {
-        size_t numPods = dataType.getExtent() * dims.numPoints();
-        std::vector <Util::int32_t> v;
-        for ( size_t j = 0; j < numPods; ++j )
-        {
-            const std::wstring &str =
-                static_cast<const std::wstring*>( iSamp.getData() )[j];
-
-            wchar_t nullChar = 0;
-            ABCA_ASSERT( str.find( nullChar ) == std::wstring::npos,
-                     "Illegal NULL character found in wstring data" );
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
-        }
-
-        const void * datas[2] = { &iKey.digest, &v.front() };
-        Alembic::Util::uint64_t sizes[2] = { 16,
-            v.size() * sizeof(Util::int32_t) };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        std::vector< Util::uint8_t > data;
+        SerializeStrings( iSamp, data );
+        dataPtr = iGroup->addData( data.size(), &data.front() );
     }
     else
     {
@@ -273,6 +313,29 @@ WriteData( WrittenSampleMap &iMap,
     return writeID;
 }
 
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteStoredData( WrittenSampleMap &iMap,
+                 Ogawa::OGroupPtr iGroup,
+                 const std::vector< Util::uint8_t > &iData,
+                 const AbcA::ArraySample::Key &iKey,
+                 std::size_t iNumPods )
+{
+    WrittenSampleIDPtr writeID = iMap.find( iKey );
+    if ( writeID )
+    {
+        CopyWrittenData( iGroup, writeID );
+        return writeID;
+    }
+
+    Ogawa::ODataPtr dataPtr = iGroup->addData( iData.size(), &iData.front() );
+
+    writeID.reset( new WrittenSampleID( iKey, dataPtr, iNumPods ) );
+    iMap.store( writeID );
+
+    return writeID;
+}
+
 //-*****************************************************************************
 void CopyWrittenData( Ogawa::OGroupPtr iGroup,
                       WrittenSampleIDPtr iRef )
@@ -70,6 +70,16 @@ void
 CopyWrittenData( Ogawa::OGroupPtr iParent,
                  WrittenSampleIDPtr iRef );
 
+//-*****************************************************************************
+// Lays out the elements of a string or wstring sample the way they are
+// stored, each followed by a 0, behind 16 bytes for the digest.  oData is
+// sized once up front, and the returned key (which is the same as
+// iSamp.getKey()) is hashed from those bytes and copied into the front, so
+// the result can go straight to WriteStoredData.
+AbcA::ArraySample::Key
+SerializeStrings( const AbcA::ArraySample &iSamp,
+                  std::vector< Util::uint8_t > &oData );
+
 //-*****************************************************************************
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
@@ -77,6 +87,16 @@ WriteData( WrittenSampleMap &iMap,
            const AbcA::ArraySample &iSamp,
            const AbcA::ArraySample::Key &iKey );
 
+//-*****************************************************************************
+// Like WriteData, but for data that already has iKey's digest stored in its
+// first 16 bytes, as read from another Ogawa archive.
+WrittenSampleIDPtr
+WriteStoredData( WrittenSampleMap &iMap,
+                 Ogawa::OGroupPtr iGroup,
+                 const std::vector< Util::uint8_t > &iData,
+                 const AbcA::ArraySample::Key &iKey,
+                 std::size_t iNumPods );
+
 //-*****************************************************************************
 void
 WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
@@ -45,12 +45,15 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcGeom/OCurves.h>
 #include <Alembic/AbcGeom/ICurves.h>
+#include <Alembic/AbcGeom/CurveStrands.h>
 
 #include <Alembic/AbcGeom/OFaceSet.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
+#include <Alembic/AbcGeom/FaceSetRuns.h>
 
 #include <Alembic/AbcGeom/IGeomBase.h>
 #include <Alembic/AbcGeom/OGeomBase.h>
+#include <Alembic/AbcGeom/SampleReadBatch.h>
 
 #include <Alembic/AbcGeom/OGeomParam.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
@@ -71,6 +74,9 @@
 
 #include <Alembic/AbcGeom/OPolyMesh.h>
 #include <Alembic/AbcGeom/IPolyMesh.h>
+#include <Alembic/AbcGeom/PolyMeshLod.h>
+#include <Alembic/AbcGeom/PolyMeshNormals.h>
+#include <Alembic/AbcGeom/PositionsDelta.h>
 
 #include <Alembic/AbcGeom/OSubD.h>
 #include <Alembic/AbcGeom/ISubD.h>
@@ -0,0 +1,187 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/CurveStrands.h>
+#include <Alembic/AbcGeom/SampleCache.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+typedef SampleCache< AbcA::ArraySampleKey, Abc::UInt64ArraySamplePtr >
+    CurveOffsetsCache;
+
+CurveOffsetsCache & getCurveOffsetsCache()
+{
+    static CurveOffsetsCache cache( 64 * 1024 * 1024 );
+    return cache;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Abc::UInt64ArraySamplePtr
+ComputeCurveOffsets( const Abc::Int32ArraySample &iNumVertices )
+{
+    const size_t numCurves = iNumVertices.size();
+
+    Util::uint64_t * offsets = new Util::uint64_t[numCurves + 1];
+    Abc::UInt64ArraySamplePtr result(
+        new Abc::UInt64ArraySample( offsets, numCurves + 1 ),
+        AbcA::TArrayDeleter<Util::uint64_t>() );
+
+    offsets[0] = 0;
+    for ( size_t i = 0; i < numCurves; ++i )
+    {
+        ABCA_ASSERT( iNumVertices[i] >= 0,
+                     "Negative number of vertices on a curve" );
+        offsets[i + 1] = offsets[i] + iNumVertices[i];
+    }
+
+    return result;
+}
+
+//-*****************************************************************************
+Abc::UInt64ArraySamplePtr
+GetCachedCurveOffsets( const Abc::IInt32ArrayProperty &iNumVertices,
+                       const Abc::ISampleSelector &iSS )
+{
+    AbcA::ArraySampleKey key;
+    bool hasKey = iNumVertices.getKey( key, iSS );
+
+    CurveOffsetsCache &cache = getCurveOffsetsCache();
+    if ( hasKey )
+    {
+        Abc::UInt64ArraySamplePtr found = cache.find( key );
+        if ( found )
+        {
+            return found;
+        }
+    }
+
+    Abc::UInt64ArraySamplePtr result =
+        ComputeCurveOffsets( *iNumVertices.getValue( iSS ) );
+
+    if ( hasKey )
+    {
+        cache.insert( key, result );
+    }
+
+    return result;
+}
+
+//-*****************************************************************************
+void SetCurveOffsetsCacheMaxBytes( size_t iMaxBytes )
+{
+    getCurveOffsetsCache().setMaxBytes( iMaxBytes );
+}
+
+//-*****************************************************************************
+void ClearCurveOffsetsCache()
+{
+    getCurveOffsetsCache().clear();
+}
+
+//-*****************************************************************************
+CurveStrands::CurveStrands( Abc::P3fArraySamplePtr iPositions,
+                            Abc::UInt64ArraySamplePtr iOffsets )
+    : m_positions( iPositions )
+    , m_offsets( iOffsets )
+    , m_begin( 0 )
+    , m_end( 0 )
+{
+    ABCA_ASSERT( m_positions && m_offsets && m_offsets->size() > 0,
+                 "Curve strands need positions and offsets" );
+
+    m_end = m_offsets->size() - 1;
+
+    ABCA_ASSERT( ( *m_offsets )[m_end] <= m_positions->size(),
+                 "Curves have more vertices than there are positions" );
+}
+
+//-*****************************************************************************
+CurveStrands CurveStrands::getRange( size_t iBegin, size_t iEnd ) const
+{
+    ABCA_ASSERT( iBegin <= iEnd && iEnd <= getNumCurves(),
+                 "Curve range out of bounds" );
+
+    CurveStrands range( *this );
+    range.m_begin = m_begin + iBegin;
+    range.m_end = m_begin + iEnd;
+    return range;
+}
+
+//-*****************************************************************************
+void CurveStrands::split( size_t iNumRanges,
+                          std::vector<CurveStrands> &oRanges ) const
+{
+    oRanges.clear();
+
+    const size_t numCurves = getNumCurves();
+    if ( numCurves == 0 || iNumRanges == 0 )
+    {
+        return;
+    }
+
+    const Util::uint64_t * offsets = m_offsets->get();
+    const Util::uint64_t first = offsets[m_begin];
+    const Util::uint64_t total = offsets[m_end] - first;
+
+    size_t begin = m_begin;
+    for ( size_t r = 1; r <= iNumRanges && begin < m_end; ++r )
+    {
+        // the first curve starting at or after this range's share
+        size_t end = m_end;
+        if ( r < iNumRanges )
+        {
+            Util::uint64_t target = first + ( total * r ) / iNumRanges;
+            end = std::lower_bound( offsets + begin + 1, offsets + m_end,
+                                    target ) - offsets;
+        }
+
+        if ( end > begin )
+        {
+            oRanges.push_back( getRange( begin - m_begin, end - m_begin ) );
+            begin = end;
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,138 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_CurveStrands_h
+#define Alembic_AbcGeom_CurveStrands_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Computes where each curve starts in the positions, from the number of
+//! vertices per curve.  The result has one more entry than there are
+//! curves, the last being the total number of vertices.
+ALEMBIC_EXPORT Abc::UInt64ArraySamplePtr
+ComputeCurveOffsets( const Abc::Int32ArraySample &iNumVertices );
+
+//! Like ComputeCurveOffsets, but shared through a process wide cache keyed
+//! on the nVertices sample digest, so curves whose topology doesn't change
+//! only compute it once.  Samples whose keys aren't available are computed
+//! without being cached.
+ALEMBIC_EXPORT Abc::UInt64ArraySamplePtr
+GetCachedCurveOffsets( const Abc::IInt32ArrayProperty &iNumVertices,
+                       const Abc::ISampleSelector &iSS =
+                       Abc::ISampleSelector() );
+
+//! Limits how many bytes of offsets the cache holds on to, the oldest
+//! entries are dropped first.  0 disables the cache.  Defaults to 64 MB.
+ALEMBIC_EXPORT void SetCurveOffsetsCacheMaxBytes( size_t iMaxBytes );
+
+//! Drops everything held by the curve offsets cache.
+ALEMBIC_EXPORT void ClearCurveOffsetsCache();
+
+//-*****************************************************************************
+//! A view of a contiguous range of curves, sharing the positions and
+//! offsets it was made from rather than copying them.  Views of disjoint
+//! ranges can be handed to different threads.
+class ALEMBIC_EXPORT CurveStrands
+{
+public:
+    CurveStrands() : m_begin( 0 ), m_end( 0 ) {}
+
+    //! A view of every curve.  Throws if the offsets run past the end of
+    //! the positions.
+    CurveStrands( Abc::P3fArraySamplePtr iPositions,
+                  Abc::UInt64ArraySamplePtr iOffsets );
+
+    size_t getNumCurves() const { return m_end - m_begin; }
+
+    //! The index of the first curve in the view, within the whole sample.
+    size_t getFirstCurve() const { return m_begin; }
+
+    //! The number of vertices of curve iCurve of this view.
+    size_t getNumVertices( size_t iCurve ) const
+    {
+        return ( *m_offsets )[m_begin + iCurve + 1] -
+            ( *m_offsets )[m_begin + iCurve];
+    }
+
+    //! Where curve iCurve of this view starts in the whole positions sample.
+    size_t getStrandStart( size_t iCurve ) const
+    {
+        return ( *m_offsets )[m_begin + iCurve];
+    }
+
+    //! The positions of curve iCurve of this view.
+    const V3f * getStrand( size_t iCurve ) const
+    {
+        return m_positions->get() + getStrandStart( iCurve );
+    }
+
+    //! The number of vertices of all the curves in this view.
+    size_t getTotalVertices() const
+    {
+        return getNumCurves() == 0 ? 0 :
+            ( *m_offsets )[m_end] - ( *m_offsets )[m_begin];
+    }
+
+    //! A view of curves [iBegin, iEnd) of this view.
+    CurveStrands getRange( size_t iBegin, size_t iEnd ) const;
+
+    //! Splits this view into at most iNumRanges disjoint, non-empty views
+    //! with about the same number of vertices each.
+    void split( size_t iNumRanges, std::vector<CurveStrands> &oRanges ) const;
+
+    Abc::P3fArraySamplePtr getPositions() const { return m_positions; }
+    Abc::UInt64ArraySamplePtr getOffsets() const { return m_offsets; }
+
+private:
+    Abc::P3fArraySamplePtr m_positions;
+    Abc::UInt64ArraySamplePtr m_offsets;
+    size_t m_begin;
+    size_t m_end;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,193 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/FaceSetRuns.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+FaceSetRuns::FaceSetRuns( const Abc::Int32ArraySample &iFaces )
+    : m_numFaces( 0 )
+{
+    if ( iFaces.size() == 0 )
+    {
+        return;
+    }
+
+    std::vector<int32_t> faces( iFaces.get(), iFaces.get() + iFaces.size() );
+
+    // face sets are usually written in order already
+    bool sorted = true;
+    for ( size_t i = 1; i < faces.size() && sorted; ++i )
+    {
+        sorted = faces[i - 1] <= faces[i];
+    }
+
+    if ( !sorted )
+    {
+        std::sort( faces.begin(), faces.end() );
+    }
+
+    // in 64 bits, so neither the next face nor the run length can overflow
+    int64_t start = faces[0];
+    int64_t last = faces[0];
+    for ( size_t i = 1; i < faces.size(); ++i )
+    {
+        if ( faces[i] == last )
+        {
+            continue;
+        }
+
+        if ( faces[i] != last + 1 )
+        {
+            addRun( start, last + 1 );
+            start = faces[i];
+        }
+        last = faces[i];
+    }
+
+    addRun( start, last + 1 );
+}
+
+//-*****************************************************************************
+void FaceSetRuns::addRun( int64_t iStart, int64_t iEnd )
+{
+    // a run from a negative face up to a large one can be longer than an
+    // int32_t holds, so split it
+    const int64_t maxLength = std::numeric_limits<int32_t>::max();
+    while ( iStart < iEnd )
+    {
+        int64_t length = std::min( iEnd - iStart, maxLength );
+        m_runs.push_back( ( int32_t ) iStart );
+        m_runs.push_back( ( int32_t ) length );
+        m_numFaces += ( size_t ) length;
+        iStart += length;
+    }
+}
+
+//-*****************************************************************************
+FaceSetRuns FaceSetRuns::fromRuns( const Abc::Int32ArraySample &iRuns )
+{
+    ABCA_ASSERT( iRuns.size() % 2 == 0,
+                 "Face runs must be ( first face, number of faces ) pairs" );
+
+    FaceSetRuns runs;
+    runs.m_runs.assign( iRuns.get(), iRuns.get() + iRuns.size() );
+
+    int64_t end = std::numeric_limits<int64_t>::min();
+    for ( size_t i = 0; i < runs.m_runs.size(); i += 2 )
+    {
+        ABCA_ASSERT( runs.m_runs[i + 1] > 0 && runs.m_runs[i] >= end,
+                     "Face runs must be sorted and not overlap" );
+        end = ( int64_t ) runs.m_runs[i] + runs.m_runs[i + 1];
+        ABCA_ASSERT( end - 1 <= std::numeric_limits<int32_t>::max(),
+                     "Face runs must not go past the largest face number" );
+        runs.m_numFaces += runs.m_runs[i + 1];
+    }
+
+    return runs;
+}
+
+//-*****************************************************************************
+bool FaceSetRuns::contains( int32_t iFace ) const
+{
+    // find the last run starting at or before iFace
+    size_t lo = 0;
+    size_t hi = getNumRuns();
+    while ( lo < hi )
+    {
+        size_t mid = lo + ( hi - lo ) / 2;
+        if ( m_runs[mid * 2] <= iFace )
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if ( lo == 0 )
+    {
+        return false;
+    }
+
+    int64_t offset = ( int64_t ) iFace - m_runs[( lo - 1 ) * 2];
+    return offset < m_runs[( lo - 1 ) * 2 + 1];
+}
+
+//-*****************************************************************************
+void FaceSetRuns::getFaces( std::vector<int32_t> &oFaces ) const
+{
+    oFaces.reserve( oFaces.size() + m_numFaces );
+    for ( size_t i = 0; i < m_runs.size(); i += 2 )
+    {
+        int64_t end = ( int64_t ) m_runs[i] + m_runs[i + 1];
+        for ( int64_t face = m_runs[i]; face < end; ++face )
+        {
+            oFaces.push_back( ( int32_t ) face );
+        }
+    }
+}
+
+//-*****************************************************************************
+void GetFaceSetIds( const std::vector<FaceSetRuns> &iSets, size_t iNumFaces,
+                    std::vector<int32_t> &oIds )
+{
+    oIds.assign( iNumFaces, -1 );
+
+    // walk the sets backwards so the earlier ones win overlapping faces
+    for ( size_t s = iSets.size(); s > 0; --s )
+    {
+        const std::vector<int32_t> &runs = iSets[s - 1].getRuns();
+        int32_t id = ( int32_t ) ( s - 1 );
+        for ( size_t i = 0; i < runs.size(); i += 2 )
+        {
+            int64_t start = std::max( ( int64_t ) runs[i], ( int64_t ) 0 );
+            int64_t end = std::min( ( int64_t ) runs[i] + runs[i + 1],
+                                    ( int64_t ) iNumFaces );
+            if ( start < end )
+            {
+                std::fill( oIds.begin() + start, oIds.begin() + end, id );
+            }
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
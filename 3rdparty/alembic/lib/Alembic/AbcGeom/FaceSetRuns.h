@@ -0,0 +1,112 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_FaceSetRuns_h
+#define Alembic_AbcGeom_FaceSetRuns_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//! FaceSets may store their faces as runs of consecutive face numbers in
+//! this Int32ArrayProperty, holding ( first face, number of faces ) pairs,
+//! instead of listing every face.  See OFaceSetSchema::setRunLengthEncoding.
+//! A sample with runs leaves .faces empty, an empty runs sample means the
+//! faces are in .faces.
+static ALEMBIC_EXPORT_CONST std::string kFaceRunsPropertyName = ".faceRuns";
+
+//-*****************************************************************************
+//! The faces of a FaceSet as sorted, non-overlapping runs of consecutive
+//! face numbers.  A FaceSet covering most of a mesh is usually a handful
+//! of runs, and membership tests are a binary search over them.
+class ALEMBIC_EXPORT FaceSetRuns
+{
+public:
+    FaceSetRuns() : m_numFaces( 0 ) {}
+
+    //! Builds the runs from face numbers in any order, duplicates are
+    //! ignored.
+    explicit FaceSetRuns( const Abc::Int32ArraySample &iFaces );
+
+    //! Wraps runs as stored in kFaceRunsPropertyName.  Throws if they
+    //! aren't sorted, non-overlapping ( first face, number of faces ) pairs,
+    //! or run past the largest int32_t face number.
+    static FaceSetRuns fromRuns( const Abc::Int32ArraySample &iRuns );
+
+    //! Whether iFace is in the set.
+    bool contains( int32_t iFace ) const;
+
+    size_t getNumFaces() const { return m_numFaces; }
+
+    size_t getNumRuns() const { return m_runs.size() / 2; }
+
+    int32_t getRunStart( size_t iRun ) const { return m_runs[iRun * 2]; }
+
+    int32_t getRunLength( size_t iRun ) const
+    { return m_runs[iRun * 2 + 1]; }
+
+    //! The runs as ( first face, number of faces ) pairs.
+    const std::vector<int32_t> &getRuns() const { return m_runs; }
+
+    //! Appends every face number in the set, in increasing order.
+    void getFaces( std::vector<int32_t> &oFaces ) const;
+
+private:
+    void addRun( int64_t iStart, int64_t iEnd );
+
+    std::vector<int32_t> m_runs;
+    size_t m_numFaces;
+};
+
+//-*****************************************************************************
+//! Turns FaceSets into one id per face of a mesh with iNumFaces faces,
+//! in a single pass over their runs.  oIds[face] is the index into iSets
+//! of the first set containing the face, or -1 if none do.  Faces outside
+//! of the mesh are ignored.
+ALEMBIC_EXPORT void
+GetFaceSetIds( const std::vector<FaceSetRuns> &iSets, size_t iNumFaces,
+               std::vector<int32_t> &oIds );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcGeom/ICurves.h>
+#include <Alembic/AbcGeom/SampleReadBatch.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -186,6 +187,83 @@ void ICurvesSchema::get( ICurvesSchema::Sample &oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+Abc::UInt64ArraySamplePtr
+ICurvesSchema::getCurveOffsets( const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ICurvesSchema::getCurveOffsets()" );
+
+    return GetCachedCurveOffsets( m_nVerticesProperty, iSS );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return Abc::UInt64ArraySamplePtr();
+}
+
+//-*****************************************************************************
+void ICurvesSchema::getStrands( CurveStrands &oStrands,
+                                const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ICurvesSchema::getStrands()" );
+
+    oStrands = CurveStrands( m_positionsProperty.getValue( iSS ),
+                             GetCachedCurveOffsets( m_nVerticesProperty,
+                                                    iSS ) );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void ICurvesSchema::getParallel( ICurvesSchema::Sample &oSample,
+                                 const Abc::ISampleSelector &iSS,
+                                 size_t iMaxThreads ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ICurvesSchema::getParallel()" );
+
+    if ( ! valid() ) { return; }
+
+    SampleReadBatch batch( iSS );
+
+    batch.add( m_positionsProperty, oSample.m_positions );
+    batch.add( m_nVerticesProperty, oSample.m_nVertices );
+
+    Alembic::Util::uint8_t basisAndType[4];
+    batch.add( m_basisAndTypeProperty, basisAndType );
+
+    if ( m_positionWeightsProperty )
+    {
+        batch.add( m_positionWeightsProperty, oSample.m_positionWeights );
+    }
+
+    if ( m_ordersProperty )
+    {
+        batch.add( m_ordersProperty, oSample.m_orders );
+    }
+
+    if ( m_knotsProperty )
+    {
+        batch.add( m_knotsProperty, oSample.m_knots );
+    }
+
+    if ( m_selfBoundsProperty )
+    {
+        batch.add( m_selfBoundsProperty, oSample.m_selfBounds );
+    }
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        batch.add( m_velocitiesProperty, oSample.m_velocities );
+    }
+
+    batch.read( iMaxThreads );
+
+    oSample.m_type = static_cast<CurveType>( basisAndType[0] );
+    oSample.m_wrap = static_cast<CurvePeriodicity>( basisAndType[1] );
+    oSample.m_basis = static_cast<BasisType>( basisAndType[2] );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
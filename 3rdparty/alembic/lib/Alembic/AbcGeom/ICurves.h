@@ -41,6 +41,7 @@
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/Basis.h>
 #include <Alembic/AbcGeom/CurveType.h>
+#include <Alembic/AbcGeom/CurveStrands.h>
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
@@ -206,6 +207,14 @@ public:
     void get( sample_type &oSample,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Like get, but reads the positions, vertex counts, basis and type, and
+    //! whichever of the weights, orders, knots, bounds and velocities were
+    //! written, at the same time on up to iMaxThreads threads.
+    //! See SampleReadBatch.
+    void getParallel( sample_type &oSample,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      size_t iMaxThreads = 0 ) const;
+
     sample_type getValue( const Abc::ISampleSelector &iSS =
                           Abc::ISampleSelector() ) const
     {
@@ -229,6 +238,18 @@ public:
         return m_nVerticesProperty;
     }
 
+    //! Where each curve starts in P, with a final entry holding the total
+    //! number of vertices.  Cached per nVertices sample, see
+    //! GetCachedCurveOffsets.
+    Abc::UInt64ArraySamplePtr getCurveOffsets(
+        const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
+
+    //! Gets a view of every curve's positions, which can be split into
+    //! ranges for parallel work without copying.
+    void getStrands( CurveStrands &oStrands,
+                     const Abc::ISampleSelector &iSS =
+                     Abc::ISampleSelector() ) const;
+
     // if this property is invalid then the weight for every point is 1
     Abc::IFloatArrayProperty getPositionWeightsProperty() const
     {
@@ -75,6 +75,46 @@ void IFaceSetSchema::get( IFaceSetSchema::Sample &oSample,
 
     m_facesProperty.get( oSample.m_faces, iSS );
 
+    if ( m_faceRunsProperty )
+    {
+        Abc::Int32ArraySamplePtr runs;
+        m_faceRunsProperty.get( runs, iSS );
+        if ( runs->size() > 0 )
+        {
+            std::vector<int32_t> faces;
+            FaceSetRuns::fromRuns( *runs ).getFaces( faces );
+
+            int32_t * vals = new int32_t[faces.size()];
+            std::copy( faces.begin(), faces.end(), vals );
+            oSample.m_faces.reset( new Abc::Int32ArraySample( vals,
+                faces.size() ), AbcA::TArrayDeleter<int32_t>() );
+        }
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IFaceSetSchema::getFaceRuns( FaceSetRuns &oRuns,
+                                  const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IFaceSetSchema::getFaceRuns()" );
+
+    if ( m_faceRunsProperty )
+    {
+        Abc::Int32ArraySamplePtr runs;
+        m_faceRunsProperty.get( runs, iSS );
+        if ( runs->size() > 0 )
+        {
+            oRuns = FaceSetRuns::fromRuns( *runs );
+            return;
+        }
+    }
+
+    Abc::Int32ArraySamplePtr faces;
+    m_facesProperty.get( faces, iSS );
+    oRuns = FaceSetRuns( *faces );
+
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
@@ -89,6 +129,12 @@ void IFaceSetSchema::init( const Abc::Argument &iArg0,
 
     m_facesProperty = Abc::IInt32ArrayProperty( _this, ".faces", iArg0, iArg1 );
 
+    if ( this->getPropertyHeader( kFaceRunsPropertyName ) != NULL )
+    {
+        m_faceRunsProperty = Abc::IInt32ArrayProperty( _this,
+            kFaceRunsPropertyName, iArg0, iArg1 );
+    }
+
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
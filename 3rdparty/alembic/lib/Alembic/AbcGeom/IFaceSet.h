@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/FaceSetExclusivity.h>
+#include <Alembic/AbcGeom/FaceSetRuns.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
 
 namespace Alembic {
@@ -165,7 +166,11 @@ public:
 
 
     //! if isConstant() is true, the mesh contains no time-varying values
-    bool isConstant() const { return (m_facesProperty.isConstant ()); }
+    bool isConstant() const
+    {
+        return m_facesProperty.isConstant() &&
+            ( !m_faceRunsProperty || m_faceRunsProperty.isConstant() );
+    }
 
     //-*************************************************************************
     // SAMPLE STUFF
@@ -200,6 +205,19 @@ public:
         return m_facesProperty;
     }
 
+    //! Only written when the faces were run length encoded, see
+    //! kFaceRunsPropertyName.
+    Abc::IInt32ArrayProperty getFaceRunsProperty() const
+    {
+        return m_faceRunsProperty;
+    }
+
+    //! Gets the faces as runs, reading the stored runs directly when
+    //! there are any.  Use FaceSetRuns::contains for membership tests.
+    void getFaceRuns( FaceSetRuns &oRuns,
+                      const Abc::ISampleSelector &iSS =
+                      Abc::ISampleSelector() ) const;
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
@@ -211,6 +229,7 @@ public:
     void reset()
     {
         m_facesProperty.reset();
+        m_faceRunsProperty.reset();
 
         IGeomBaseSchema<FaceSetSchemaInfo>::reset();
     }
@@ -231,6 +250,7 @@ protected:
     void init( const Abc::Argument &iArg0, const Abc::Argument &iArg1 );
 
     Abc::IInt32ArrayProperty    m_facesProperty;
+    Abc::IInt32ArrayProperty    m_faceRunsProperty;
 };
 
 //-*****************************************************************************
@@ -61,6 +61,14 @@ public:
         Sample()
         {}
 
+        //! An expanded sample wrapping values that weren't read from a
+        //! geom param, like generated normals.
+        Sample( samp_ptr_type iVals, GeometryScope iScope )
+          : m_vals( iVals )
+          , m_scope( iScope )
+          , m_isIndexed( false )
+        {}
+
         Abc::UInt32ArraySamplePtr getIndices() const { return m_indices; }
         samp_ptr_type getVals() const { return m_vals; }
         GeometryScope getScope() const { return m_scope; }
@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcGeom/IPoints.h>
+#include <Alembic/AbcGeom/SampleReadBatch.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -73,6 +74,27 @@ void IPointsSchema::init( const Abc::Argument &iArg0,
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
+//-*****************************************************************************
+void IPointsSchema::getParallel( IPointsSchema::Sample &oSample,
+                                 const Abc::ISampleSelector &iSS,
+                                 size_t iMaxThreads ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPointsSchema::getParallel()" );
+
+    SampleReadBatch batch( iSS );
+
+    batch.add( m_positionsProperty, oSample.m_positions );
+    batch.add( m_idsProperty, oSample.m_ids );
+    batch.add( m_selfBoundsProperty, oSample.m_selfBounds );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    { batch.add( m_velocitiesProperty, oSample.m_velocities ); }
+
+    batch.read( iMaxThreads );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -188,6 +188,13 @@ public:
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Like get, but reads the positions, ids, self bounds and any
+    //! velocities at the same time on up to iMaxThreads threads.
+    //! See SampleReadBatch.
+    void getParallel( Sample &oSample,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      size_t iMaxThreads = 0 ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
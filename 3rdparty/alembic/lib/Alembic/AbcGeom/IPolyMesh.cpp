@@ -35,6 +35,10 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcGeom/IPolyMesh.h>
+#include <Alembic/AbcGeom/SampleReadBatch.h>
+
+#include <algorithm>
+#include <sstream>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -47,7 +51,9 @@ MeshTopologyVariance IPolyMeshSchema::getTopologyVariance() const
 
     if ( m_indicesProperty.isConstant() && m_countsProperty.isConstant() )
     {
-        if ( m_positionsProperty.isConstant() )
+        if ( m_positionsProperty.isConstant() &&
+             ( !m_positionsDeltaProperty ||
+               m_positionsDeltaProperty.isConstant() ) )
         {
             return kConstantTopology;
         }
@@ -89,6 +95,25 @@ void IPolyMeshSchema::init( const Abc::Argument &iArg0,
                                                  iArg0, iArg1 );
 
     // none of the things below here are guaranteed to exist
+    // deltas without a version were written next to a full P
+    const AbcA::PropertyHeader * deltaHeader =
+        this->getPropertyHeader( kPositionsDeltaPropertyName );
+    std::string deltaVersion = deltaHeader == NULL ? "" :
+        deltaHeader->getMetaData().get( kPositionsDeltaVersionKey );
+    if ( !deltaVersion.empty() )
+    {
+        std::istringstream versionStrm( deltaVersion );
+        Util::uint32_t version = 0;
+        versionStrm >> version;
+
+        ABCA_ASSERT( version == kPositionsDeltaVersion,
+                     "Unsupported positions delta version: "
+                     << deltaVersion );
+
+        m_positionsDeltaProperty = Abc::IUcharArrayProperty( _this,
+            kPositionsDeltaPropertyName, iArg0, iArg1 );
+    }
+
     if ( this->getPropertyHeader( "uv" ) != NULL )
     {
         m_uvsParam = IV2fGeomParam( _this, "uv", iArg0, iArg1 );
@@ -117,6 +142,7 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     IGeomBaseSchema<PolyMeshSchemaInfo>::operator=(rhs);
 
     m_positionsProperty = rhs.m_positionsProperty;
+    m_positionsDeltaProperty = rhs.m_positionsDeltaProperty;
     m_velocitiesProperty = rhs.m_velocitiesProperty;
     m_indicesProperty   = rhs.m_indicesProperty;
     m_countsProperty    = rhs.m_countsProperty;
@@ -124,6 +150,11 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     m_uvsParam          = rhs.m_uvsParam;
     m_normalsParam      = rhs.m_normalsParam;
 
+    {
+        Alembic::Util::scoped_lock l( m_keyframeMutex );
+        m_keyframe.reset();
+    }
+
     // lock, reset
     Alembic::Util::scoped_lock l(m_faceSetsMutex);
     m_faceSetsLoaded = false;
@@ -132,6 +163,101 @@ IPolyMeshSchema::operator=(const IPolyMeshSchema & rhs)
     return *this;
 }
 
+//-*****************************************************************************
+void IPolyMeshSchema::getPositions( Abc::P3fArraySamplePtr &oPositions,
+                                    const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getPositions()" );
+
+    if ( !m_positionsDeltaProperty )
+    {
+        m_positionsProperty.get( oPositions, iSS );
+        return;
+    }
+
+    // P is the same keyframe sample until the next keyframe, so its key
+    // tells us whether we already have it
+    AbcA::ArraySampleKey key;
+    bool hasKey = m_positionsProperty.getKey( key, iSS );
+
+    Abc::P3fArraySamplePtr keyframe;
+    if ( hasKey )
+    {
+        Alembic::Util::scoped_lock l( m_keyframeMutex );
+        if ( m_keyframe && m_keyframeKey == key )
+        {
+            keyframe = m_keyframe;
+        }
+    }
+
+    if ( !keyframe )
+    {
+        m_positionsProperty.get( keyframe, iSS );
+        if ( hasKey )
+        {
+            Alembic::Util::scoped_lock l( m_keyframeMutex );
+            m_keyframeKey = key;
+            m_keyframe = keyframe;
+        }
+    }
+
+    Abc::UcharArraySamplePtr delta;
+    m_positionsDeltaProperty.get( delta, iSS );
+    oPositions = DecodePositionsDelta( keyframe, *delta );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getNormals( IN3fGeomParam::Sample &oSample,
+                                  const Abc::ISampleSelector &iSS,
+                                  NormalWeighting iWeighting ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getNormals()" );
+
+    if ( m_normalsParam.valid() )
+    {
+        m_normalsParam.getExpanded( oSample, iSS );
+        return;
+    }
+
+    // the normals cache is keyed on P, which is only right for the samples
+    // which are their keyframe
+    Abc::UcharArraySamplePtr delta;
+    if ( m_positionsDeltaProperty )
+    {
+        m_positionsDeltaProperty.get( delta, iSS );
+    }
+
+    if ( !delta || IsPositionsKeyframe( *delta ) )
+    {
+        oSample = IN3fGeomParam::Sample(
+            ComputeCachedPolyMeshNormals( m_positionsProperty,
+                                          m_countsProperty,
+                                          m_indicesProperty,
+                                          iWeighting, iSS ),
+            kVertexScope );
+        return;
+    }
+
+    Abc::P3fArraySamplePtr positions;
+    getPositions( positions, iSS );
+    Abc::Int32ArraySamplePtr counts = m_countsProperty.getValue( iSS );
+    Abc::Int32ArraySamplePtr indices = m_indicesProperty.getValue( iSS );
+
+    std::vector<N3f> normals;
+    ComputePolyMeshNormals( *positions, *counts, *indices, iWeighting,
+                            normals );
+
+    N3f * vals = new N3f[normals.size()];
+    std::copy( normals.begin(), normals.end(), vals );
+    oSample = IN3fGeomParam::Sample( Abc::N3fArraySamplePtr(
+        new Abc::N3fArraySample( vals, normals.size() ),
+        AbcA::TArrayDeleter<N3f>() ), kVertexScope );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IPolyMeshSchema::loadFaceSetNames()
 {
@@ -228,6 +354,66 @@ IPolyMeshSchema::getFaceSet ( const std::string &iFaceSetName )
     return emptyFaceSet;
 }
 
+//-*****************************************************************************
+void IPolyMeshSchema::getFaceSetIds( std::vector<std::string> &oFaceSetNames,
+                                     std::vector<int32_t> &oIds,
+                                     const Abc::ISampleSelector &iSS )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getFaceSetIds()" );
+
+    oFaceSetNames.clear();
+    getFaceSetNames( oFaceSetNames );
+
+    std::vector<FaceSetRuns> sets( oFaceSetNames.size() );
+    for ( size_t i = 0; i < oFaceSetNames.size(); ++i )
+    {
+        getFaceSet( oFaceSetNames[i] ).getSchema().getFaceRuns( sets[i],
+                                                                iSS );
+    }
+
+    Alembic::Util::Dimensions dims;
+    m_countsProperty.getDimensions( dims, iSS );
+    GetFaceSetIds( sets, dims.numPoints(), oIds );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getParallel( IPolyMeshSchema::Sample &oSample,
+                                   const Abc::ISampleSelector &iSS,
+                                   size_t iMaxThreads ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getParallel()" );
+
+    SampleReadBatch batch( iSS );
+
+    batch.add( m_positionsProperty, oSample.m_positions );
+    batch.add( m_indicesProperty, oSample.m_indices );
+    batch.add( m_countsProperty, oSample.m_counts );
+    batch.add( m_selfBoundsProperty, oSample.m_selfBounds );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        batch.add( m_velocitiesProperty, oSample.m_velocities );
+    }
+
+    Abc::UcharArraySamplePtr delta;
+    if ( m_positionsDeltaProperty )
+    {
+        batch.add( m_positionsDeltaProperty, delta );
+    }
+
+    batch.read( iMaxThreads );
+
+    // P holds the keyframe
+    if ( delta )
+    {
+        oSample.m_positions = DecodePositionsDelta( oSample.m_positions,
+                                                    *delta );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
 
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
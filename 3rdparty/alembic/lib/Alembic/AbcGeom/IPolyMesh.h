@@ -43,6 +43,8 @@
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/AbcGeom/PolyMeshNormals.h>
+#include <Alembic/AbcGeom/PositionsDelta.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -181,7 +183,7 @@ public:
     {
         ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::get()" );
 
-        m_positionsProperty.get( oSample.m_positions, iSS );
+        getPositions( oSample.m_positions, iSS );
         m_indicesProperty.get( oSample.m_indices, iSS );
         m_countsProperty.get( oSample.m_counts, iSS );
 
@@ -197,6 +199,13 @@ public:
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Like get, but reads P, the face indices and counts, the self bounds
+    //! and any velocities at the same time on up to iMaxThreads threads.
+    //! See SampleReadBatch.
+    void getParallel( Sample &oSample,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      size_t iMaxThreads = 0 ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -214,6 +223,14 @@ public:
         return m_normalsParam;
     }
 
+    //! Gets the expanded normals, as if N were always stored.  When the
+    //! mesh has no N, smooth per vertex normals are computed from P and
+    //! the topology and shared through the normals cache, see
+    //! ComputeCachedPolyMeshNormals.
+    void getNormals( IN3fGeomParam::Sample &oSample,
+                     const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                     NormalWeighting iWeighting = kAreaWeighting ) const;
+
     Abc::IInt32ArrayProperty getFaceCountsProperty() const
     {
         return m_countsProperty;
@@ -224,11 +241,27 @@ public:
         return m_indicesProperty;
     }
 
+    //! When getPositionsDeltaProperty() is valid P only holds the keyframes,
+    //! use get() or getPositions() for the positions of every sample.
     Abc::IP3fArrayProperty getPositionsProperty() const
     {
         return m_positionsProperty;
     }
 
+    //! Only valid when P was written as keyframes plus deltas.
+    //! See kPositionsDeltaPropertyName.
+    Abc::IUcharArrayProperty getPositionsDeltaProperty() const
+    {
+        return m_positionsDeltaProperty;
+    }
+
+    //! Gets the positions, rebuilding them from their keyframe and delta
+    //! when P was delta encoded.  The last keyframe read is kept around so
+    //! the samples after it only read their small deltas.
+    void getPositions( Abc::P3fArraySamplePtr &oPositions,
+                       const Abc::ISampleSelector &iSS =
+                       Abc::ISampleSelector() ) const;
+
     Abc::IV3fArrayProperty getVelocitiesProperty() const
     {
         return m_velocitiesProperty;
@@ -245,6 +278,7 @@ public:
     void reset()
     {
         m_positionsProperty.reset();
+        m_positionsDeltaProperty.reset();
         m_velocitiesProperty.reset();
         m_indicesProperty.reset();
         m_countsProperty.reset();
@@ -271,6 +305,13 @@ public:
     IFaceSet getFaceSet( const std::string &iFaceSetName );
     bool hasFaceSet( const std::string &iFaceSetName );
 
+    //! Gets which FaceSet each face is in, in one pass over the FaceSet
+    //! runs, see GetFaceSetIds.  The ids index into oFaceSetNames.
+    void getFaceSetIds( std::vector<std::string> &oFaceSetNames,
+                        std::vector<int32_t> &oIds,
+                        const Abc::ISampleSelector &iSS =
+                        Abc::ISampleSelector() );
+
     //! unspecified-bool-type operator overload.
     //! ...
     ALEMBIC_OVERRIDE_OPERATOR_BOOL( IPolyMeshSchema::valid() );
@@ -280,6 +321,7 @@ protected:
                const Abc::Argument &iArg1 );
 
     Abc::IP3fArrayProperty m_positionsProperty;
+    Abc::IUcharArrayProperty m_positionsDeltaProperty;
     Abc::IV3fArrayProperty m_velocitiesProperty;
     Abc::IInt32ArrayProperty m_indicesProperty;
     Abc::IInt32ArrayProperty m_countsProperty;
@@ -293,6 +335,11 @@ protected:
     std::map <std::string, IFaceSet>  m_faceSets;
     Alembic::Util::mutex                      m_faceSetsMutex;
     void loadFaceSetNames();
+
+    // the last keyframe of delta encoded positions
+    mutable Alembic::Util::mutex      m_keyframeMutex;
+    mutable AbcA::ArraySampleKey      m_keyframeKey;
+    mutable Abc::P3fArraySamplePtr    m_keyframe;
 };
 
 //-*****************************************************************************
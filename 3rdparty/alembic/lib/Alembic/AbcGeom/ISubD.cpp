@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcGeom/ISubD.h>
+#include <Alembic/AbcGeom/SampleReadBatch.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -399,6 +400,95 @@ ISubDSchema::getFaceSet( const std::string &iFaceSetName )
     return empty;
 }
 
+//-*****************************************************************************
+void ISubDSchema::getFaceSetIds( std::vector<std::string> &oFaceSetNames,
+                                 std::vector<int32_t> &oIds,
+                                 const Abc::ISampleSelector &iSS )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::getFaceSetIds()" );
+
+    oFaceSetNames.clear();
+    getFaceSetNames( oFaceSetNames );
+
+    std::vector<FaceSetRuns> sets( oFaceSetNames.size() );
+    for ( size_t i = 0; i < oFaceSetNames.size(); ++i )
+    {
+        getFaceSet( oFaceSetNames[i] ).getSchema().getFaceRuns( sets[i],
+                                                                iSS );
+    }
+
+    Alembic::Util::Dimensions dims;
+    m_faceCountsProperty.getDimensions( dims, iSS );
+    GetFaceSetIds( sets, dims.numPoints(), oIds );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void ISubDSchema::getParallel( ISubDSchema::Sample &oSample,
+                               const Abc::ISampleSelector &iSS,
+                               size_t iMaxThreads ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::getParallel()" );
+
+    SampleReadBatch batch( iSS );
+
+    batch.add( m_positionsProperty, oSample.m_positions );
+    batch.add( m_faceIndicesProperty, oSample.m_faceIndices );
+    batch.add( m_faceCountsProperty, oSample.m_faceCounts );
+    batch.add( m_selfBoundsProperty, oSample.m_selfBounds );
+
+    oSample.m_faceVaryingInterpolateBoundary = 0;
+    if ( m_faceVaryingInterpolateBoundaryProperty )
+    {
+        batch.add( m_faceVaryingInterpolateBoundaryProperty,
+                   oSample.m_faceVaryingInterpolateBoundary );
+    }
+
+    oSample.m_faceVaryingPropagateCorners = 0;
+    if ( m_faceVaryingPropagateCornersProperty )
+    {
+        batch.add( m_faceVaryingPropagateCornersProperty,
+                   oSample.m_faceVaryingPropagateCorners );
+    }
+
+    oSample.m_interpolateBoundary = 0;
+    if ( m_interpolateBoundaryProperty )
+    {
+        batch.add( m_interpolateBoundaryProperty,
+                   oSample.m_interpolateBoundary );
+    }
+
+    if ( m_creaseIndicesProperty )
+    { batch.add( m_creaseIndicesProperty, oSample.m_creaseIndices ); }
+
+    if ( m_creaseLengthsProperty )
+    { batch.add( m_creaseLengthsProperty, oSample.m_creaseLengths ); }
+
+    if ( m_creaseSharpnessesProperty )
+    { batch.add( m_creaseSharpnessesProperty, oSample.m_creaseSharpnesses ); }
+
+    if ( m_cornerIndicesProperty )
+    { batch.add( m_cornerIndicesProperty, oSample.m_cornerIndices ); }
+
+    if ( m_cornerSharpnessesProperty )
+    { batch.add( m_cornerSharpnessesProperty, oSample.m_cornerSharpnesses ); }
+
+    if ( m_holesProperty )
+    { batch.add( m_holesProperty, oSample.m_holes ); }
+
+    oSample.m_subdScheme = "catmull-clark";
+    if ( m_subdSchemeProperty )
+    { batch.add( m_subdSchemeProperty, oSample.m_subdScheme ); }
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    { batch.add( m_velocitiesProperty, oSample.m_velocities ); }
+
+    batch.read( iMaxThreads );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -254,6 +254,13 @@ public:
     void get( Sample &iSamp,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Like get, but reads the positions and faces along with the creases,
+    //! corners, holes and scheme properties at the same time, on up to
+    //! iMaxThreads threads.  See SampleReadBatch.
+    void getParallel( Sample &oSample,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      size_t iMaxThreads = 0 ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -353,6 +360,13 @@ public:
     IFaceSet getFaceSet( const std::string &iFaceSetName );
     bool hasFaceSet( const std::string &iFaceSetName );
 
+    //! Gets which FaceSet each face is in, in one pass over the FaceSet
+    //! runs, see GetFaceSetIds.  The ids index into oFaceSetNames.
+    void getFaceSetIds( std::vector<std::string> &oFaceSetNames,
+                        std::vector<int32_t> &oIds,
+                        const Abc::ISampleSelector &iSS =
+                        Abc::ISampleSelector() );
+
     //! unspecified-bool-type operator overload.
     //! ...
     ALEMBIC_OVERRIDE_OPERATOR_BOOL( ISubDSchema::valid() );
@@ -98,6 +98,8 @@ void OFaceSetSchema::init( AbcA::CompoundPropertyWriterPtr iParent,
 
     m_facesExclusive = kFaceSetNonExclusive;
 
+    m_runLengthEncoding = false;
+
     ALEMBIC_ABC_SAFE_CALL_END_RESET();
 }
 
@@ -110,6 +112,11 @@ void OFaceSetSchema::setTimeSampling( uint32_t iTimeSamplingID )
     m_facesProperty.setTimeSampling( iTimeSamplingID );
     m_selfBoundsProperty.setTimeSampling( iTimeSamplingID );
 
+    if ( m_faceRunsProperty )
+    {
+        m_faceRunsProperty.setTimeSampling( iTimeSamplingID );
+    }
+
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
@@ -213,11 +220,19 @@ void OFaceSetSchema::set( const Sample &iSamp )
         // First sample must provide faces
         ABCA_ASSERT( iSamp.getFaces() ,
                      "Sample 0 must provide the faces that make up the faceset." );
-        m_facesProperty.set( iSamp.getFaces() );
+        setFaces( iSamp.getFaces() );
+    }
+    else if ( iSamp.getFaces().getData() )
+    {
+        setFaces( iSamp.getFaces() );
     }
     else
     {
-        SetPropUsePrevIfNull( m_facesProperty, iSamp.getFaces() );
+        m_facesProperty.setFromPrevious();
+        if ( m_faceRunsProperty )
+        {
+            m_faceRunsProperty.setFromPrevious();
+        }
     }
 
     m_selfBoundsProperty.set( iSamp.getSelfBounds() );
@@ -231,6 +246,51 @@ void OFaceSetSchema::set( const Sample &iSamp )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OFaceSetSchema::setFaces( const Abc::Int32ArraySample &iFaces )
+{
+    if ( !m_runLengthEncoding && !m_faceRunsProperty )
+    {
+        m_facesProperty.set( iFaces );
+        return;
+    }
+
+    std::vector<int32_t> empty;
+
+    FaceSetRuns runs;
+    if ( m_runLengthEncoding )
+    {
+        runs = FaceSetRuns( iFaces );
+    }
+
+    // only use the runs when they are smaller than the faces
+    if ( !m_runLengthEncoding || runs.getRuns().size() >= iFaces.size() )
+    {
+        m_facesProperty.set( iFaces );
+        if ( m_faceRunsProperty )
+        {
+            m_faceRunsProperty.set( Abc::Int32ArraySample( empty ) );
+        }
+        return;
+    }
+
+    if ( !m_faceRunsProperty )
+    {
+        // earlier samples keep their faces in .faces
+        m_faceRunsProperty = Abc::OInt32ArrayProperty( this->getPtr(),
+            kFaceRunsPropertyName, m_facesProperty.getTimeSampling() );
+
+        for ( size_t i = 0; i < m_facesProperty.getNumSamples(); ++i )
+        {
+            m_faceRunsProperty.set( Abc::Int32ArraySample( empty ) );
+        }
+    }
+
+    // the runs replace the faces, IFaceSetSchema::get expands them again
+    m_facesProperty.set( Abc::Int32ArraySample( empty ) );
+    m_faceRunsProperty.set( Abc::Int32ArraySample( runs.getRuns() ) );
+}
+
 //-*****************************************************************************
 void OFaceSetSchema::setFaceExclusivity( FaceSetExclusivity iFacesExclusive )
 {
@@ -42,6 +42,7 @@
 #include <Alembic/AbcGeom/SchemaInfoDeclarations.h>
 #include <Alembic/AbcGeom/OGeomParam.h>
 #include <Alembic/AbcGeom/FaceSetExclusivity.h>
+#include <Alembic/AbcGeom/FaceSetRuns.h>
 #include <Alembic/AbcGeom/OGeomBase.h>
 
 namespace Alembic {
@@ -116,7 +117,7 @@ public:
     //-*************************************************************************
     //! The default constructor creates an empty OFaceSetSchema.
     //! OFaceSetSchema instances created this evaluate to a boolean value of false.
-    OFaceSetSchema() {}
+    OFaceSetSchema() : m_runLengthEncoding( false ) {}
 
     //! This constructor creates a new faceset writer.
     //! The first argument is an CompoundPropertyWriterPtr to use as a parent.
@@ -173,6 +174,17 @@ public:
 
     void setFaceExclusivity( FaceSetExclusivity iFacesExclusive );
     FaceSetExclusivity getFaceExclusivity() { return m_facesExclusive; }
+
+    //! Opt in to storing the faces as runs of consecutive face numbers,
+    //! see kFaceRunsPropertyName.  Samples are only stored as runs when
+    //! that is smaller than the list of faces, .faces is then left empty
+    //! and IFaceSetSchema::get expands the runs back transparently.
+    //! Readers which predate kFaceRunsPropertyName see those samples as
+    //! empty face sets.
+    void setRunLengthEncoding( bool iEnable )
+    { m_runLengthEncoding = iEnable; }
+    bool getRunLengthEncoding() const { return m_runLengthEncoding; }
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, validity,
@@ -184,6 +196,7 @@ public:
     void reset()
     {
         m_facesProperty.reset();
+        m_faceRunsProperty.reset();
 
         OGeomBaseSchema<FaceSetSchemaInfo>::reset();
     }
@@ -203,6 +216,8 @@ public:
 protected:
     void _recordExclusivityHint();
 
+    void setFaces( const Abc::Int32ArraySample &iFaces );
+
     void init( AbcA::CompoundPropertyWriterPtr iParent,
                const Abc::Argument &iArg0, const Abc::Argument &iArg1,
                const Abc::Argument &iArg2, const Abc::Argument &iArg3 );
@@ -211,6 +226,9 @@ protected:
 
     Abc::OUInt32Property        m_facesExclusiveProperty;
     FaceSetExclusivity          m_facesExclusive;
+
+    Abc::OInt32ArrayProperty    m_faceRunsProperty;
+    bool                        m_runLengthEncoding;
 };
 
 
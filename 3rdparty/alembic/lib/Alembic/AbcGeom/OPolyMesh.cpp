@@ -138,7 +138,7 @@ void OPolyMeshSchema::set( const Sample &iSamp )
                      iSamp.getFaceCounts(),
                      "Sample 0 must have valid data for all mesh components" );
 
-        m_positionsProperty.set( iSamp.getPositions() );
+        setPositions( iSamp );
         m_indicesProperty.set( iSamp.getFaceIndices() );
         m_countsProperty.set( iSamp.getFaceCounts() );
 
@@ -169,7 +169,7 @@ void OPolyMeshSchema::set( const Sample &iSamp )
     }
     else
     {
-        SetPropUsePrevIfNull( m_positionsProperty, iSamp.getPositions() );
+        setPositions( iSamp );
         SetPropUsePrevIfNull( m_indicesProperty, iSamp.getFaceIndices() );
         SetPropUsePrevIfNull( m_countsProperty, iSamp.getFaceCounts() );
 
@@ -223,6 +223,92 @@ void OPolyMeshSchema::createPositionsProperty()
 
 }
 
+//-*****************************************************************************
+void OPolyMeshSchema::setPositions( const Sample &iSamp )
+{
+    const Abc::P3fArraySample &pos = iSamp.getPositions();
+
+    if ( !m_positionsDeltaProperty )
+    {
+        SetPropUsePrevIfNull( m_positionsProperty, pos );
+        return;
+    }
+
+    if ( !pos.getData() )
+    {
+        m_positionsProperty.setFromPrevious();
+        m_positionsDeltaProperty.setFromPrevious();
+        return;
+    }
+
+    bool keyframe = m_numSamples == 0 ||
+        m_numSamples - m_lastKeyframe >= m_keyframeInterval ||
+        pos.size() != m_keyframePositions.size();
+
+    // deltas only make sense while the topology stays the same
+    if ( iSamp.getFaceIndices().getData() )
+    {
+        AbcA::ArraySampleKey key = iSamp.getFaceIndices().getKey();
+        keyframe = keyframe || key != m_keyframeIndicesKey;
+        m_keyframeIndicesKey = key;
+    }
+
+    if ( iSamp.getFaceCounts().getData() )
+    {
+        AbcA::ArraySampleKey key = iSamp.getFaceCounts().getKey();
+        keyframe = keyframe || key != m_keyframeCountsKey;
+        m_keyframeCountsKey = key;
+    }
+
+    // between keyframes P repeats the keyframe, which is stored only once
+    if ( keyframe )
+    {
+        m_positionsProperty.set( pos );
+        m_keyframePositions.assign( pos.get(), pos.get() + pos.size() );
+        m_lastKeyframe = m_numSamples;
+        EncodePositionsKeyframe( m_positionsDelta );
+    }
+    else
+    {
+        m_positionsProperty.setFromPrevious();
+        EncodePositionsDelta( Abc::P3fArraySample( m_keyframePositions ), pos,
+                              m_positionsDelta );
+    }
+
+    m_positionsDeltaProperty.set( Abc::UcharArraySample( m_positionsDelta ) );
+}
+
+//-*****************************************************************************
+void OPolyMeshSchema::setPositionsKeyframeInterval( uint32_t iInterval )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN(
+        "OPolyMeshSchema::setPositionsKeyframeInterval()" );
+
+    ABCA_ASSERT( m_numSamples == 0 && !m_selectiveExport,
+                 "The positions keyframe interval must be set before the "
+                 "first sample, and can't be used with sparse meshes" );
+
+    m_keyframeInterval = iInterval;
+
+    if ( iInterval > 1 && !m_positionsDeltaProperty )
+    {
+        std::ostringstream interval;
+        interval << iInterval;
+
+        std::ostringstream version;
+        version << kPositionsDeltaVersion;
+
+        AbcA::MetaData mdata;
+        mdata.set( kPositionsKeyframeIntervalKey, interval.str() );
+        mdata.set( kPositionsDeltaVersionKey, version.str() );
+
+        m_positionsDeltaProperty = Abc::OUcharArrayProperty( this->getPtr(),
+            kPositionsDeltaPropertyName, mdata, m_timeSamplingIndex );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OPolyMeshSchema::createVelocitiesProperty()
 {
@@ -318,6 +404,7 @@ void OPolyMeshSchema::setFromPrevious()
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "OPolyMeshSchema::setFromPrevious" );
 
     if( m_positionsProperty ) m_positionsProperty.setFromPrevious();
+    if( m_positionsDeltaProperty ) m_positionsDeltaProperty.setFromPrevious();
     if( m_indicesProperty ) m_indicesProperty.setFromPrevious();
     if( m_countsProperty )m_countsProperty.setFromPrevious();
 
@@ -343,6 +430,11 @@ void OPolyMeshSchema::setTimeSampling( uint32_t iIndex )
         m_positionsProperty.setTimeSampling( iIndex );
     }
 
+    if( m_positionsDeltaProperty )
+    {
+        m_positionsDeltaProperty.setTimeSampling( iIndex );
+    }
+
     if( m_indicesProperty )
     {
         m_indicesProperty.setTimeSampling( iIndex );
@@ -402,6 +494,10 @@ void OPolyMeshSchema::init( uint32_t iTsIdx, bool isSparse )
 
     m_timeSamplingIndex = iTsIdx;
 
+    m_keyframeInterval = 0;
+
+    m_lastKeyframe = 0;
+
     if ( m_selectiveExport )
     {
         return;
@@ -43,6 +43,7 @@
 #include <Alembic/AbcGeom/OFaceSet.h>
 #include <Alembic/AbcGeom/OGeomParam.h>
 #include <Alembic/AbcGeom/OGeomBase.h>
+#include <Alembic/AbcGeom/PositionsDelta.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -172,6 +173,8 @@ public:
         m_selectiveExport = false;
         m_numSamples = 0;
         m_timeSamplingIndex = 0;
+        m_keyframeInterval = 0;
+        m_lastKeyframe = 0;
     }
 
     //! This constructor creates a new poly mesh writer.
@@ -246,6 +249,15 @@ public:
     void setTimeSampling( uint32_t iIndex );
     void setTimeSampling( AbcA::TimeSamplingPtr iTime );
 
+    //! Opt in to writing P in full only on a keyframe taken every iInterval
+    //! samples, and storing the samples in between as lossless deltas
+    //! against their keyframe.  A change of topology or point count always
+    //! starts a new keyframe.  P repeats the keyframe until the next one, so
+    //! readers have to go through IPolyMeshSchema::get or getPositions to
+    //! see the real positions, see kPositionsDeltaPropertyName.
+    //! Must be called before the first sample, 0 or 1 turns it off.
+    void setPositionsKeyframeInterval( uint32_t iInterval );
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, validity,
@@ -257,6 +269,7 @@ public:
     void reset()
     {
         m_positionsProperty.reset();
+        m_positionsDeltaProperty.reset();
         m_velocitiesProperty.reset();
         m_indicesProperty.reset();
         m_countsProperty.reset();
@@ -303,6 +316,7 @@ private:
     void selectiveSet( const Sample &iSamp );
 
     Abc::OP3fArrayProperty m_positionsProperty;
+    Abc::OUcharArrayProperty m_positionsDeltaProperty;
     Abc::OV3fArrayProperty m_velocitiesProperty;
     Abc::OInt32ArrayProperty m_indicesProperty;
     Abc::OInt32ArrayProperty m_countsProperty;
@@ -325,7 +339,16 @@ private:
 
     uint32_t m_timeSamplingIndex;
 
+    // delta encoding of P, see setPositionsKeyframeInterval
+    uint32_t m_keyframeInterval;
+    size_t m_lastKeyframe;
+    std::vector<V3f> m_keyframePositions;
+    AbcA::ArraySampleKey m_keyframeIndicesKey;
+    AbcA::ArraySampleKey m_keyframeCountsKey;
+    std::vector<Util::uint8_t> m_positionsDelta;
+
     void createPositionsProperty();
+    void setPositions( const Sample &iSamp );
 
     void createVelocitiesProperty();
 
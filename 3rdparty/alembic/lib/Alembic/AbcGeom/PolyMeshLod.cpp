@@ -0,0 +1,849 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/PolyMeshLod.h>
+
+#include <functional>
+#include <queue>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// boundary edges are held in place by planes perpendicular to the surface,
+// weighted heavily so the silhouette of open meshes doesn't erode
+static const double kBoundaryWeight = 1000.0;
+
+//-*****************************************************************************
+// symmetric 4x4 plane quadric, upper triangle
+class Quadric
+{
+public:
+    Quadric() { for ( int i = 0; i < 10; ++i ) { m[i] = 0.0; } }
+
+    void addPlane( const V3d &iNormal, double iDist, double iWeight )
+    {
+        const double a = iNormal.x;
+        const double b = iNormal.y;
+        const double c = iNormal.z;
+        const double d = iDist;
+        m[0] += iWeight * a * a; m[1] += iWeight * a * b;
+        m[2] += iWeight * a * c; m[3] += iWeight * a * d;
+        m[4] += iWeight * b * b; m[5] += iWeight * b * c;
+        m[6] += iWeight * b * d; m[7] += iWeight * c * c;
+        m[8] += iWeight * c * d; m[9] += iWeight * d * d;
+    }
+
+    Quadric & operator+=( const Quadric &iRhs )
+    {
+        for ( int i = 0; i < 10; ++i ) { m[i] += iRhs.m[i]; }
+        return *this;
+    }
+
+    double evaluate( const V3d &iP ) const
+    {
+        const double x = iP.x;
+        const double y = iP.y;
+        const double z = iP.z;
+        return m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z +
+            2.0 * m[3] * x + m[4] * y * y + 2.0 * m[5] * y * z +
+            2.0 * m[6] * y + m[7] * z * z + 2.0 * m[8] * z + m[9];
+    }
+
+private:
+    double m[10];
+};
+
+//-*****************************************************************************
+// collapsing m_from onto m_to, stamps invalidate stale entries
+struct Collapse
+{
+    double cost;
+    int32_t from;
+    int32_t to;
+    uint32_t fromStamp;
+    uint32_t toStamp;
+
+    bool operator>( const Collapse &iRhs ) const
+    { return cost > iRhs.cost; }
+};
+
+typedef std::priority_queue< Collapse, std::vector< Collapse >,
+                             std::greater< Collapse > > CollapseQueue;
+
+//-*****************************************************************************
+class Decimator
+{
+public:
+    Decimator( const Abc::P3fArraySample &iPositions,
+               const Abc::Int32ArraySample &iFaceCounts,
+               const Abc::Int32ArraySample &iFaceIndices );
+
+    size_t getNumTriangles() const { return m_tris.size() / 3; }
+
+    // collapses until no more than iTarget triangles are alive, or no valid
+    // collapse is left
+    void collapseTo( size_t iTarget );
+
+    void emit( PolyMeshLodTopology &oLevel ) const;
+
+private:
+    V3d triNormal( int32_t iTri, int32_t iReplace, int32_t iWith ) const;
+    void neighbors( int32_t iVert, std::vector< int32_t > &oNeighbors ) const;
+    bool isValid( int32_t iFrom, int32_t iTo ) const;
+    void push( int32_t iA, int32_t iB );
+    void collapse( int32_t iFrom, int32_t iTo );
+
+    std::vector< V3d > m_positions;
+    std::vector< int32_t > m_tris;
+    std::vector< bool > m_triAlive;
+    std::vector< std::vector< int32_t > > m_vertTris;
+    std::vector< Quadric > m_quadrics;
+    std::vector< uint32_t > m_stamps;
+    std::vector< bool > m_vertAlive;
+    CollapseQueue m_queue;
+    size_t m_numAlive;
+};
+
+//-*****************************************************************************
+Decimator::Decimator( const Abc::P3fArraySample &iPositions,
+                      const Abc::Int32ArraySample &iFaceCounts,
+                      const Abc::Int32ArraySample &iFaceIndices )
+{
+    const size_t numVerts = iPositions.size();
+    m_positions.resize( numVerts );
+    for ( size_t i = 0; i < numVerts; ++i )
+    {
+        m_positions[i] = V3d( iPositions[i] );
+    }
+
+    // fan triangulate, dropping anything degenerate
+    size_t faceStart = 0;
+    for ( size_t f = 0; f < iFaceCounts.size(); ++f )
+    {
+        int32_t count = iFaceCounts[f];
+        ABCA_ASSERT( count >= 0 &&
+                     faceStart + count <= iFaceIndices.size(),
+                     "Face counts don't match the face indices" );
+
+        for ( int32_t j = 2; j < count; ++j )
+        {
+            int32_t a = iFaceIndices[faceStart];
+            int32_t b = iFaceIndices[faceStart + j - 1];
+            int32_t c = iFaceIndices[faceStart + j];
+            ABCA_ASSERT( a >= 0 && b >= 0 && c >= 0 &&
+                         ( size_t ) a < numVerts && ( size_t ) b < numVerts &&
+                         ( size_t ) c < numVerts,
+                         "Face index out of range of the positions" );
+            if ( a != b && b != c && a != c )
+            {
+                m_tris.push_back( a );
+                m_tris.push_back( b );
+                m_tris.push_back( c );
+            }
+        }
+        faceStart += count;
+    }
+
+    const size_t numTris = m_tris.size() / 3;
+    m_triAlive.assign( numTris, true );
+    m_numAlive = numTris;
+    m_vertTris.resize( numVerts );
+    m_quadrics.resize( numVerts );
+    m_stamps.assign( numVerts, 0 );
+    m_vertAlive.assign( numVerts, true );
+
+    std::vector< uint64_t > edges;
+    edges.reserve( m_tris.size() );
+    for ( int32_t t = 0; t < ( int32_t ) numTris; ++t )
+    {
+        V3d n = triNormal( t, -1, -1 );
+        double len = n.length();
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            int32_t a = m_tris[t * 3 + j];
+            int32_t b = m_tris[t * 3 + ( j + 1 ) % 3];
+            m_vertTris[a].push_back( t );
+            edges.push_back( ( ( uint64_t ) std::min( a, b ) << 32 ) |
+                             ( uint64_t ) std::max( a, b ) );
+        }
+
+        if ( len <= 0.0 )
+        {
+            continue;
+        }
+
+        // area weighted plane of the triangle
+        n /= len;
+        double d = -n.dot( m_positions[m_tris[t * 3]] );
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            m_quadrics[m_tris[t * 3 + j]].addPlane( n, d, 0.5 * len );
+        }
+    }
+
+    std::sort( edges.begin(), edges.end() );
+
+    // an edge used by only one triangle is on the boundary
+    std::vector< uint64_t > uniqueEdges;
+    uniqueEdges.reserve( edges.size() / 2 + 1 );
+    for ( size_t i = 0; i < edges.size(); )
+    {
+        size_t j = i + 1;
+        while ( j < edges.size() && edges[j] == edges[i] )
+        {
+            ++j;
+        }
+
+        int32_t a = ( int32_t ) ( edges[i] >> 32 );
+        int32_t b = ( int32_t ) ( edges[i] & 0xffffffff );
+        uniqueEdges.push_back( edges[i] );
+
+        if ( j - i == 1 )
+        {
+            // find the triangle that owns it for its normal
+            const std::vector< int32_t > &tris = m_vertTris[a];
+            for ( size_t k = 0; k < tris.size(); ++k )
+            {
+                const int32_t * tri = &m_tris[tris[k] * 3];
+                if ( tri[0] == b || tri[1] == b || tri[2] == b )
+                {
+                    V3d n = triNormal( tris[k], -1, -1 );
+                    V3d e = m_positions[b] - m_positions[a];
+                    V3d p = e.cross( n );
+                    double len = p.length();
+                    if ( len > 0.0 )
+                    {
+                        p /= len;
+                        double d = -p.dot( m_positions[a] );
+                        double w = kBoundaryWeight * e.length2();
+                        m_quadrics[a].addPlane( p, d, w );
+                        m_quadrics[b].addPlane( p, d, w );
+                    }
+                    break;
+                }
+            }
+        }
+        i = j;
+    }
+
+    for ( size_t i = 0; i < uniqueEdges.size(); ++i )
+    {
+        push( ( int32_t ) ( uniqueEdges[i] >> 32 ),
+              ( int32_t ) ( uniqueEdges[i] & 0xffffffff ) );
+    }
+}
+
+//-*****************************************************************************
+// unnormalized normal of iTri, optionally as if iReplace were moved to iWith
+V3d Decimator::triNormal( int32_t iTri, int32_t iReplace, int32_t iWith ) const
+{
+    V3d p[3];
+    for ( size_t j = 0; j < 3; ++j )
+    {
+        int32_t v = m_tris[iTri * 3 + j];
+        p[j] = m_positions[v == iReplace ? iWith : v];
+    }
+    return ( p[1] - p[0] ).cross( p[2] - p[0] );
+}
+
+//-*****************************************************************************
+void Decimator::neighbors( int32_t iVert,
+                           std::vector< int32_t > &oNeighbors ) const
+{
+    oNeighbors.clear();
+    const std::vector< int32_t > &tris = m_vertTris[iVert];
+    for ( size_t i = 0; i < tris.size(); ++i )
+    {
+        if ( !m_triAlive[tris[i]] )
+        {
+            continue;
+        }
+
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            int32_t v = m_tris[tris[i] * 3 + j];
+            if ( v != iVert )
+            {
+                oNeighbors.push_back( v );
+            }
+        }
+    }
+    std::sort( oNeighbors.begin(), oNeighbors.end() );
+    oNeighbors.erase( std::unique( oNeighbors.begin(), oNeighbors.end() ),
+                      oNeighbors.end() );
+}
+
+//-*****************************************************************************
+bool Decimator::isValid( int32_t iFrom, int32_t iTo ) const
+{
+    size_t numShared = 0;
+    const std::vector< int32_t > &tris = m_vertTris[iFrom];
+    for ( size_t i = 0; i < tris.size(); ++i )
+    {
+        int32_t t = tris[i];
+        if ( !m_triAlive[t] )
+        {
+            continue;
+        }
+
+        const int32_t * tri = &m_tris[t * 3];
+        if ( tri[0] == iTo || tri[1] == iTo || tri[2] == iTo )
+        {
+            ++numShared;
+            continue;
+        }
+
+        // the triangles that survive must not flip or degenerate
+        V3d before = triNormal( t, -1, -1 );
+        V3d after = triNormal( t, iFrom, iTo );
+        if ( after.length2() <= 0.0 || before.dot( after ) <= 0.0 )
+        {
+            return false;
+        }
+    }
+
+    if ( numShared == 0 )
+    {
+        return false;
+    }
+
+    // link condition, the only neighbors the two vertices may share are the
+    // opposite corners of the triangles being removed, otherwise the
+    // collapse pinches the surface into a non-manifold edge
+    std::vector< int32_t > fromNeighbors;
+    std::vector< int32_t > toNeighbors;
+    neighbors( iFrom, fromNeighbors );
+    neighbors( iTo, toNeighbors );
+
+    std::vector< int32_t > common;
+    std::set_intersection( fromNeighbors.begin(), fromNeighbors.end(),
+                           toNeighbors.begin(), toNeighbors.end(),
+                           std::back_inserter( common ) );
+
+    return common.size() <= numShared;
+}
+
+//-*****************************************************************************
+void Decimator::push( int32_t iA, int32_t iB )
+{
+    Quadric q = m_quadrics[iA];
+    q += m_quadrics[iB];
+
+    Collapse c;
+    double costAB = q.evaluate( m_positions[iB] );
+    double costBA = q.evaluate( m_positions[iA] );
+    if ( costAB <= costBA )
+    {
+        c.cost = costAB;
+        c.from = iA;
+        c.to = iB;
+    }
+    else
+    {
+        c.cost = costBA;
+        c.from = iB;
+        c.to = iA;
+    }
+    c.fromStamp = m_stamps[c.from];
+    c.toStamp = m_stamps[c.to];
+    m_queue.push( c );
+}
+
+//-*****************************************************************************
+void Decimator::collapse( int32_t iFrom, int32_t iTo )
+{
+    std::vector< int32_t > &fromTris = m_vertTris[iFrom];
+    std::vector< int32_t > &toTris = m_vertTris[iTo];
+    for ( size_t i = 0; i < fromTris.size(); ++i )
+    {
+        int32_t t = fromTris[i];
+        if ( !m_triAlive[t] )
+        {
+            continue;
+        }
+
+        int32_t * tri = &m_tris[t * 3];
+        if ( tri[0] == iTo || tri[1] == iTo || tri[2] == iTo )
+        {
+            m_triAlive[t] = false;
+            --m_numAlive;
+            continue;
+        }
+
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            if ( tri[j] == iFrom )
+            {
+                tri[j] = iTo;
+            }
+        }
+        toTris.push_back( t );
+    }
+
+    std::vector< int32_t >().swap( fromTris );
+    m_vertAlive[iFrom] = false;
+    m_quadrics[iTo] += m_quadrics[iFrom];
+    ++m_stamps[iFrom];
+    ++m_stamps[iTo];
+
+    // drop the triangles that died from iTo's list while we are here
+    size_t numKept = 0;
+    for ( size_t i = 0; i < toTris.size(); ++i )
+    {
+        if ( m_triAlive[toTris[i]] )
+        {
+            toTris[numKept++] = toTris[i];
+        }
+    }
+    toTris.resize( numKept );
+
+    std::vector< int32_t > around;
+    neighbors( iTo, around );
+    for ( size_t i = 0; i < around.size(); ++i )
+    {
+        push( iTo, around[i] );
+    }
+}
+
+//-*****************************************************************************
+void Decimator::collapseTo( size_t iTarget )
+{
+    while ( m_numAlive > iTarget && !m_queue.empty() )
+    {
+        Collapse c = m_queue.top();
+        m_queue.pop();
+
+        if ( !m_vertAlive[c.from] || !m_vertAlive[c.to] ||
+             m_stamps[c.from] != c.fromStamp ||
+             m_stamps[c.to] != c.toStamp )
+        {
+            continue;
+        }
+
+        if ( isValid( c.from, c.to ) )
+        {
+            collapse( c.from, c.to );
+        }
+    }
+}
+
+//-*****************************************************************************
+void Decimator::emit( PolyMeshLodTopology &oLevel ) const
+{
+    std::vector< int32_t > proxyIndex( m_positions.size(), -1 );
+
+    oLevel.vertexMap.clear();
+    oLevel.faceIndices.clear();
+    oLevel.faceIndices.reserve( m_numAlive * 3 );
+    oLevel.faceCounts.assign( m_numAlive, 3 );
+
+    for ( size_t t = 0; t < m_triAlive.size(); ++t )
+    {
+        if ( !m_triAlive[t] )
+        {
+            continue;
+        }
+
+        for ( size_t j = 0; j < 3; ++j )
+        {
+            int32_t v = m_tris[t * 3 + j];
+            if ( proxyIndex[v] < 0 )
+            {
+                proxyIndex[v] = ( int32_t ) oLevel.vertexMap.size();
+                oLevel.vertexMap.push_back( v );
+            }
+            oLevel.faceIndices.push_back( proxyIndex[v] );
+        }
+    }
+}
+
+//-*****************************************************************************
+std::string LodName( const std::string &iName, size_t iLevel )
+{
+    std::ostringstream strm;
+    strm << iName << "_lod" << iLevel;
+    return strm.str();
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void PolyMeshLodTopology::getPositions(
+    const Abc::P3fArraySample &iSourcePositions,
+    std::vector<V3f> &oPositions ) const
+{
+    oPositions.resize( vertexMap.size() );
+    for ( size_t i = 0; i < vertexMap.size(); ++i )
+    {
+        ABCA_ASSERT( ( size_t ) vertexMap[i] < iSourcePositions.size(),
+                     "Positions don't match the decimated topology" );
+        oPositions[i] = iSourcePositions[vertexMap[i]];
+    }
+}
+
+//-*****************************************************************************
+void DecimatePolyMesh( const Abc::P3fArraySample &iPositions,
+                       const Abc::Int32ArraySample &iFaceCounts,
+                       const Abc::Int32ArraySample &iFaceIndices,
+                       const std::vector<double> &iFaceRatios,
+                       std::vector<PolyMeshLodTopology> &oLevels )
+{
+    for ( size_t i = 0; i < iFaceRatios.size(); ++i )
+    {
+        ABCA_ASSERT( iFaceRatios[i] > 0.0 && iFaceRatios[i] <= 1.0 &&
+                     ( i == 0 || iFaceRatios[i] < iFaceRatios[i - 1] ),
+                     "LOD face ratios must be in (0, 1] and decreasing" );
+    }
+
+    Decimator decimator( iPositions, iFaceCounts, iFaceIndices );
+    const size_t numTris = decimator.getNumTriangles();
+
+    oLevels.resize( iFaceRatios.size() );
+    for ( size_t i = 0; i < iFaceRatios.size(); ++i )
+    {
+        size_t target = ( size_t ) ( iFaceRatios[i] * numTris + 0.5 );
+        decimator.collapseTo( std::max( target, ( size_t ) 1 ) );
+        decimator.emit( oLevels[i] );
+    }
+}
+
+//-*****************************************************************************
+// The samples handed to the background thread, and what it hands back.
+class PolyMeshLodJob
+{
+public:
+    PolyMeshLodJob() : hasPositions( false ), hasTopology( false ) {}
+
+    std::vector<V3f> positions;
+    std::vector<int32_t> faceCounts;
+    std::vector<int32_t> faceIndices;
+    bool hasPositions;
+    bool hasTopology;
+
+    std::vector<double> ratios;
+
+    // persists across samples, rebuilt only when the topology changes
+    std::vector<PolyMeshLodTopology> levels;
+    std::vector< std::vector<V3f> > proxyPositions;
+
+    std::string error;
+
+    static void run( void * iJob );
+};
+
+//-*****************************************************************************
+void PolyMeshLodJob::run( void * iJob )
+{
+    PolyMeshLodJob * job = static_cast< PolyMeshLodJob * >( iJob );
+
+    try
+    {
+        Abc::P3fArraySample positions( job->positions );
+        if ( job->hasTopology )
+        {
+            Abc::Int32ArraySample counts( job->faceCounts );
+            Abc::Int32ArraySample indices( job->faceIndices );
+            DecimatePolyMesh( positions, counts, indices, job->ratios,
+                              job->levels );
+        }
+
+        job->proxyPositions.resize( job->levels.size() );
+        if ( job->hasPositions )
+        {
+            for ( size_t i = 0; i < job->levels.size(); ++i )
+            {
+                job->levels[i].getPositions( positions,
+                                             job->proxyPositions[i] );
+            }
+        }
+    }
+    catch ( std::exception &e )
+    {
+        job->error = e.what();
+    }
+}
+
+//-*****************************************************************************
+OPolyMeshLodWriter::OPolyMeshLodWriter( OObject iParent,
+                                        const std::string &iName,
+                                        const std::vector<double> &iFaceRatios,
+                                        uint32_t iTimeSamplingIndex,
+                                        bool iBackground )
+    : m_ratios( iFaceRatios )
+    , m_background( iBackground )
+    , m_pending( false )
+    , m_hasTopologyKeys( false )
+    , m_numDecimations( 0 )
+{
+    std::string proxyNames;
+    for ( size_t i = 0; i < m_ratios.size(); ++i )
+    {
+        if ( i != 0 )
+        {
+            proxyNames += ",";
+        }
+        proxyNames += LodName( iName, i + 1 );
+    }
+
+    AbcA::MetaData md;
+    md.set( kLodProxiesKey, proxyNames );
+    m_mesh = OPolyMesh( iParent, iName, md, iTimeSamplingIndex );
+
+    for ( size_t i = 0; i < m_ratios.size(); ++i )
+    {
+        std::ostringstream level;
+        std::ostringstream ratio;
+        level << ( i + 1 );
+        ratio << m_ratios[i];
+
+        AbcA::MetaData lodMd;
+        lodMd.set( kLodSourceKey, iName );
+        lodMd.set( kLodLevelKey, level.str() );
+        lodMd.set( kLodRatioKey, ratio.str() );
+        m_proxies.push_back( OPolyMesh( m_mesh, LodName( iName, i + 1 ),
+                                        lodMd, iTimeSamplingIndex ) );
+    }
+
+    m_job.reset( new PolyMeshLodJob() );
+    m_job->ratios = m_ratios;
+}
+
+//-*****************************************************************************
+OPolyMeshLodWriter::~OPolyMeshLodWriter()
+{
+    // no throwing out of the destructor, the error has already been
+    // reported if flush() was called explicitly
+    try
+    {
+        flush();
+    }
+    catch ( ... )
+    {
+    }
+}
+
+//-*****************************************************************************
+OPolyMesh & OPolyMeshLodWriter::getLod( size_t iLevel )
+{
+    ABCA_ASSERT( iLevel > 0 && iLevel <= m_proxies.size(),
+                 "Invalid LOD level: " << iLevel );
+    return m_proxies[iLevel - 1];
+}
+
+//-*****************************************************************************
+void OPolyMeshLodWriter::set( const OPolyMeshSchema::Sample &iSamp )
+{
+    m_mesh.getSchema().set( iSamp );
+
+    flush();
+
+    PolyMeshLodJob &job = *m_job;
+    const Abc::P3fArraySample &positions = iSamp.getPositions();
+    job.hasPositions = positions.getData() != NULL;
+    if ( job.hasPositions )
+    {
+        job.positions.assign( positions.get(),
+                              positions.get() + positions.size() );
+    }
+
+    const Abc::Int32ArraySample &counts = iSamp.getFaceCounts();
+    const Abc::Int32ArraySample &indices = iSamp.getFaceIndices();
+    job.hasTopology = job.hasPositions && counts.getData() &&
+        indices.getData();
+    if ( job.hasTopology )
+    {
+        // the levels already in the job are for this same topology
+        AbcA::ArraySampleKey countsKey = counts.getKey();
+        AbcA::ArraySampleKey indicesKey = indices.getKey();
+        if ( m_hasTopologyKeys && countsKey == m_countsKey &&
+             indicesKey == m_indicesKey )
+        {
+            job.hasTopology = false;
+        }
+        else
+        {
+            // only kept once the job has decimated it, see flush()
+            m_jobCountsKey = countsKey;
+            m_jobIndicesKey = indicesKey;
+
+            job.faceCounts.assign( counts.get(),
+                                   counts.get() + counts.size() );
+            job.faceIndices.assign( indices.get(),
+                                    indices.get() + indices.size() );
+        }
+    }
+
+    m_pending = true;
+    if ( m_background )
+    {
+        m_worker.reset( new Alembic::Util::thread( &PolyMeshLodJob::run,
+                                                   m_job.get() ) );
+    }
+    else
+    {
+        PolyMeshLodJob::run( m_job.get() );
+    }
+}
+
+//-*****************************************************************************
+void OPolyMeshLodWriter::flush()
+{
+    if ( !m_pending )
+    {
+        return;
+    }
+
+    if ( m_worker )
+    {
+        m_worker->join();
+        m_worker.reset();
+    }
+    m_pending = false;
+
+    PolyMeshLodJob &job = *m_job;
+    if ( !job.error.empty() )
+    {
+        // the levels may be half rebuilt, so the next topology is
+        // decimated again even if it matches the last one
+        m_hasTopologyKeys = false;
+
+        std::string error;
+        error.swap( job.error );
+        ABCA_THROW( "Could not compute LOD proxies: " << error );
+    }
+
+    if ( job.hasTopology )
+    {
+        m_hasTopologyKeys = true;
+        m_countsKey = m_jobCountsKey;
+        m_indicesKey = m_jobIndicesKey;
+        ++m_numDecimations;
+    }
+
+    for ( size_t i = 0; i < m_proxies.size(); ++i )
+    {
+        OPolyMeshSchema::Sample samp;
+        if ( job.hasPositions )
+        {
+            samp.setPositions( Abc::P3fArraySample( job.proxyPositions[i] ) );
+        }
+
+        if ( job.hasTopology )
+        {
+            samp.setFaceIndices(
+                Abc::Int32ArraySample( job.levels[i].faceIndices ) );
+            samp.setFaceCounts(
+                Abc::Int32ArraySample( job.levels[i].faceCounts ) );
+        }
+
+        m_proxies[i].getSchema().set( samp );
+    }
+}
+
+//-*****************************************************************************
+size_t GetNumPolyMeshLods( const IObject &iMesh )
+{
+    std::string proxies = iMesh.getMetaData().get( kLodProxiesKey );
+    if ( proxies.empty() )
+    {
+        return 0;
+    }
+
+    return std::count( proxies.begin(), proxies.end(), ',' ) + 1;
+}
+
+//-*****************************************************************************
+IPolyMesh GetPolyMeshLod( const IPolyMesh &iMesh, size_t iLevel )
+{
+    std::string proxies = iMesh.getMetaData().get( kLodProxiesKey );
+    if ( iLevel == 0 || proxies.empty() )
+    {
+        return iMesh;
+    }
+
+    // walk the comma separated list up to iLevel, stopping at the last one
+    size_t start = 0;
+    size_t end = proxies.find( ',' );
+    for ( size_t i = 1; i < iLevel && end != std::string::npos; ++i )
+    {
+        start = end + 1;
+        end = proxies.find( ',', start );
+    }
+
+    std::string name = proxies.substr( start, end == std::string::npos ?
+                                       std::string::npos : end - start );
+    return IPolyMesh( iMesh, name );
+}
+
+//-*****************************************************************************
+IPolyMesh SelectPolyMeshLod( const IPolyMesh &iMesh,
+                             double iScreenSize,
+                             double iPixelsPerFace,
+                             const Abc::ISampleSelector &iSS )
+{
+    size_t numLods = GetNumPolyMeshLods( iMesh );
+    if ( numLods == 0 || iPixelsPerFace <= 0.0 )
+    {
+        return iMesh;
+    }
+
+    double budget = iScreenSize * iScreenSize / iPixelsPerFace;
+
+    // coarsest first, the first one with enough faces wins
+    for ( size_t level = numLods; level > 0; --level )
+    {
+        IPolyMesh lod = GetPolyMeshLod( iMesh, level );
+        if ( !lod.valid() )
+        {
+            continue;
+        }
+
+        Util::Dimensions dims;
+        lod.getSchema().getFaceCountsProperty().getDimensions( dims, iSS );
+        if ( ( double ) dims.numPoints() >= budget )
+        {
+            return lod;
+        }
+    }
+
+    return iMesh;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,190 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_PolyMeshLod_h
+#define Alembic_AbcGeom_PolyMeshLod_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Thread.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/OPolyMesh.h>
+#include <Alembic/AbcGeom/IPolyMesh.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//! Level of detail proxies are written as child OPolyMesh objects of the
+//! full resolution mesh.  The full resolution mesh lists the names of its
+//! proxies, finest to coarsest and separated by commas, in its MetaData.
+static ALEMBIC_EXPORT_CONST std::string kLodProxiesKey = "lodProxies";
+
+//! Each proxy records the name of the mesh it was built from (its parent),
+//! its level (1 is the finest proxy) and the face ratio it was built with.
+static ALEMBIC_EXPORT_CONST std::string kLodSourceKey = "lodSource";
+static ALEMBIC_EXPORT_CONST std::string kLodLevelKey = "lodLevel";
+static ALEMBIC_EXPORT_CONST std::string kLodRatioKey = "lodRatio";
+
+//-*****************************************************************************
+//! The topology of one decimated level of a mesh.  Decimation only ever
+//! collapses a vertex onto one of its neighbors, so every proxy vertex is
+//! one of the source vertices, and the same topology can be reused for every
+//! sample of an animated mesh whose topology doesn't change.
+class ALEMBIC_EXPORT PolyMeshLodTopology
+{
+public:
+    //! The source vertex index of each proxy vertex.
+    std::vector<int32_t> vertexMap;
+
+    //! The proxy faces, which are always triangles.
+    std::vector<int32_t> faceIndices;
+    std::vector<int32_t> faceCounts;
+
+    //! Gathers the proxy positions out of the source positions.
+    void getPositions( const Abc::P3fArraySample &iSourcePositions,
+                       std::vector<V3f> &oPositions ) const;
+};
+
+//-*****************************************************************************
+//! Decimates a polygon mesh with quadric error metric edge collapses.
+//! The polygons are triangulated and one level is produced for each face
+//! ratio, which is the fraction of the triangles to keep.  The ratios have
+//! to be in (0, 1] and in decreasing order since each level continues to
+//! collapse from the previous one.  A level may keep more faces than asked
+//! for when no further collapse would leave the surface valid.
+ALEMBIC_EXPORT void
+DecimatePolyMesh( const Abc::P3fArraySample &iPositions,
+                  const Abc::Int32ArraySample &iFaceCounts,
+                  const Abc::Int32ArraySample &iFaceIndices,
+                  const std::vector<double> &iFaceRatios,
+                  std::vector<PolyMeshLodTopology> &oLevels );
+
+class PolyMeshLodJob;
+
+//-*****************************************************************************
+//! Writes a full resolution OPolyMesh along with decimated proxies of it.
+//! The proxies are computed on a background thread while the caller
+//! prepares the next sample, and are written out on the calling thread on
+//! the next call to set() or flush(), since archive writing is not thread
+//! safe.  Only positions and topology are carried over to the proxies.
+class ALEMBIC_EXPORT OPolyMeshLodWriter : public Alembic::Util::noncopyable
+{
+public:
+    //! Creates the full resolution mesh iName under iParent, along with one
+    //! proxy per face ratio.  See DecimatePolyMesh for the face ratios.
+    //! If iBackground is false the proxies are computed during set().
+    OPolyMeshLodWriter( OObject iParent,
+                        const std::string &iName,
+                        const std::vector<double> &iFaceRatios,
+                        uint32_t iTimeSamplingIndex = 0,
+                        bool iBackground = true );
+
+    //! Flushes any outstanding proxy samples.
+    ~OPolyMeshLodWriter();
+
+    //! The full resolution mesh.
+    OPolyMesh & getMesh() { return m_mesh; }
+
+    size_t getNumLods() const { return m_proxies.size(); }
+
+    //! The proxy at iLevel, 1 is the finest proxy.
+    OPolyMesh & getLod( size_t iLevel );
+
+    //! Sets the sample on the full resolution mesh and starts computing the
+    //! proxies for it, the positions and any topology are copied so iSamp
+    //! doesn't have to outlive this call.  Topology that matches the last
+    //! topology set is not decimated again.
+    void set( const OPolyMeshSchema::Sample &iSamp );
+
+    //! Waits for the outstanding proxy samples and writes them.
+    void flush();
+
+    //! How many times the topology has been decimated so far, counting
+    //! only the decimations that have been flushed.
+    size_t getNumDecimations() const { return m_numDecimations; }
+
+private:
+
+    OPolyMesh m_mesh;
+    std::vector<OPolyMesh> m_proxies;
+    std::vector<double> m_ratios;
+    bool m_background;
+
+    // a sample has been handed to m_job that hasn't been written yet
+    bool m_pending;
+
+    // the keys of the last decimated topology
+    bool m_hasTopologyKeys;
+    AbcA::ArraySampleKey m_countsKey;
+    AbcA::ArraySampleKey m_indicesKey;
+    size_t m_numDecimations;
+
+    // the keys of the topology handed to m_job
+    AbcA::ArraySampleKey m_jobCountsKey;
+    AbcA::ArraySampleKey m_jobIndicesKey;
+
+    Util::shared_ptr< PolyMeshLodJob > m_job;
+    Util::shared_ptr< Alembic::Util::thread > m_worker;
+};
+
+//-*****************************************************************************
+// For Reader code:
+
+//! Returns the number of proxies written for iMesh, 0 if it has none.
+ALEMBIC_EXPORT size_t GetNumPolyMeshLods( const IObject &iMesh );
+
+//! Returns the proxy at iLevel, level 0 is iMesh itself.  If iLevel is past
+//! the coarsest proxy, the coarsest proxy is returned.
+ALEMBIC_EXPORT IPolyMesh GetPolyMeshLod( const IPolyMesh &iMesh,
+                                         size_t iLevel );
+
+//! Picks the coarsest level of iMesh that still has enough faces for the
+//! mesh to be drawn iScreenSize pixels across, assuming each face should
+//! cover about iPixelsPerFace pixels.  Only the face counts' dimensions are
+//! read, so this is cheap to call every frame.
+ALEMBIC_EXPORT IPolyMesh
+SelectPolyMeshLod( const IPolyMesh &iMesh,
+                   double iScreenSize,
+                   double iPixelsPerFace = 4.0,
+                   const Abc::ISampleSelector &iSS = Abc::ISampleSelector() );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,354 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/PolyMeshNormals.h>
+#include <Alembic/AbcGeom/SampleCache.h>
+#include <Alembic/Util/Thread.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+// below this many faces or vertices the threads cost more than they save
+static const size_t kGrainSize = 16384;
+
+//-*****************************************************************************
+// Fills in every corner's contribution to the normal of its vertex.
+class FaceNormals
+{
+public:
+    FaceNormals( const Abc::P3fArraySample &iPositions,
+                 const Abc::Int32ArraySample &iFaceIndices,
+                 const std::vector<size_t> &iFaceStarts,
+                 NormalWeighting iWeighting,
+                 std::vector<V3f> &oCorners )
+        : m_positions( iPositions.get() )
+        , m_indices( iFaceIndices.get() )
+        , m_faceStarts( iFaceStarts )
+        , m_weighting( iWeighting )
+        , m_corners( oCorners )
+    {}
+
+    void operator()( size_t iBegin, size_t iEnd ) const
+    {
+        for ( size_t f = iBegin; f < iEnd; ++f )
+        {
+            const size_t start = m_faceStarts[f];
+            const size_t count = m_faceStarts[f + 1] - start;
+            const int32_t * face = m_indices + start;
+
+            // Newell's method, negated since the faces are clockwise.  The
+            // length is twice the area of the polygon.
+            V3f n( 0.0f, 0.0f, 0.0f );
+            for ( size_t i = 0; i < count; ++i )
+            {
+                const V3f &a = m_positions[face[i]];
+                const V3f &b = m_positions[face[( i + 1 ) % count]];
+                n.x -= ( a.y - b.y ) * ( a.z + b.z );
+                n.y -= ( a.z - b.z ) * ( a.x + b.x );
+                n.z -= ( a.x - b.x ) * ( a.y + b.y );
+            }
+
+            V3f * corners = &m_corners[start];
+            if ( m_weighting == kAreaWeighting )
+            {
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    corners[i] = n;
+                }
+                continue;
+            }
+
+            float len = n.length();
+            if ( len > 0.0f )
+            {
+                n /= len;
+            }
+
+            for ( size_t i = 0; i < count; ++i )
+            {
+                const V3f &p = m_positions[face[i]];
+                V3f prev = m_positions[face[( i + count - 1 ) % count]] - p;
+                V3f next = m_positions[face[( i + 1 ) % count]] - p;
+                float denom = prev.length() * next.length();
+                float angle = 0.0f;
+                if ( denom > 0.0f )
+                {
+                    angle = acosf( Imath::clamp( prev.dot( next ) / denom,
+                                                 -1.0f, 1.0f ) );
+                }
+                corners[i] = n * angle;
+            }
+        }
+    }
+
+private:
+    const V3f * m_positions;
+    const int32_t * m_indices;
+    const std::vector<size_t> &m_faceStarts;
+    NormalWeighting m_weighting;
+    std::vector<V3f> &m_corners;
+};
+
+//-*****************************************************************************
+// Sums the corners around every vertex and normalizes.
+class VertexNormals
+{
+public:
+    VertexNormals( const std::vector<V3f> &iCorners,
+                   const std::vector<size_t> &iVertStarts,
+                   const std::vector<size_t> &iVertCorners,
+                   N3f * oNormals )
+        : m_corners( iCorners )
+        , m_vertStarts( iVertStarts )
+        , m_vertCorners( iVertCorners )
+        , m_normals( oNormals )
+    {}
+
+    void operator()( size_t iBegin, size_t iEnd ) const
+    {
+        for ( size_t v = iBegin; v < iEnd; ++v )
+        {
+            float x = 0.0f;
+            float y = 0.0f;
+            float z = 0.0f;
+            const size_t end = m_vertStarts[v + 1];
+            for ( size_t i = m_vertStarts[v]; i < end; ++i )
+            {
+                const V3f &c = m_corners[m_vertCorners[i]];
+                x += c.x;
+                y += c.y;
+                z += c.z;
+            }
+
+            float len = sqrtf( x * x + y * y + z * z );
+            if ( len > 0.0f )
+            {
+                m_normals[v] = N3f( x / len, y / len, z / len );
+            }
+            else
+            {
+                m_normals[v] = N3f( 0.0f, 0.0f, 0.0f );
+            }
+        }
+    }
+
+private:
+    const std::vector<V3f> &m_corners;
+    const std::vector<size_t> &m_vertStarts;
+    const std::vector<size_t> &m_vertCorners;
+    N3f * m_normals;
+};
+
+//-*****************************************************************************
+void computeNormals( const Abc::P3fArraySample &iPositions,
+                     const Abc::Int32ArraySample &iFaceCounts,
+                     const Abc::Int32ArraySample &iFaceIndices,
+                     NormalWeighting iWeighting,
+                     N3f * oNormals )
+{
+    const size_t numVerts = iPositions.size();
+    const size_t numFaces = iFaceCounts.size();
+    const size_t numIndices = iFaceIndices.size();
+
+    std::vector<size_t> faceStarts( numFaces + 1 );
+    faceStarts[0] = 0;
+    for ( size_t f = 0; f < numFaces; ++f )
+    {
+        ABCA_ASSERT( iFaceCounts[f] >= 0, "Negative face count" );
+        faceStarts[f + 1] = faceStarts[f] + iFaceCounts[f];
+    }
+    ABCA_ASSERT( faceStarts[numFaces] <= numIndices,
+                 "Face counts don't match the face indices" );
+
+    // bucket the corners by vertex, so each vertex can be summed up by
+    // one thread without any locking
+    std::vector<size_t> vertStarts( numVerts + 1, 0 );
+    const size_t numCorners = faceStarts[numFaces];
+    for ( size_t i = 0; i < numCorners; ++i )
+    {
+        int32_t v = iFaceIndices[i];
+        ABCA_ASSERT( v >= 0 && ( size_t ) v < numVerts,
+                     "Face index out of range of the positions" );
+        ++vertStarts[v + 1];
+    }
+
+    for ( size_t v = 0; v < numVerts; ++v )
+    {
+        vertStarts[v + 1] += vertStarts[v];
+    }
+
+    std::vector<size_t> vertCorners( numCorners );
+    std::vector<size_t> fill( vertStarts.begin(), vertStarts.end() - 1 );
+    for ( size_t i = 0; i < numCorners; ++i )
+    {
+        vertCorners[fill[iFaceIndices[i]]++] = i;
+    }
+
+    std::vector<V3f> corners( numCorners );
+    FaceNormals faceNormals( iPositions, iFaceIndices, faceStarts,
+                             iWeighting, corners );
+    Alembic::Util::parallel_for( numFaces, kGrainSize, faceNormals );
+
+    VertexNormals vertexNormals( corners, vertStarts, vertCorners, oNormals );
+    Alembic::Util::parallel_for( numVerts, kGrainSize, vertexNormals );
+}
+
+//-*****************************************************************************
+class NormalsCacheKey
+    : public Alembic::Util::totally_ordered<NormalsCacheKey>
+{
+public:
+    AbcA::ArraySampleKey positions;
+    AbcA::ArraySampleKey counts;
+    AbcA::ArraySampleKey indices;
+    NormalWeighting weighting;
+
+    bool operator==( const NormalsCacheKey &iRhs ) const
+    {
+        return positions == iRhs.positions && counts == iRhs.counts &&
+            indices == iRhs.indices && weighting == iRhs.weighting;
+    }
+
+    bool operator<( const NormalsCacheKey &iRhs ) const
+    {
+        if ( positions != iRhs.positions )
+        {
+            return positions < iRhs.positions;
+        }
+
+        if ( counts != iRhs.counts )
+        {
+            return counts < iRhs.counts;
+        }
+
+        if ( indices != iRhs.indices )
+        {
+            return indices < iRhs.indices;
+        }
+
+        return weighting < iRhs.weighting;
+    }
+};
+
+//-*****************************************************************************
+typedef SampleCache< NormalsCacheKey, Abc::N3fArraySamplePtr > NormalsCache;
+
+NormalsCache & getNormalsCache()
+{
+    static NormalsCache cache( 128 * 1024 * 1024 );
+    return cache;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void ComputePolyMeshNormals( const Abc::P3fArraySample &iPositions,
+                             const Abc::Int32ArraySample &iFaceCounts,
+                             const Abc::Int32ArraySample &iFaceIndices,
+                             NormalWeighting iWeighting,
+                             std::vector<N3f> &oNormals )
+{
+    oNormals.resize( iPositions.size() );
+    if ( oNormals.empty() )
+    {
+        return;
+    }
+
+    computeNormals( iPositions, iFaceCounts, iFaceIndices, iWeighting,
+                    &oNormals.front() );
+}
+
+//-*****************************************************************************
+Abc::N3fArraySamplePtr
+ComputeCachedPolyMeshNormals( const Abc::IP3fArrayProperty &iPositions,
+                              const Abc::IInt32ArrayProperty &iFaceCounts,
+                              const Abc::IInt32ArrayProperty &iFaceIndices,
+                              NormalWeighting iWeighting,
+                              const Abc::ISampleSelector &iSS )
+{
+    NormalsCacheKey key;
+    key.weighting = iWeighting;
+    bool hasKey = iPositions.getKey( key.positions, iSS ) &&
+        iFaceCounts.getKey( key.counts, iSS ) &&
+        iFaceIndices.getKey( key.indices, iSS );
+
+    NormalsCache &cache = getNormalsCache();
+    if ( hasKey )
+    {
+        Abc::N3fArraySamplePtr found = cache.find( key );
+        if ( found )
+        {
+            return found;
+        }
+    }
+
+    Abc::P3fArraySamplePtr positions = iPositions.getValue( iSS );
+    Abc::Int32ArraySamplePtr counts = iFaceCounts.getValue( iSS );
+    Abc::Int32ArraySamplePtr indices = iFaceIndices.getValue( iSS );
+
+    const size_t numVerts = positions->size();
+    N3f * normals = new N3f[numVerts];
+    Abc::N3fArraySamplePtr result(
+        new Abc::N3fArraySample( normals, Alembic::Util::Dimensions(
+            numVerts ) ), AbcA::TArrayDeleter<N3f>() );
+
+    computeNormals( *positions, *counts, *indices, iWeighting, normals );
+
+    if ( hasKey )
+    {
+        cache.insert( key, result );
+    }
+
+    return result;
+}
+
+//-*****************************************************************************
+void SetPolyMeshNormalsCacheMaxBytes( size_t iMaxBytes )
+{
+    getNormalsCache().setMaxBytes( iMaxBytes );
+}
+
+//-*****************************************************************************
+void ClearPolyMeshNormalsCache()
+{
+    getNormalsCache().clear();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,95 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_PolyMeshNormals_h
+#define Alembic_AbcGeom_PolyMeshNormals_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//! How the faces around a vertex contribute to its smooth normal.
+enum NormalWeighting
+{
+    //! Each face contributes in proportion to its area.
+    kAreaWeighting = 0,
+
+    //! Each face contributes in proportion to the angle of its corner at
+    //! the vertex, which doesn't depend on how the faces are tessellated.
+    kAngleWeighting = 1
+};
+
+//! Computes smooth per vertex normals for a polygon mesh.  Faces are wound
+//! clockwise as AbcGeom expects, and are treated as planar using Newell's
+//! method.  Vertices which aren't used by any face get a zero normal.
+//! The faces and then the vertices are processed in parallel.
+ALEMBIC_EXPORT void
+ComputePolyMeshNormals( const Abc::P3fArraySample &iPositions,
+                        const Abc::Int32ArraySample &iFaceCounts,
+                        const Abc::Int32ArraySample &iFaceIndices,
+                        NormalWeighting iWeighting,
+                        std::vector<N3f> &oNormals );
+
+//! Computes the smooth per vertex normals for the sample at iSS.  The result
+//! is shared through a process wide cache keyed on the positions and
+//! topology sample digests, so a shape that repeats over time or across
+//! objects is only read and computed once.  Samples whose keys aren't
+//! available are computed without being cached.
+ALEMBIC_EXPORT Abc::N3fArraySamplePtr
+ComputeCachedPolyMeshNormals( const Abc::IP3fArrayProperty &iPositions,
+                              const Abc::IInt32ArrayProperty &iFaceCounts,
+                              const Abc::IInt32ArrayProperty &iFaceIndices,
+                              NormalWeighting iWeighting = kAreaWeighting,
+                              const Abc::ISampleSelector &iSS =
+                              Abc::ISampleSelector() );
+
+//! Limits how many bytes of normals the cache holds on to, the oldest
+//! entries are dropped first.  0 disables the cache.  Defaults to 128 MB.
+ALEMBIC_EXPORT void SetPolyMeshNormalsCacheMaxBytes( size_t iMaxBytes );
+
+//! Drops everything held by the normals cache.
+ALEMBIC_EXPORT void ClearPolyMeshNormalsCache();
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
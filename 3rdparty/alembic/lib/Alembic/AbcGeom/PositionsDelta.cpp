@@ -0,0 +1,195 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/PositionsDelta.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+inline Util::uint32_t floatBits( float iVal )
+{
+    Util::uint32_t bits;
+    memcpy( &bits, &iVal, sizeof( bits ) );
+    return bits;
+}
+
+//-*****************************************************************************
+inline Util::uint8_t numLowBytes( Util::uint32_t iVal )
+{
+    Util::uint8_t n = 0;
+    while ( iVal != 0 )
+    {
+        iVal >>= 8;
+        ++n;
+    }
+    return n;
+}
+
+// the leading byte of every delta
+const Util::uint8_t kSameAsKeyframe = 0;
+const Util::uint8_t kXorDelta = 1;
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void EncodePositionsDelta( const Abc::P3fArraySample &iKeyframe,
+                           const Abc::P3fArraySample &iPositions,
+                           std::vector<Util::uint8_t> &oDelta )
+{
+    ABCA_ASSERT( iKeyframe.size() == iPositions.size(),
+                 "Positions delta needs a keyframe of the same size" );
+
+    const size_t numFloats = iPositions.size() * 3;
+    if ( numFloats == 0 ||
+         memcmp( iKeyframe.getData(), iPositions.getData(),
+                 numFloats * sizeof( float ) ) == 0 )
+    {
+        EncodePositionsKeyframe( oDelta );
+        return;
+    }
+
+    oDelta.clear();
+
+    const float * key = reinterpret_cast< const float * >(
+        iKeyframe.getData() );
+    const float * pos = reinterpret_cast< const float * >(
+        iPositions.getData() );
+
+    // the worst case is every float needing all 4 bytes
+    oDelta.reserve( 1 + numFloats * 4 + ( numFloats + 1 ) / 2 );
+    oDelta.push_back( kXorDelta );
+
+    for ( size_t i = 0; i < numFloats; i += 2 )
+    {
+        Util::uint32_t x[2] = { 0, 0 };
+        Util::uint8_t n[2] = { 0, 0 };
+        size_t count = std::min( numFloats - i, ( size_t ) 2 );
+        for ( size_t j = 0; j < count; ++j )
+        {
+            x[j] = floatBits( key[i + j] ) ^ floatBits( pos[i + j] );
+            n[j] = numLowBytes( x[j] );
+        }
+
+        oDelta.push_back( n[0] | ( n[1] << 4 ) );
+        for ( size_t j = 0; j < count; ++j )
+        {
+            for ( Util::uint8_t b = 0; b < n[j]; ++b )
+            {
+                oDelta.push_back( ( x[j] >> ( 8 * b ) ) & 0xff );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void EncodePositionsKeyframe( std::vector<Util::uint8_t> &oDelta )
+{
+    oDelta.assign( 1, kSameAsKeyframe );
+}
+
+//-*****************************************************************************
+bool IsPositionsKeyframe( const Abc::UcharArraySample &iDelta )
+{
+    ABCA_ASSERT( iDelta.size() > 0 &&
+                 ( iDelta[0] == kSameAsKeyframe || iDelta[0] == kXorDelta ),
+                 "Positions delta is corrupt" );
+
+    return iDelta[0] == kSameAsKeyframe;
+}
+
+//-*****************************************************************************
+Abc::P3fArraySamplePtr
+DecodePositionsDelta( const Abc::P3fArraySamplePtr &iKeyframe,
+                      const Abc::UcharArraySample &iDelta )
+{
+    if ( IsPositionsKeyframe( iDelta ) )
+    {
+        ABCA_ASSERT( iDelta.size() == 1, "Positions delta is too long" );
+        return iKeyframe;
+    }
+
+    const size_t numPoints = iKeyframe->size();
+    const size_t numFloats = numPoints * 3;
+
+    ABCA_ASSERT( numPoints > 0, "Positions delta doesn't match its keyframe" );
+
+    V3f * points = new V3f[numPoints];
+    Abc::P3fArraySamplePtr result(
+        new Abc::P3fArraySample( points, numPoints ),
+        AbcA::TArrayDeleter<V3f>() );
+
+    memcpy( points, iKeyframe->getData(), numFloats * sizeof( float ) );
+
+    const Util::uint8_t * cur = iDelta.get() + 1;
+    const Util::uint8_t * end = iDelta.get() + iDelta.size();
+    float * out = reinterpret_cast< float * >( points );
+
+    for ( size_t i = 0; i < numFloats; i += 2 )
+    {
+        ABCA_ASSERT( cur < end, "Positions delta is too short" );
+
+        Util::uint8_t n[2] = { static_cast< Util::uint8_t >( *cur & 0x0f ),
+                               static_cast< Util::uint8_t >( *cur >> 4 ) };
+        ++cur;
+
+        size_t count = std::min( numFloats - i, ( size_t ) 2 );
+        for ( size_t j = 0; j < count; ++j )
+        {
+            ABCA_ASSERT( n[j] <= 4 && ( size_t )( end - cur ) >= n[j],
+                         "Positions delta is corrupt" );
+
+            Util::uint32_t x = 0;
+            for ( Util::uint8_t b = 0; b < n[j]; ++b, ++cur )
+            {
+                x |= ( ( Util::uint32_t ) *cur ) << ( 8 * b );
+            }
+
+            Util::uint32_t bits = floatBits( out[i + j] ) ^ x;
+            memcpy( &out[i + j], &bits, sizeof( bits ) );
+        }
+    }
+
+    ABCA_ASSERT( cur == end, "Positions delta is too long" );
+
+    return result;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,102 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_PositionsDelta_h
+#define Alembic_AbcGeom_PositionsDelta_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//! Meshes can store P as keyframes plus deltas, see
+//! OPolyMeshSchema::setPositionsKeyframeInterval.  P is then only written in
+//! full on the keyframes and repeats the keyframe in between, which costs
+//! nothing on disk, while this property holds one small lossless delta per
+//! sample against whatever P holds for that sample.  Readers which don't know
+//! about the deltas see the keyframes, held until the next one.
+static ALEMBIC_EXPORT_CONST std::string kPositionsDeltaPropertyName =
+    ".Pdelta";
+
+//! MetaData key on the delta property holding the keyframe interval.
+static ALEMBIC_EXPORT_CONST std::string kPositionsKeyframeIntervalKey =
+    "keyframeInterval";
+
+//! MetaData key on the delta property holding the version of the delta
+//! layout.  The deltas are only applied when it is kPositionsDeltaVersion;
+//! a delta property without it was written next to a full P, which can be
+//! read as is.  Newer versions are refused.
+static ALEMBIC_EXPORT_CONST std::string kPositionsDeltaVersionKey =
+    "deltaVersion";
+
+static const Util::uint32_t kPositionsDeltaVersion = 2;
+
+//! Encodes iPositions against iKeyframe, which must be the same size.  The
+//! delta starts with a byte saying whether the positions are the keyframe
+//! exactly, in which case nothing follows.  Otherwise each float is XORed
+//! bitwise with its keyframe float, which is lossless, and only the low
+//! bytes which aren't zero are kept.  The byte counts of two floats are
+//! packed into one leading byte.  The delta is never empty.
+ALEMBIC_EXPORT void
+EncodePositionsDelta( const Abc::P3fArraySample &iKeyframe,
+                      const Abc::P3fArraySample &iPositions,
+                      std::vector<Util::uint8_t> &oDelta );
+
+//! Encodes the delta of a keyframe against itself, the single byte which
+//! EncodePositionsDelta writes for positions matching their keyframe.
+ALEMBIC_EXPORT void
+EncodePositionsKeyframe( std::vector<Util::uint8_t> &oDelta );
+
+//! Returns true if iDelta says the positions are the keyframe exactly.
+//! Throws if the delta is empty or of an unknown kind.
+ALEMBIC_EXPORT bool
+IsPositionsKeyframe( const Abc::UcharArraySample &iDelta );
+
+//! Rebuilds the positions encoded by EncodePositionsDelta.  Throws if the
+//! delta doesn't match the keyframe.
+ALEMBIC_EXPORT Abc::P3fArraySamplePtr
+DecodePositionsDelta( const Abc::P3fArraySamplePtr &iKeyframe,
+                      const Abc::UcharArraySample &iDelta );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,149 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_SampleCache_h
+#define Alembic_AbcGeom_SampleCache_h
+
+#include <Alembic/AbcGeom/Foundation.h>
+
+#include <list>
+#include <map>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+// A thread safe cache of typed array samples derived from other samples,
+// keyed by whatever identifies the inputs (usually their ArraySampleKeys).
+// Entries are evicted least recently used first once the cached samples
+// take up more than the byte budget, and a sample bigger than the whole
+// budget is never cached.
+template <class KEY, class SAMPLEPTR>
+class SampleCache : public Alembic::Util::noncopyable
+{
+public:
+    typedef typename SAMPLEPTR::element_type::value_type value_type;
+
+    explicit SampleCache( size_t iMaxBytes )
+      : m_maxBytes( iMaxBytes ), m_numBytes( 0 ) {}
+
+    // Returns NULL if iKey isn't cached.
+    SAMPLEPTR find( const KEY &iKey )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        typename EntryMap::iterator it = m_entries.find( iKey );
+        if ( it == m_entries.end() )
+        {
+            return SAMPLEPTR();
+        }
+
+        // most recently used goes to the back
+        m_order.splice( m_order.end(), m_order, it->second.order );
+        return it->second.sample;
+    }
+
+    void insert( const KEY &iKey, SAMPLEPTR iVal )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        size_t numBytes = numBytesOf( iVal );
+        if ( numBytes > m_maxBytes || m_entries.count( iKey ) )
+        {
+            return;
+        }
+
+        Entry &entry = m_entries[iKey];
+        entry.sample = iVal;
+        entry.order = m_order.insert( m_order.end(), iKey );
+        m_numBytes += numBytes;
+        trim();
+    }
+
+    void setMaxBytes( size_t iMaxBytes )
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_maxBytes = iMaxBytes;
+        trim();
+    }
+
+    void clear()
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        m_entries.clear();
+        m_order.clear();
+        m_numBytes = 0;
+    }
+
+private:
+    struct Entry
+    {
+        SAMPLEPTR sample;
+        typename std::list< KEY >::iterator order;
+    };
+
+    typedef std::map< KEY, Entry > EntryMap;
+
+    static size_t numBytesOf( const SAMPLEPTR &iVal )
+    {
+        return iVal->size() * sizeof( value_type );
+    }
+
+    // drops the least recently used entries, caller holds the lock
+    void trim()
+    {
+        while ( m_numBytes > m_maxBytes && !m_order.empty() )
+        {
+            typename EntryMap::iterator it = m_entries.find( m_order.front() );
+            m_numBytes -= numBytesOf( it->second.sample );
+            m_entries.erase( it );
+            m_order.pop_front();
+        }
+    }
+
+    Alembic::Util::mutex m_lock;
+    EntryMap m_entries;
+    std::list< KEY > m_order;
+    size_t m_maxBytes;
+    size_t m_numBytes;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
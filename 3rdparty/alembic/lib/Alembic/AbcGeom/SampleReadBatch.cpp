@@ -0,0 +1,132 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/SampleReadBatch.h>
+#include <Alembic/Util/Thread.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+class SampleReadBatch::Reader
+{
+public:
+    Reader( const std::vector<Entry> &iEntries,
+            const Abc::ISampleSelector &iSS )
+        : m_entries( iEntries )
+        , m_selector( iSS )
+    {}
+
+    void operator()( size_t iBegin, size_t iEnd ) const
+    {
+        for ( size_t i = iBegin; i < iEnd; ++i )
+        {
+            const Entry &entry = m_entries[i];
+            if ( entry.assign )
+            {
+                AbcA::ArraySamplePtr samp;
+                entry.array.get( samp, m_selector );
+                entry.assign( entry.dest, samp );
+            }
+            else
+            {
+                entry.scalar.get( entry.dest, m_selector );
+            }
+        }
+    }
+
+private:
+    const std::vector<Entry> &m_entries;
+    const Abc::ISampleSelector &m_selector;
+};
+
+//-*****************************************************************************
+void SampleReadBatch::add( const Abc::IArrayProperty &iProp,
+                           AbcA::ArraySamplePtr &oSample )
+{
+    Entry entry;
+    entry.array = iProp;
+    entry.dest = &oSample;
+    entry.assign = &assignUntyped;
+    m_entries.push_back( entry );
+}
+
+//-*****************************************************************************
+void SampleReadBatch::add( const Abc::IScalarProperty &iProp, void *oSample )
+{
+    Entry entry;
+    entry.scalar = iProp;
+    entry.dest = oSample;
+    m_entries.push_back( entry );
+}
+
+//-*****************************************************************************
+void SampleReadBatch::assignUntyped( void *iDest,
+                                     const AbcA::ArraySamplePtr &iSamp )
+{
+    *static_cast< AbcA::ArraySamplePtr * >( iDest ) = iSamp;
+}
+
+//-*****************************************************************************
+void SampleReadBatch::read( size_t iMaxThreads, size_t iSerialBytes )
+{
+    std::vector<Entry> entries;
+    entries.swap( m_entries );
+
+    for ( size_t i = 0; i < entries.size() && iSerialBytes > 0; ++i )
+    {
+        if ( entries[i].assign )
+        {
+            Alembic::Util::Dimensions dims;
+            entries[i].array.getDimensions( dims, m_selector );
+            size_t numBytes = dims.numPoints() *
+                entries[i].array.getDataType().getNumBytes();
+            if ( numBytes < iSerialBytes )
+            {
+                iMaxThreads = 1;
+            }
+            break;
+        }
+    }
+
+    // every read gets its own chunk, the reads themselves are the slow part
+    Reader reader( entries, m_selector );
+    Alembic::Util::parallel_for( entries.size(), 1, reader, iMaxThreads );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
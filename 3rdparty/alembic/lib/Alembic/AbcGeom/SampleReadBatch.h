@@ -0,0 +1,145 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcGeom_SampleReadBatch_h
+#define Alembic_AbcGeom_SampleReadBatch_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! Samples smaller than this are read on the calling thread, starting the
+//! threads would cost more than the reads, see SampleReadBatch::read.
+static const size_t kSerialSampleReadBytes = 256 * 1024;
+
+//-*****************************************************************************
+//! Collects property reads for one sample selector and then does them all
+//! at once, spread over several threads.  Each thread reads through its own
+//! archive stream, so with an Ogawa archive opened with more than one
+//! stream the reads overlap instead of waiting on each other.  This is what
+//! the getParallel methods of the geometry schemas use.
+class ALEMBIC_EXPORT SampleReadBatch
+{
+public:
+    explicit SampleReadBatch( const Abc::ISampleSelector &iSS =
+                              Abc::ISampleSelector() )
+        : m_selector( iSS ) {}
+
+    //! Queues a read of iProp into oSample.  oSample must stay alive until
+    //! read() returns.
+    void add( const Abc::IArrayProperty &iProp,
+              AbcA::ArraySamplePtr &oSample );
+
+    //! Queues a read of a typed array property.
+    template <class TRAITS>
+    void add( const Abc::ITypedArrayProperty<TRAITS> &iProp,
+              typename Abc::ITypedArrayProperty<TRAITS>::sample_ptr_type
+              &oSample )
+    {
+        Entry entry;
+        entry.array = iProp;
+        entry.dest = &oSample;
+        entry.assign = &assignTyped<TRAITS>;
+        m_entries.push_back( entry );
+    }
+
+    //! Queues a read of a scalar property into oSample, which must be big
+    //! enough for it, just like IScalarProperty::get.
+    void add( const Abc::IScalarProperty &iProp, void *oSample );
+
+    //! Queues a read of a typed scalar property.
+    template <class TRAITS>
+    void add( const Abc::ITypedScalarProperty<TRAITS> &iProp,
+              typename TRAITS::value_type &oSample )
+    {
+        add( static_cast<const Abc::IScalarProperty &>( iProp ),
+             static_cast<void *>( &oSample ) );
+    }
+
+    size_t size() const { return m_entries.size(); }
+
+    //! Does every queued read, on up to iMaxThreads threads (0 means one
+    //! per core, up to the number of reads), and clears the queue.  If any
+    //! read fails the first error is thrown once they have all finished.
+    //! When the first array read queued is smaller than iSerialBytes
+    //! everything is read on the calling thread instead.  Only that one is
+    //! sized, since sizing every read would cost as many round trips as
+    //! the reads, so queue the biggest property first.
+    void read( size_t iMaxThreads = 0,
+               size_t iSerialBytes = kSerialSampleReadBytes );
+
+private:
+    struct Entry
+    {
+        Entry() : dest( NULL ), assign( NULL ) {}
+
+        // assign is only set for array reads
+        Abc::IArrayProperty array;
+        Abc::IScalarProperty scalar;
+        void * dest;
+        void ( *assign )( void *, const AbcA::ArraySamplePtr & );
+    };
+
+    template <class TRAITS>
+    static void assignTyped( void *iDest, const AbcA::ArraySamplePtr &iSamp )
+    {
+        typedef typename Abc::ITypedArrayProperty<TRAITS>::sample_type
+            sample_type;
+        *static_cast< Alembic::Util::shared_ptr<sample_type> * >( iDest ) =
+            Alembic::Util::static_pointer_cast<sample_type,
+                                               AbcA::ArraySample>( iSamp );
+    }
+
+    static void assignUntyped( void *iDest,
+                               const AbcA::ArraySamplePtr &iSamp );
+
+    class Reader;
+
+    Abc::ISampleSelector m_selector;
+    std::vector<Entry> m_entries;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,219 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+void offsetsTest()
+{
+    int32_t numVerts[] = { 4, 0, 2, 7 };
+    UInt64ArraySamplePtr offsets =
+        ComputeCurveOffsets( Int32ArraySample( numVerts, 4 ) );
+    TESTING_ASSERT( offsets->size() == 5 );
+    TESTING_ASSERT( ( *offsets )[0] == 0 && ( *offsets )[1] == 4 &&
+                    ( *offsets )[2] == 4 && ( *offsets )[3] == 6 &&
+                    ( *offsets )[4] == 13 );
+
+    std::vector<V3f> pos( 13 );
+    for ( size_t i = 0; i < pos.size(); ++i )
+    {
+        pos[i] = V3f( ( float ) i, 0.0f, 0.0f );
+    }
+    P3fArraySamplePtr posSamp( new P3fArraySample( pos ) );
+
+    CurveStrands strands( posSamp, offsets );
+    TESTING_ASSERT( strands.getNumCurves() == 4 );
+    TESTING_ASSERT( strands.getTotalVertices() == 13 );
+    TESTING_ASSERT( strands.getNumVertices( 1 ) == 0 );
+    TESTING_ASSERT( strands.getStrand( 3 ) == &pos[6] );
+
+    CurveStrands range = strands.getRange( 2, 4 );
+    TESTING_ASSERT( range.getFirstCurve() == 2 );
+    TESTING_ASSERT( range.getNumCurves() == 2 );
+    TESTING_ASSERT( range.getTotalVertices() == 9 );
+    TESTING_ASSERT( range.getStrand( 0 ) == &pos[4] );
+    TESTING_ASSERT( range.getRange( 1, 1 ).getTotalVertices() == 0 );
+
+    TESTING_ASSERT_THROW( strands.getRange( 3, 5 ),
+                          Alembic::Util::Exception );
+
+    // not enough positions for the curves
+    pos.resize( 12 );
+    TESTING_ASSERT_THROW( CurveStrands( P3fArraySamplePtr(
+        new P3fArraySample( pos ) ), offsets ), Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+void strandsTest()
+{
+    const size_t numCurves = 1000;
+    std::vector<int32_t> numVerts( numCurves );
+    std::vector<V3f> pos;
+    for ( size_t i = 0; i < numCurves; ++i )
+    {
+        numVerts[i] = 2 + ( int32_t ) ( ( i * 7 ) % 13 );
+        for ( int32_t j = 0; j < numVerts[i]; ++j )
+        {
+            pos.push_back( V3f( ( float ) i, ( float ) j, 0.0f ) );
+        }
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "curveStrands.abc" );
+        OCurvesSchema curves =
+            OCurves( OObject( archive, kTop ), "hair" ).getSchema();
+
+        for ( size_t i = 0; i < 2; ++i )
+        {
+            curves.set( OCurvesSchema::Sample( P3fArraySample( pos ),
+                Int32ArraySample( numVerts ), kLinear ) );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "curveStrands.abc" );
+    ICurvesSchema curves =
+        ICurves( IObject( archive, kTop ), "hair" ).getSchema();
+
+    ClearCurveOffsetsCache();
+
+    UInt64ArraySamplePtr offsets = curves.getCurveOffsets( 0 );
+    TESTING_ASSERT( offsets->size() == numCurves + 1 );
+    TESTING_ASSERT( ( *offsets )[numCurves] == pos.size() );
+
+    // same topology, so the cached offsets are shared
+    TESTING_ASSERT( curves.getCurveOffsets( 1 ) == offsets );
+
+    CurveStrands strands;
+    curves.getStrands( strands, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( strands.getOffsets() == offsets );
+    TESTING_ASSERT( strands.getNumCurves() == numCurves );
+
+    std::vector<CurveStrands> ranges;
+    strands.split( 8, ranges );
+    TESTING_ASSERT( ranges.size() == 8 );
+
+    size_t nextCurve = 0;
+    for ( size_t r = 0; r < ranges.size(); ++r )
+    {
+        const CurveStrands &range = ranges[r];
+        TESTING_ASSERT( range.getFirstCurve() == nextCurve );
+        TESTING_ASSERT( range.getPositions() == strands.getPositions() );
+
+        // roughly an eighth of the vertices each
+        TESTING_ASSERT( range.getTotalVertices() > pos.size() / 10 );
+        TESTING_ASSERT( range.getTotalVertices() < pos.size() / 6 );
+
+        for ( size_t c = 0; c < range.getNumCurves(); ++c )
+        {
+            size_t curve = range.getFirstCurve() + c;
+            TESTING_ASSERT( range.getNumVertices( c ) ==
+                            ( size_t ) numVerts[curve] );
+            TESTING_ASSERT( range.getStrand( c )[0] ==
+                            V3f( ( float ) curve, 0.0f, 0.0f ) );
+        }
+        nextCurve += range.getNumCurves();
+    }
+    TESTING_ASSERT( nextCurve == numCurves );
+
+    // more ranges than curves
+    strands.getRange( 10, 13 ).split( 5, ranges );
+    TESTING_ASSERT( ranges.size() == 3 );
+    TESTING_ASSERT( ranges[2].getFirstCurve() == 12 );
+}
+
+//-*****************************************************************************
+void cacheEvictionTest()
+{
+    // three samples with different topologies, 3 curves each so each set of
+    // offsets is 4 * 8 bytes
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "curveOffsetsCache.abc" );
+        OCurvesSchema curves =
+            OCurves( OObject( archive, kTop ), "hair" ).getSchema();
+
+        for ( int32_t i = 0; i < 3; ++i )
+        {
+            std::vector<int32_t> numVerts( 3, 2 );
+            numVerts[0] += i;
+
+            std::vector<V3f> pos( 6 + i );
+            curves.set( OCurvesSchema::Sample( P3fArraySample( pos ),
+                Int32ArraySample( numVerts ), kLinear ) );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "curveOffsetsCache.abc" );
+    ICurvesSchema curves =
+        ICurves( IObject( archive, kTop ), "hair" ).getSchema();
+
+    ClearCurveOffsetsCache();
+    SetCurveOffsetsCacheMaxBytes( 64 );
+
+    UInt64ArraySamplePtr a = curves.getCurveOffsets( 0 );
+    UInt64ArraySamplePtr b = curves.getCurveOffsets( 1 );
+
+    // touching a makes b the least recently used, so c evicts b
+    TESTING_ASSERT( curves.getCurveOffsets( 0 ) == a );
+    UInt64ArraySamplePtr c = curves.getCurveOffsets( 2 );
+
+    TESTING_ASSERT( curves.getCurveOffsets( 2 ) == c );
+    TESTING_ASSERT( curves.getCurveOffsets( 0 ) == a );
+    TESTING_ASSERT( curves.getCurveOffsets( 1 ) != b );
+
+    // too big to cache at all
+    SetCurveOffsetsCacheMaxBytes( 16 );
+    TESTING_ASSERT( curves.getCurveOffsets( 0 ) != a );
+
+    SetCurveOffsetsCacheMaxBytes( 64 * 1024 * 1024 );
+    ClearCurveOffsetsCache();
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    offsetsTest();
+    strandsTest();
+    cacheEvictionTest();
+    return 0;
+}
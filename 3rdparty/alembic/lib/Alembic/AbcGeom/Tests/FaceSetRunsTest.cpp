@@ -0,0 +1,296 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <fstream>
+#include <limits>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+void runsTest()
+{
+    // out of order, with a duplicate
+    int32_t faceNums[] = { 7, 3, 4, 5, 12, 4, 13, 0 };
+    FaceSetRuns runs( Int32ArraySample( faceNums, 8 ) );
+
+    TESTING_ASSERT( runs.getNumRuns() == 4 );
+    TESTING_ASSERT( runs.getNumFaces() == 7 );
+    TESTING_ASSERT( runs.getRunStart( 1 ) == 3 );
+    TESTING_ASSERT( runs.getRunLength( 1 ) == 3 );
+
+    for ( int32_t i = -2; i < 16; ++i )
+    {
+        bool expected = std::find( faceNums, faceNums + 8, i ) !=
+            faceNums + 8;
+        TESTING_ASSERT( runs.contains( i ) == expected );
+    }
+
+    std::vector<int32_t> faces;
+    runs.getFaces( faces );
+    TESTING_ASSERT( faces.size() == 7 );
+    TESTING_ASSERT( faces[0] == 0 && faces[3] == 5 && faces[6] == 13 );
+
+    FaceSetRuns same = FaceSetRuns::fromRuns(
+        Int32ArraySample( runs.getRuns() ) );
+    TESTING_ASSERT( same.getRuns() == runs.getRuns() );
+
+    int32_t overlapping[] = { 0, 4, 2, 4 };
+    TESTING_ASSERT_THROW( FaceSetRuns::fromRuns(
+        Int32ArraySample( overlapping, 4 ) ), Alembic::Util::Exception );
+
+    TESTING_ASSERT( !FaceSetRuns().contains( 0 ) );
+
+    // runs ending at the largest face number don't overflow
+    const int32_t maxFace = std::numeric_limits<int32_t>::max();
+    int32_t highFaces[] = { maxFace, maxFace - 1, 5 };
+    FaceSetRuns high( Int32ArraySample( highFaces, 3 ) );
+    TESTING_ASSERT( high.getNumRuns() == 2 );
+    TESTING_ASSERT( high.getRunStart( 1 ) == maxFace - 1 );
+    TESTING_ASSERT( high.getRunLength( 1 ) == 2 );
+    TESTING_ASSERT( high.contains( maxFace ) && !high.contains( 6 ) );
+
+    faces.clear();
+    high.getFaces( faces );
+    TESTING_ASSERT( faces.size() == 3 && faces[2] == maxFace );
+
+    int32_t pastMax[] = { maxFace, 2 };
+    TESTING_ASSERT_THROW( FaceSetRuns::fromRuns(
+        Int32ArraySample( pastMax, 2 ) ), Alembic::Util::Exception );
+    int32_t atMax[] = { maxFace, 1 };
+    TESTING_ASSERT( FaceSetRuns::fromRuns(
+        Int32ArraySample( atMax, 2 ) ).contains( maxFace ) );
+
+    // the first set wins where they overlap
+    std::vector<FaceSetRuns> sets;
+    int32_t first[] = { 2, 3 };
+    int32_t second[] = { 0, 1, 2, 3, 4, 20 };
+    sets.push_back( FaceSetRuns( Int32ArraySample( first, 2 ) ) );
+    sets.push_back( FaceSetRuns( Int32ArraySample( second, 6 ) ) );
+
+    std::vector<int32_t> ids;
+    GetFaceSetIds( sets, 6, ids );
+    TESTING_ASSERT( ids.size() == 6 );
+    TESTING_ASSERT( ids[0] == 1 && ids[1] == 1 && ids[2] == 0 &&
+                    ids[3] == 0 && ids[4] == 1 && ids[5] == -1 );
+}
+
+//-*****************************************************************************
+void schemaTest()
+{
+    const int32_t numFaces = 100;
+
+    std::vector<int32_t> most;
+    std::vector<int32_t> scattered;
+    for ( int32_t i = 0; i < numFaces; ++i )
+    {
+        if ( i < 90 && ( i < 40 || i > 44 ) )
+        {
+            most.push_back( i );
+        }
+
+        if ( i % 7 == 0 )
+        {
+            scattered.push_back( i );
+        }
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                          "faceSetRuns.abc" );
+        OPolyMesh meshObj( OObject( archive, kTop ), "mesh" );
+        OPolyMeshSchema &mesh = meshObj.getSchema();
+
+        std::vector<V3f> pos( numFaces * 3 );
+        std::vector<int32_t> indices( numFaces * 3 );
+        std::vector<int32_t> counts( numFaces, 3 );
+        for ( size_t i = 0; i < indices.size(); ++i )
+        {
+            indices[i] = ( int32_t ) i;
+            pos[i] = V3f( ( float ) i, 0.0f, ( float ) ( i % 3 ) );
+        }
+
+        mesh.set( OPolyMeshSchema::Sample( P3fArraySample( pos ),
+            Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+
+        OFaceSetSchema mostSet = mesh.createFaceSet( "most" ).getSchema();
+        mostSet.setRunLengthEncoding( true );
+        mostSet.set( OFaceSetSchema::Sample( Int32ArraySample( most ) ) );
+
+        // too scattered to be stored as runs
+        OFaceSetSchema scatteredSet =
+            mesh.createFaceSet( "scattered" ).getSchema();
+        scatteredSet.setRunLengthEncoding( true );
+        scatteredSet.set(
+            OFaceSetSchema::Sample( Int32ArraySample( scattered ) ) );
+
+        // starts scattered, then turns into runs
+        OFaceSetSchema changing =
+            mesh.createFaceSet( "changing" ).getSchema();
+        changing.setRunLengthEncoding( true );
+        changing.set(
+            OFaceSetSchema::Sample( Int32ArraySample( scattered ) ) );
+        changing.set( OFaceSetSchema::Sample( Int32ArraySample( most ) ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "faceSetRuns.abc" );
+    IPolyMesh meshObj( IObject( archive, kTop ), "mesh" );
+    IPolyMeshSchema &mesh = meshObj.getSchema();
+
+    IFaceSetSchema mostSet = mesh.getFaceSet( "most" ).getSchema();
+    TESTING_ASSERT( mostSet.getFaceRunsProperty().valid() );
+    TESTING_ASSERT( mostSet.isConstant() );
+    TESTING_ASSERT( mostSet.getFaceRunsProperty().getValue()->size() == 4 );
+
+    // the runs replace the faces
+    TESTING_ASSERT( mostSet.getFacesProperty().getValue()->size() == 0 );
+
+    IFaceSetSchema::Sample samp;
+    mostSet.get( samp );
+    TESTING_ASSERT( samp.getFaces()->size() == most.size() );
+    TESTING_ASSERT( std::equal( most.begin(), most.end(),
+                                samp.getFaces()->get() ) );
+
+    FaceSetRuns runs;
+    mostSet.getFaceRuns( runs );
+    TESTING_ASSERT( runs.getNumRuns() == 2 );
+    TESTING_ASSERT( runs.contains( 39 ) && !runs.contains( 40 ) &&
+                    runs.contains( 45 ) && !runs.contains( 90 ) );
+
+    IFaceSetSchema scatteredSet =
+        mesh.getFaceSet( "scattered" ).getSchema();
+    TESTING_ASSERT( !scatteredSet.getFaceRunsProperty().valid() );
+    scatteredSet.getFaceRuns( runs );
+    TESTING_ASSERT( runs.getNumFaces() == scattered.size() );
+    TESTING_ASSERT( runs.contains( 49 ) && !runs.contains( 50 ) );
+
+    IFaceSetSchema changing = mesh.getFaceSet( "changing" ).getSchema();
+    TESTING_ASSERT( changing.getNumSamples() == 2 );
+    TESTING_ASSERT( !changing.isConstant() );
+    changing.get( samp, ISampleSelector( ( index_t ) 0 ) );
+    TESTING_ASSERT( samp.getFaces()->size() == scattered.size() );
+    changing.get( samp, ISampleSelector( ( index_t ) 1 ) );
+    TESTING_ASSERT( samp.getFaces()->size() == most.size() );
+    TESTING_ASSERT( changing.getFaceRunsProperty().getNumSamples() == 2 );
+    TESTING_ASSERT( changing.getFaceRunsProperty().getValue(
+        ISampleSelector( ( index_t ) 0 ) )->size() == 0 );
+    TESTING_ASSERT( changing.getFacesProperty().getValue(
+        ISampleSelector( ( index_t ) 1 ) )->size() == 0 );
+    changing.getFaceRuns( runs, ISampleSelector( ( index_t ) 0 ) );
+    TESTING_ASSERT( runs.getNumFaces() == scattered.size() );
+
+    std::vector<std::string> names;
+    std::vector<int32_t> ids;
+    mesh.getFaceSetIds( names, ids );
+    TESTING_ASSERT( names.size() == 3 );
+    TESTING_ASSERT( ids.size() == ( size_t ) numFaces );
+
+    std::vector<Int32ArraySamplePtr> setFaces;
+    for ( size_t s = 0; s < names.size(); ++s )
+    {
+        setFaces.push_back(
+            mesh.getFaceSet( names[s] ).getSchema().getValue().getFaces() );
+    }
+
+    for ( int32_t i = 0; i < numFaces; ++i )
+    {
+        int32_t expected = -1;
+        for ( size_t s = 0; s < setFaces.size() && expected < 0; ++s )
+        {
+            const int32_t * faces = setFaces[s]->get();
+            const int32_t * end = faces + setFaces[s]->size();
+            if ( std::find( faces, end, i ) != end )
+            {
+                expected = ( int32_t ) s;
+            }
+        }
+        TESTING_ASSERT( ids[i] == expected );
+    }
+}
+
+//-*****************************************************************************
+size_t writeFaces( const std::string &iName, bool iRunLengthEncoding )
+{
+    std::vector<int32_t> faces;
+    for ( int32_t i = 0; i < 100000; ++i )
+    {
+        if ( i < 50000 || i >= 60000 )
+        {
+            faces.push_back( i );
+        }
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        OFaceSetSchema faceSet =
+            OFaceSet( OObject( archive, kTop ), "faces" ).getSchema();
+        faceSet.setRunLengthEncoding( iRunLengthEncoding );
+        faceSet.set( OFaceSetSchema::Sample( Int32ArraySample( faces ) ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IFaceSetSchema faceSet =
+        IFaceSet( IObject( archive, kTop ), "faces" ).getSchema();
+    Int32ArraySamplePtr readFaces = faceSet.getValue().getFaces();
+    TESTING_ASSERT( readFaces->size() == faces.size() );
+    TESTING_ASSERT( std::equal( faces.begin(), faces.end(),
+                                readFaces->get() ) );
+
+    std::ifstream file( iName.c_str(), std::ios::binary | std::ios::ate );
+    return ( size_t ) file.tellg();
+}
+
+//-*****************************************************************************
+void sizeTest()
+{
+    // only the runs are written, not the faces as well
+    size_t plainSize = writeFaces( "faceSetPlain.abc", false );
+    size_t runsSize = writeFaces( "faceSetRunsOnly.abc", true );
+    TESTING_ASSERT( runsSize * 10 < plainSize );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    runsTest();
+    schemaTest();
+    sizeTest();
+    return 0;
+}
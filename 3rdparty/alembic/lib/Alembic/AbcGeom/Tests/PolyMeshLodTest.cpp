@@ -0,0 +1,261 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// a wavy grid of iRes x iRes quads, offset in y by iTime
+void makeGrid( size_t iRes, float iTime, std::vector<V3f> &oPos,
+               std::vector<int32_t> &oIndices, std::vector<int32_t> &oCounts )
+{
+    oPos.clear();
+    oIndices.clear();
+    oCounts.clear();
+
+    for ( size_t j = 0; j <= iRes; ++j )
+    {
+        for ( size_t i = 0; i <= iRes; ++i )
+        {
+            float x = ( float ) i / ( float ) iRes;
+            float z = ( float ) j / ( float ) iRes;
+            oPos.push_back( V3f( x, 0.1f * sinf( 6.0f * x ) + iTime, z ) );
+        }
+    }
+
+    for ( size_t j = 0; j < iRes; ++j )
+    {
+        for ( size_t i = 0; i < iRes; ++i )
+        {
+            int32_t a = ( int32_t ) ( j * ( iRes + 1 ) + i );
+            oIndices.push_back( a );
+            oIndices.push_back( a + ( int32_t ) iRes + 1 );
+            oIndices.push_back( a + ( int32_t ) iRes + 2 );
+            oIndices.push_back( a + 1 );
+            oCounts.push_back( 4 );
+        }
+    }
+}
+
+//-*****************************************************************************
+void decimateTest()
+{
+    std::vector<V3f> pos;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> counts;
+    makeGrid( 16, 0.0f, pos, indices, counts );
+
+    std::vector<double> ratios;
+    ratios.push_back( 0.5 );
+    ratios.push_back( 0.1 );
+
+    std::vector<PolyMeshLodTopology> levels;
+    DecimatePolyMesh( P3fArraySample( pos ), Int32ArraySample( counts ),
+                      Int32ArraySample( indices ), ratios, levels );
+
+    TESTING_ASSERT( levels.size() == 2 );
+
+    // 16 * 16 quads is 512 triangles
+    TESTING_ASSERT( levels[0].faceCounts.size() <= 256 );
+    TESTING_ASSERT( levels[1].faceCounts.size() <= 52 );
+    TESTING_ASSERT( levels[1].faceCounts.size() <
+                    levels[0].faceCounts.size() );
+
+    for ( size_t l = 0; l < levels.size(); ++l )
+    {
+        const PolyMeshLodTopology &level = levels[l];
+        TESTING_ASSERT( level.faceIndices.size() ==
+                        level.faceCounts.size() * 3 );
+
+        for ( size_t i = 0; i < level.faceIndices.size(); ++i )
+        {
+            TESTING_ASSERT( ( size_t ) level.faceIndices[i] <
+                            level.vertexMap.size() );
+        }
+
+        for ( size_t i = 0; i < level.vertexMap.size(); ++i )
+        {
+            TESTING_ASSERT( ( size_t ) level.vertexMap[i] < pos.size() );
+        }
+
+        // the 4 corners of the grid stay put
+        TESTING_ASSERT( std::find( level.vertexMap.begin(),
+            level.vertexMap.end(), 0 ) != level.vertexMap.end() );
+        TESTING_ASSERT( std::find( level.vertexMap.begin(),
+            level.vertexMap.end(), 16 ) != level.vertexMap.end() );
+        TESTING_ASSERT( std::find( level.vertexMap.begin(),
+            level.vertexMap.end(), 16 * 17 ) != level.vertexMap.end() );
+        TESTING_ASSERT( std::find( level.vertexMap.begin(),
+            level.vertexMap.end(), 17 * 17 - 1 ) != level.vertexMap.end() );
+    }
+}
+
+//-*****************************************************************************
+void writeLods( const std::string &iName, bool iBackground )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+
+    std::vector<double> ratios;
+    ratios.push_back( 0.25 );
+    ratios.push_back( 0.05 );
+
+    OPolyMeshLodWriter writer( OObject( archive, kTop ), "grid", ratios, 0,
+                               iBackground );
+    TESTING_ASSERT( writer.getNumLods() == 2 );
+
+    std::vector<V3f> pos;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> counts;
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        makeGrid( 20, ( float ) i, pos, indices, counts );
+
+        // the first two samples carry the same topology, which is only
+        // decimated once
+        if ( i < 2 )
+        {
+            writer.set( OPolyMeshSchema::Sample( P3fArraySample( pos ),
+                Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+        }
+        else
+        {
+            writer.set( OPolyMeshSchema::Sample( P3fArraySample( pos ) ) );
+        }
+    }
+
+    TESTING_ASSERT( writer.getNumDecimations() == 1 );
+}
+
+//-*****************************************************************************
+void readLods( const std::string &iName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IPolyMesh grid( IObject( archive, kTop ), "grid" );
+
+    TESTING_ASSERT( GetNumPolyMeshLods( grid ) == 2 );
+    TESTING_ASSERT( grid.getNumChildren() == 2 );
+
+    IPolyMesh lod1 = GetPolyMeshLod( grid, 1 );
+    IPolyMesh lod2 = GetPolyMeshLod( grid, 2 );
+    TESTING_ASSERT( lod1.getName() == "grid_lod1" );
+    TESTING_ASSERT( lod2.getName() == "grid_lod2" );
+    TESTING_ASSERT( GetPolyMeshLod( grid, 0 ).getName() == "grid" );
+    TESTING_ASSERT( GetPolyMeshLod( grid, 7 ).getName() == "grid_lod2" );
+
+    TESTING_ASSERT( lod1.getMetaData().get( kLodSourceKey ) == "grid" );
+    TESTING_ASSERT( lod2.getMetaData().get( kLodLevelKey ) == "2" );
+    TESTING_ASSERT( lod2.getMetaData().get( kLodRatioKey ) == "0.05" );
+
+    TESTING_ASSERT( lod1.getSchema().getNumSamples() == 3 );
+    TESTING_ASSERT( lod2.getSchema().getNumSamples() == 3 );
+    TESTING_ASSERT( lod2.getSchema().isConstant() == false );
+    TESTING_ASSERT( lod2.getSchema().getTopologyVariance() ==
+                    kHomogenousTopology );
+
+    for ( size_t i = 0; i < 3; ++i )
+    {
+        IPolyMeshSchema::Sample samp;
+        lod2.getSchema().get( samp, ISampleSelector( ( index_t ) i ) );
+
+        // 800 triangles in the source
+        TESTING_ASSERT( samp.getFaceCounts()->size() <= 40 );
+
+        Box3d bnds = samp.getSelfBounds();
+        TESTING_ASSERT( bnds.min.x == 0.0 && bnds.max.x == 1.0 );
+        TESTING_ASSERT( bnds.min.z == 0.0 && bnds.max.z == 1.0 );
+        TESTING_ASSERT( bnds.min.y >= ( double ) i - 0.1 );
+        TESTING_ASSERT( bnds.max.y <= ( double ) i + 0.1 );
+    }
+
+    // 20 * 20 quads
+    TESTING_ASSERT( SelectPolyMeshLod( grid, 1000.0 ).getName() == "grid" );
+    TESTING_ASSERT( SelectPolyMeshLod( grid, 1.0 ).getName() == "grid_lod2" );
+
+    Dimensions lod1Faces;
+    lod1.getSchema().getFaceCountsProperty().getDimensions( lod1Faces );
+    double lod1Size = sqrt( 4.0 * lod1Faces.numPoints() );
+    TESTING_ASSERT( SelectPolyMeshLod( grid, lod1Size ).getName() ==
+                    "grid_lod1" );
+}
+
+//-*****************************************************************************
+void failedDecimationTest( bool iBackground )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+                      "polyMeshLodFailed.abc" );
+
+    std::vector<double> ratios( 1, 0.25 );
+    OPolyMeshLodWriter writer( OObject( archive, kTop ), "grid", ratios, 0,
+                               iBackground );
+
+    std::vector<V3f> pos;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> counts;
+    makeGrid( 20, 0.0f, pos, indices, counts );
+
+    // too few positions for the indices
+    std::vector<V3f> shortPos( pos.begin(), pos.begin() + pos.size() / 2 );
+    writer.set( OPolyMeshSchema::Sample( P3fArraySample( shortPos ),
+        Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+    TESTING_ASSERT_THROW( writer.flush(), Alembic::Util::Exception );
+    TESTING_ASSERT( writer.getNumDecimations() == 0 );
+
+    // the same topology isn't taken as already decimated
+    writer.set( OPolyMeshSchema::Sample( P3fArraySample( pos ),
+        Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+    writer.flush();
+    TESTING_ASSERT( writer.getNumDecimations() == 1 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    decimateTest();
+
+    writeLods( "polyMeshLod.abc", true );
+    readLods( "polyMeshLod.abc" );
+
+    writeLods( "polyMeshLodSync.abc", false );
+    readLods( "polyMeshLodSync.abc" );
+
+    failedDecimationTest( true );
+    failedDecimationTest( false );
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// a unit cube around the origin, with clockwise faces
+static const V3f g_cubePos[8] = {
+    V3f( -0.5f, -0.5f, -0.5f ), V3f( 0.5f, -0.5f, -0.5f ),
+    V3f( 0.5f, 0.5f, -0.5f ), V3f( -0.5f, 0.5f, -0.5f ),
+    V3f( -0.5f, -0.5f, 0.5f ), V3f( 0.5f, -0.5f, 0.5f ),
+    V3f( 0.5f, 0.5f, 0.5f ), V3f( -0.5f, 0.5f, 0.5f ) };
+
+static const int32_t g_cubeIndices[24] = {
+    1, 2, 3, 0,
+    7, 6, 5, 4,
+    4, 5, 1, 0,
+    2, 6, 7, 3,
+    3, 7, 4, 0,
+    5, 6, 2, 1 };
+
+static const int32_t g_cubeCounts[6] = { 4, 4, 4, 4, 4, 4 };
+
+// the same cube with the +z face split along the 7 - 5 diagonal
+static const int32_t g_splitIndices[26] = {
+    1, 2, 3, 0,
+    7, 6, 5,
+    7, 5, 4,
+    4, 5, 1, 0,
+    2, 6, 7, 3,
+    3, 7, 4, 0,
+    5, 6, 2, 1 };
+
+static const int32_t g_splitCounts[7] = { 4, 3, 3, 4, 4, 4, 4 };
+
+//-*****************************************************************************
+void checkCubeNormals( const N3f * iNormals, size_t iNumNormals )
+{
+    TESTING_ASSERT( iNumNormals == 8 );
+    for ( size_t i = 0; i < 8; ++i )
+    {
+        V3f expected = g_cubePos[i].normalized();
+        TESTING_ASSERT( iNormals[i].equalWithAbsError( expected, 1e-5f ) );
+    }
+}
+
+//-*****************************************************************************
+void computeTest()
+{
+    P3fArraySample pos( g_cubePos, 8 );
+    Int32ArraySample indices( g_cubeIndices, 24 );
+    Int32ArraySample counts( g_cubeCounts, 6 );
+
+    std::vector<N3f> normals;
+    ComputePolyMeshNormals( pos, counts, indices, kAreaWeighting, normals );
+    checkCubeNormals( &normals.front(), normals.size() );
+
+    ComputePolyMeshNormals( pos, counts, indices, kAngleWeighting, normals );
+    checkCubeNormals( &normals.front(), normals.size() );
+
+    // splitting a face doesn't change the angle weighted normals
+    Int32ArraySample splitIndices( g_splitIndices, 26 );
+    Int32ArraySample splitCounts( g_splitCounts, 7 );
+    ComputePolyMeshNormals( pos, splitCounts, splitIndices, kAngleWeighting,
+                            normals );
+    checkCubeNormals( &normals.front(), normals.size() );
+
+    // but the area weighted ones lean away from the smaller triangles
+    // at the corners which only touch one of them
+    ComputePolyMeshNormals( pos, splitCounts, splitIndices, kAreaWeighting,
+                            normals );
+    TESTING_ASSERT( normals.size() == 8 );
+    TESTING_ASSERT( normals[5].equalWithAbsError(
+        g_cubePos[5].normalized(), 1e-5f ) );
+    TESTING_ASSERT( !normals[6].equalWithAbsError(
+        g_cubePos[6].normalized(), 1e-3f ) );
+    TESTING_ASSERT( normals[6].z < normals[6].x );
+
+    // unused points get a zero normal
+    std::vector<V3f> morePos( g_cubePos, g_cubePos + 8 );
+    morePos.push_back( V3f( 2.0f, 2.0f, 2.0f ) );
+    ComputePolyMeshNormals( P3fArraySample( morePos ), counts, indices,
+                            kAreaWeighting, normals );
+    TESTING_ASSERT( normals.size() == 9 );
+    TESTING_ASSERT( normals[8] == N3f( 0.0f, 0.0f, 0.0f ) );
+
+    // bad topology is an error
+    int32_t badIndices[24];
+    std::copy( g_cubeIndices, g_cubeIndices + 24, badIndices );
+    badIndices[3] = 8;
+    bool threw = false;
+    try
+    {
+        ComputePolyMeshNormals( pos, counts, Int32ArraySample( badIndices, 24 ),
+                                kAreaWeighting, normals );
+    }
+    catch ( Alembic::Util::Exception & )
+    {
+        threw = true;
+    }
+    TESTING_ASSERT( threw );
+}
+
+//-*****************************************************************************
+void schemaTest()
+{
+    std::string archiveName = "polyMeshNormals.abc";
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(),
+            archiveName );
+
+        OPolyMeshSchema plain =
+            OPolyMesh( OObject( archive, kTop ), "plain" ).getSchema();
+
+        P3fArraySample pos( g_cubePos, 8 );
+        Int32ArraySample indices( g_cubeIndices, 24 );
+        Int32ArraySample counts( g_cubeCounts, 6 );
+
+        std::vector<V3f> moved( g_cubePos, g_cubePos + 8 );
+        moved[6] = V3f( 1.0f, 1.0f, 1.0f );
+
+        // the first and last samples have the same shape
+        plain.set( OPolyMeshSchema::Sample( pos, indices, counts ) );
+        plain.set( OPolyMeshSchema::Sample( P3fArraySample( moved ),
+                                            indices, counts ) );
+        plain.set( OPolyMeshSchema::Sample( pos, indices, counts ) );
+
+        OPolyMeshSchema withN =
+            OPolyMesh( OObject( archive, kTop ), "withN" ).getSchema();
+
+        std::vector<N3f> flat( 8, N3f( 0.0f, 1.0f, 0.0f ) );
+        ON3fGeomParam::Sample nsamp( N3fArraySample( flat ), kVertexScope );
+        OPolyMeshSchema::Sample samp( pos, indices, counts );
+        samp.setNormals( nsamp );
+        withN.set( samp );
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+            archiveName );
+
+        ClearPolyMeshNormalsCache();
+
+        IPolyMeshSchema plain =
+            IPolyMesh( IObject( archive, kTop ), "plain" ).getSchema();
+        TESTING_ASSERT( !plain.getNormalsParam().valid() );
+
+        IN3fGeomParam::Sample first;
+        plain.getNormals( first, ISampleSelector( ( index_t ) 0 ) );
+        TESTING_ASSERT( first.valid() );
+        TESTING_ASSERT( first.getScope() == kVertexScope );
+        TESTING_ASSERT( !first.isIndexed() );
+        checkCubeNormals( first.getVals()->get(), first.getVals()->size() );
+
+        IN3fGeomParam::Sample second;
+        plain.getNormals( second, ISampleSelector( ( index_t ) 1 ) );
+        TESTING_ASSERT( second.getVals() != first.getVals() );
+
+        // same P digest and topology, so the cached normals come back
+        IN3fGeomParam::Sample third;
+        plain.getNormals( third, ISampleSelector( ( index_t ) 2 ) );
+        TESTING_ASSERT( third.getVals() == first.getVals() );
+
+        // a different weighting is a different cache entry
+        IN3fGeomParam::Sample angle;
+        plain.getNormals( angle, ISampleSelector( ( index_t ) 2 ),
+                          kAngleWeighting );
+        TESTING_ASSERT( angle.getVals() != first.getVals() );
+        checkCubeNormals( angle.getVals()->get(), angle.getVals()->size() );
+
+        // nothing is kept once the cache is disabled
+        SetPolyMeshNormalsCacheMaxBytes( 0 );
+        IN3fGeomParam::Sample uncached;
+        plain.getNormals( uncached, ISampleSelector( ( index_t ) 0 ) );
+        TESTING_ASSERT( uncached.getVals() != first.getVals() );
+        checkCubeNormals( uncached.getVals()->get(),
+                          uncached.getVals()->size() );
+        SetPolyMeshNormalsCacheMaxBytes( 128 * 1024 * 1024 );
+
+        // stored normals are passed through untouched
+        IPolyMeshSchema withN =
+            IPolyMesh( IObject( archive, kTop ), "withN" ).getSchema();
+        IN3fGeomParam::Sample stored;
+        withN.getNormals( stored );
+        TESTING_ASSERT( stored.getVals()->size() == 8 );
+        TESTING_ASSERT( ( *stored.getVals() )[3] == N3f( 0.0f, 1.0f, 0.0f ) );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    computeTest();
+    schemaTest();
+    return 0;
+}
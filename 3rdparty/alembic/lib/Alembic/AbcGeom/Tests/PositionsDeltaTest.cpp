@@ -0,0 +1,338 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <fstream>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+// a rippling grid of iRes x iRes quads
+void makeGrid( size_t iRes, float iTime, std::vector<V3f> &oPos,
+               std::vector<int32_t> &oIndices, std::vector<int32_t> &oCounts )
+{
+    oPos.clear();
+    oIndices.clear();
+    oCounts.clear();
+
+    for ( size_t j = 0; j <= iRes; ++j )
+    {
+        for ( size_t i = 0; i <= iRes; ++i )
+        {
+            float x = ( float ) i / ( float ) iRes;
+            float z = ( float ) j / ( float ) iRes;
+            oPos.push_back( V3f( x, 0.01f * sinf( 6.0f * x + iTime ), z ) );
+        }
+    }
+
+    for ( size_t j = 0; j < iRes; ++j )
+    {
+        for ( size_t i = 0; i < iRes; ++i )
+        {
+            int32_t a = ( int32_t ) ( j * ( iRes + 1 ) + i );
+            oIndices.push_back( a );
+            oIndices.push_back( a + 1 );
+            oIndices.push_back( a + ( int32_t ) iRes + 2 );
+            oIndices.push_back( a + ( int32_t ) iRes + 1 );
+            oCounts.push_back( 4 );
+        }
+    }
+}
+
+//-*****************************************************************************
+void codecTest()
+{
+    std::vector<V3f> key;
+    std::vector<V3f> pos;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> counts;
+    makeGrid( 7, 0.0f, key, indices, counts );
+    makeGrid( 7, 0.1f, pos, indices, counts );
+
+    // an odd number of floats, and values that are far from the keyframe
+    key.push_back( V3f( 1.0f, -2.0f, 3.0f ) );
+    pos.push_back( V3f( -1.0e20f, 0.0f, 3.0f ) );
+
+    P3fArraySamplePtr keyPtr( new P3fArraySample( key ) );
+    std::vector<V3f> shorter( key.begin(), key.end() - 1 );
+    P3fArraySamplePtr shorterPtr( new P3fArraySample( shorter ) );
+
+    std::vector<Alembic::Util::uint8_t> delta;
+    EncodePositionsDelta( *keyPtr, P3fArraySample( pos ), delta );
+    TESTING_ASSERT( !IsPositionsKeyframe( UcharArraySample( delta ) ) );
+    TESTING_ASSERT( delta.size() < pos.size() * sizeof( V3f ) );
+
+    P3fArraySamplePtr decoded = DecodePositionsDelta( keyPtr,
+        UcharArraySample( delta ) );
+    TESTING_ASSERT( decoded->size() == pos.size() );
+    TESTING_ASSERT( memcmp( decoded->get(), &pos.front(),
+                            pos.size() * sizeof( V3f ) ) == 0 );
+
+    // a truncated delta is caught
+    std::vector<Alembic::Util::uint8_t> truncated( delta.begin(),
+                                                   delta.end() - 1 );
+    TESTING_ASSERT_THROW( DecodePositionsDelta( keyPtr,
+        UcharArraySample( truncated ) ), Alembic::Util::Exception );
+
+    // matching the keyframe is said explicitly, in a single byte
+    EncodePositionsDelta( *keyPtr, *keyPtr, delta );
+    TESTING_ASSERT( delta.size() == 1 );
+    TESTING_ASSERT( IsPositionsKeyframe( UcharArraySample( delta ) ) );
+    decoded = DecodePositionsDelta( keyPtr, UcharArraySample( delta ) );
+    TESTING_ASSERT( decoded == keyPtr );
+
+    std::vector<Alembic::Util::uint8_t> keyframeDelta;
+    EncodePositionsKeyframe( keyframeDelta );
+    TESTING_ASSERT( keyframeDelta == delta );
+
+    // an empty delta isn't valid
+    std::vector<Alembic::Util::uint8_t> empty;
+    TESTING_ASSERT_THROW( IsPositionsKeyframe( UcharArraySample( empty ) ),
+                          Alembic::Util::Exception );
+
+    // sizes have to match
+    TESTING_ASSERT_THROW( EncodePositionsDelta( *keyPtr,
+        P3fArraySample( shorter ), delta ), Alembic::Util::Exception );
+
+    EncodePositionsDelta( *keyPtr, P3fArraySample( pos ), delta );
+    TESTING_ASSERT_THROW( DecodePositionsDelta( shorterPtr,
+        UcharArraySample( delta ) ), Alembic::Util::Exception );
+}
+
+//-*****************************************************************************
+size_t writeMesh( const std::string &iName, uint32_t iInterval,
+                  size_t iNumFrames, size_t iTopologyChange )
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        OPolyMeshSchema mesh =
+            OPolyMesh( OObject( archive, kTop ), "mesh" ).getSchema();
+        mesh.setPositionsKeyframeInterval( iInterval );
+
+        for ( size_t i = 0; i < iNumFrames; ++i )
+        {
+            std::vector<V3f> pos;
+            std::vector<int32_t> indices;
+            std::vector<int32_t> counts;
+            makeGrid( i < iTopologyChange ? 32 : 31, 0.05f * i, pos, indices,
+                      counts );
+            mesh.set( OPolyMeshSchema::Sample( P3fArraySample( pos ),
+                Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+        }
+    }
+
+    std::ifstream file( iName.c_str(), std::ios::binary | std::ios::ate );
+    return ( size_t ) file.tellg();
+}
+
+//-*****************************************************************************
+void schemaTest()
+{
+    const size_t numFrames = 20;
+    const size_t topologyChange = 14;
+
+    size_t plainSize = writeMesh( "positionsDeltaPlain.abc", 0, numFrames,
+                                  topologyChange );
+    size_t deltaSize = writeMesh( "positionsDelta.abc", 5, numFrames,
+                                  topologyChange );
+    // only the keyframes are written in full
+    TESTING_ASSERT( deltaSize < plainSize );
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "positionsDelta.abc" );
+    IPolyMeshSchema mesh =
+        IPolyMesh( IObject( archive, kTop ), "mesh" ).getSchema();
+    TESTING_ASSERT( mesh.getPositionsDeltaProperty().valid() );
+    TESTING_ASSERT( mesh.getPositionsDeltaProperty().getMetaData().get(
+        kPositionsKeyframeIntervalKey ) == "5" );
+    TESTING_ASSERT( mesh.getPositionsDeltaProperty().getMetaData().get(
+        kPositionsDeltaVersionKey ) == "2" );
+    TESTING_ASSERT( mesh.getNumSamples() == numFrames );
+    TESTING_ASSERT( mesh.getTopologyVariance() == kHeterogenousTopology );
+
+    IArchive plainArchive( Alembic::AbcCoreOgawa::ReadArchive(),
+                           "positionsDeltaPlain.abc" );
+    IPolyMeshSchema plain =
+        IPolyMesh( IObject( plainArchive, kTop ), "mesh" ).getSchema();
+    TESTING_ASSERT( !plain.getPositionsDeltaProperty().valid() );
+
+
+    // in order, so most samples are rebuilt from their deltas, then out of
+    // order, so most of them are read from P
+    size_t order[numFrames * 2];
+    for ( size_t i = 0; i < numFrames; ++i )
+    {
+        order[i] = i;
+        order[i + numFrames] = ( i * 7 ) % numFrames;
+    }
+
+    for ( size_t i = 0; i < numFrames * 2; ++i )
+    {
+        size_t frame = order[i];
+        std::vector<V3f> pos;
+        std::vector<int32_t> indices;
+        std::vector<int32_t> counts;
+        makeGrid( frame < topologyChange ? 32 : 31, 0.05f * frame, pos,
+                  indices, counts );
+
+        IPolyMeshSchema::Sample samp;
+        mesh.get( samp, ISampleSelector( ( index_t ) frame ) );
+        TESTING_ASSERT( samp.getPositions()->size() == pos.size() );
+        TESTING_ASSERT( memcmp( samp.getPositions()->get(), &pos.front(),
+                                pos.size() * sizeof( V3f ) ) == 0 );
+        TESTING_ASSERT( samp.getFaceIndices()->size() == indices.size() );
+
+        IPolyMeshSchema::Sample parallel;
+        mesh.getParallel( parallel, ISampleSelector( ( index_t ) frame ) );
+        TESTING_ASSERT( memcmp( parallel.getPositions()->get(), &pos.front(),
+                                pos.size() * sizeof( V3f ) ) == 0 );
+
+        // keyframes are every 5 samples, counting from the topology change
+        size_t keyframe = frame < topologyChange ? frame - frame % 5 :
+            frame - ( frame - topologyChange ) % 5;
+        UcharArraySamplePtr delta;
+        mesh.getPositionsDeltaProperty().get( delta,
+            ISampleSelector( ( index_t ) frame ) );
+        TESTING_ASSERT( ( keyframe == frame ) ==
+                        IsPositionsKeyframe( *delta ) );
+
+        // P holds the keyframe, as it was written
+        P3fArraySamplePtr a;
+        P3fArraySamplePtr b;
+        plain.getPositionsProperty().get( a,
+            ISampleSelector( ( index_t ) keyframe ) );
+        mesh.getPositionsProperty().get( b,
+            ISampleSelector( ( index_t ) frame ) );
+        TESTING_ASSERT( a->size() == b->size() );
+        TESTING_ASSERT( memcmp( a->get(), b->get(),
+                                a->size() * sizeof( V3f ) ) == 0 );
+
+        // computed normals follow the real positions
+        IN3fGeomParam::Sample normals;
+        IN3fGeomParam::Sample plainNormals;
+        mesh.getNormals( normals, ISampleSelector( ( index_t ) frame ) );
+        plain.getNormals( plainNormals, ISampleSelector( ( index_t ) frame ) );
+        TESTING_ASSERT( normals.getVals()->size() ==
+                        plainNormals.getVals()->size() );
+        TESTING_ASSERT( memcmp( normals.getVals()->get(),
+                                plainNormals.getVals()->get(),
+                                normals.getVals()->size() *
+                                sizeof( N3f ) ) == 0 );
+    }
+
+    // unchanging positions stay constant
+    {
+        OArchive oarchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                           "positionsDeltaStill.abc" );
+        OPolyMeshSchema still =
+            OPolyMesh( OObject( oarchive, kTop ), "still" ).getSchema();
+        still.setPositionsKeyframeInterval( 3 );
+
+        std::vector<V3f> pos;
+        std::vector<int32_t> indices;
+        std::vector<int32_t> counts;
+        makeGrid( 4, 0.0f, pos, indices, counts );
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            still.set( OPolyMeshSchema::Sample( P3fArraySample( pos ),
+                Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+        }
+    }
+
+    IArchive stillArchive( Alembic::AbcCoreOgawa::ReadArchive(),
+                           "positionsDeltaStill.abc" );
+    IPolyMeshSchema still =
+        IPolyMesh( IObject( stillArchive, kTop ), "still" ).getSchema();
+    TESTING_ASSERT( still.getTopologyVariance() == kConstantTopology );
+}
+
+//-*****************************************************************************
+// a sample which matches its keyframe exactly, followed by ones that don't
+void repeatTest()
+{
+    std::vector<V3f> frames[4];
+    std::vector<int32_t> indices;
+    std::vector<int32_t> counts;
+    makeGrid( 6, 0.0f, frames[0], indices, counts );
+    makeGrid( 6, 0.3f, frames[1], indices, counts );
+    frames[2] = frames[0];
+    makeGrid( 6, 0.6f, frames[3], indices, counts );
+
+    {
+        OArchive oarchive( Alembic::AbcCoreOgawa::WriteArchive(),
+                           "positionsDeltaRepeat.abc" );
+        OPolyMeshSchema mesh =
+            OPolyMesh( OObject( oarchive, kTop ), "mesh" ).getSchema();
+        mesh.setPositionsKeyframeInterval( 8 );
+
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            mesh.set( OPolyMeshSchema::Sample( P3fArraySample( frames[i] ),
+                Int32ArraySample( indices ), Int32ArraySample( counts ) ) );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(),
+                      "positionsDeltaRepeat.abc" );
+    IPolyMeshSchema mesh =
+        IPolyMesh( IObject( archive, kTop ), "mesh" ).getSchema();
+    TESTING_ASSERT( mesh.getPositionsProperty().isConstant() );
+
+    for ( size_t pass = 0; pass < 2; ++pass )
+    {
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            size_t frame = pass == 0 ? i : 3 - i;
+            P3fArraySamplePtr pos;
+            mesh.getPositions( pos, ISampleSelector( ( index_t ) frame ) );
+            TESTING_ASSERT( pos->size() == frames[frame].size() );
+            TESTING_ASSERT( memcmp( pos->get(), &frames[frame].front(),
+                pos->size() * sizeof( V3f ) ) == 0 );
+        }
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    codecTest();
+    schemaTest();
+    repeatTest();
+    return 0;
+}
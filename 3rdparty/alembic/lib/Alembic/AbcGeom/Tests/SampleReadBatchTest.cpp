@@ -0,0 +1,221 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <Alembic/AbcGeom/Tests/MeshData.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+template <class SAMPLE_PTR>
+bool sameSample( const SAMPLE_PTR &iA, const SAMPLE_PTR &iB )
+{
+    if ( !iA || !iB )
+    {
+        return !iA && !iB;
+    }
+
+    return iA->getDimensions() == iB->getDimensions() &&
+        memcmp( iA->getData(), iB->getData(),
+                iA->size() * sizeof( typename SAMPLE_PTR::element_type
+                                     ::value_type ) ) == 0;
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string &iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    OObject top( archive, kTop );
+
+    P3fArraySample pos( ( const V3f * ) g_verts, g_numVerts );
+    V3fArraySample vel( ( const V3f * ) g_veloc, g_numVerts );
+    Int32ArraySample indices( g_indices, g_numIndices );
+    Int32ArraySample counts( g_counts, g_numCounts );
+
+    std::vector<V3f> moved( ( const V3f * ) g_verts,
+                            ( const V3f * ) g_verts + g_numVerts );
+    moved[0].x += 0.5f;
+
+    OPolyMeshSchema mesh = OPolyMesh( top, "mesh" ).getSchema();
+    OPolyMeshSchema::Sample meshSamp( pos, indices, counts );
+    meshSamp.setVelocities( vel );
+    mesh.set( meshSamp );
+
+    // delta encoded positions
+    OPolyMeshSchema deltaMesh = OPolyMesh( top, "deltaMesh" ).getSchema();
+    deltaMesh.setPositionsKeyframeInterval( 4 );
+    deltaMesh.set( OPolyMeshSchema::Sample( pos, indices, counts ) );
+    deltaMesh.set( OPolyMeshSchema::Sample( P3fArraySample( moved ),
+                                            indices, counts ) );
+
+    OSubDSchema subd = OSubD( top, "subd" ).getSchema();
+    OSubDSchema::Sample subdSamp( pos, indices, counts );
+    int32_t creaseIndices[] = { 0, 1, 1, 2 };
+    int32_t creaseLengths[] = { 2, 2 };
+    float32_t creaseSharpnesses[] = { 1.5f, 2.5f };
+    int32_t holes[] = { 3 };
+    subdSamp.setCreases( Int32ArraySample( creaseIndices, 4 ),
+                         Int32ArraySample( creaseLengths, 2 ),
+                         FloatArraySample( creaseSharpnesses, 2 ) );
+    subdSamp.setHoles( Int32ArraySample( holes, 1 ) );
+    subdSamp.setInterpolateBoundary( 1 );
+    subdSamp.setSubdivisionScheme( "loop" );
+    subd.set( subdSamp );
+
+    OPointsSchema points = OPoints( top, "points" ).getSchema();
+    std::vector<uint64_t> ids( g_numVerts );
+    for ( size_t i = 0; i < ids.size(); ++i )
+    {
+        ids[i] = i * 3;
+    }
+    points.set( OPointsSchema::Sample( pos, UInt64ArraySample( ids ) ) );
+
+    OCurvesSchema curves = OCurves( top, "curves" ).getSchema();
+    int32_t numCurveVerts[] = { 4, 4 };
+    curves.set( OCurvesSchema::Sample( pos, Int32ArraySample(
+        numCurveVerts, 2 ), kCubic, kNonPeriodic ) );
+}
+
+//-*****************************************************************************
+void readArchive( const std::string &iName )
+{
+    // several streams, so the reads really happen at the same time
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive( 4, false ),
+                      iName );
+    IObject top( archive, kTop );
+
+    IPolyMeshSchema mesh = IPolyMesh( top, "mesh" ).getSchema();
+    IPolyMeshSchema::Sample meshA;
+    IPolyMeshSchema::Sample meshB;
+    mesh.get( meshA );
+    mesh.getParallel( meshB );
+    TESTING_ASSERT( sameSample( meshA.getPositions(), meshB.getPositions() ) );
+    TESTING_ASSERT( sameSample( meshA.getVelocities(),
+                                meshB.getVelocities() ) );
+    TESTING_ASSERT( meshB.getVelocities() );
+    TESTING_ASSERT( sameSample( meshA.getFaceIndices(),
+                                meshB.getFaceIndices() ) );
+    TESTING_ASSERT( sameSample( meshA.getFaceCounts(),
+                                meshB.getFaceCounts() ) );
+    TESTING_ASSERT( meshA.getSelfBounds() == meshB.getSelfBounds() );
+
+    IPolyMeshSchema deltaMesh = IPolyMesh( top, "deltaMesh" ).getSchema();
+    for ( index_t i = 0; i < 2; ++i )
+    {
+        deltaMesh.get( meshA, i );
+        deltaMesh.getParallel( meshB, i, 2 );
+        TESTING_ASSERT( sameSample( meshA.getPositions(),
+                                    meshB.getPositions() ) );
+    }
+    TESTING_ASSERT( ( *meshB.getPositions() )[0].x == g_verts[0] + 0.5f );
+
+    ISubDSchema subd = ISubD( top, "subd" ).getSchema();
+    ISubDSchema::Sample subdA;
+    ISubDSchema::Sample subdB;
+    subd.get( subdA );
+    subd.getParallel( subdB );
+    TESTING_ASSERT( sameSample( subdA.getPositions(), subdB.getPositions() ) );
+    TESTING_ASSERT( sameSample( subdA.getFaceIndices(),
+                                subdB.getFaceIndices() ) );
+    TESTING_ASSERT( sameSample( subdA.getCreaseSharpnesses(),
+                                subdB.getCreaseSharpnesses() ) );
+    TESTING_ASSERT( sameSample( subdA.getHoles(), subdB.getHoles() ) );
+    TESTING_ASSERT( subdB.getCreaseSharpnesses()->size() == 2 );
+    TESTING_ASSERT( subdB.getInterpolateBoundary() == 1 );
+    TESTING_ASSERT( subdB.getFaceVaryingPropagateCorners() == 0 );
+    TESTING_ASSERT( subdB.getSubdivisionScheme() == "loop" );
+    TESTING_ASSERT( subdA.getSelfBounds() == subdB.getSelfBounds() );
+
+    IPointsSchema points = IPoints( top, "points" ).getSchema();
+    IPointsSchema::Sample pointsA;
+    IPointsSchema::Sample pointsB;
+    points.get( pointsA );
+    points.getParallel( pointsB, ISampleSelector(), 1 );
+    TESTING_ASSERT( sameSample( pointsA.getPositions(),
+                                pointsB.getPositions() ) );
+    TESTING_ASSERT( sameSample( pointsA.getIds(), pointsB.getIds() ) );
+    TESTING_ASSERT( !pointsB.getVelocities() );
+
+    ICurvesSchema curves = ICurves( top, "curves" ).getSchema();
+    ICurvesSchema::Sample curvesA;
+    ICurvesSchema::Sample curvesB;
+    curves.get( curvesA );
+    curves.getParallel( curvesB );
+    TESTING_ASSERT( sameSample( curvesA.getPositions(),
+                                curvesB.getPositions() ) );
+    TESTING_ASSERT( sameSample( curvesA.getCurvesNumVertices(),
+                                curvesB.getCurvesNumVertices() ) );
+    TESTING_ASSERT( curvesB.getType() == kCubic );
+    TESTING_ASSERT( curvesB.getWrap() == kNonPeriodic );
+    TESTING_ASSERT( curvesB.getBasis() == curvesA.getBasis() );
+
+    // the same property can be queued more than once
+    SampleReadBatch batch( ISampleSelector( ( index_t ) 1 ) );
+    P3fArraySamplePtr first;
+    P3fArraySamplePtr second;
+    batch.add( deltaMesh.getPositionsProperty(), first );
+    batch.add( deltaMesh.getPositionsProperty(), second );
+    TESTING_ASSERT( batch.size() == 2 );
+    batch.read();
+    TESTING_ASSERT( batch.size() == 0 );
+    TESTING_ASSERT( sameSample( first, second ) );
+
+    // these samples are small enough to be read serially by default, so
+    // force the threads
+    mesh.get( meshA );
+    Int32ArraySamplePtr indices;
+    Int32ArraySamplePtr counts;
+    SampleReadBatch threaded;
+    threaded.add( mesh.getPositionsProperty(), first );
+    threaded.add( mesh.getFaceIndicesProperty(), indices );
+    threaded.add( mesh.getFaceCountsProperty(), counts );
+    threaded.read( 3, 0 );
+    TESTING_ASSERT( sameSample( first, meshA.getPositions() ) );
+    TESTING_ASSERT( sameSample( indices, meshA.getFaceIndices() ) );
+    TESTING_ASSERT( sameSample( counts, meshA.getFaceCounts() ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string name = "sampleReadBatch.abc";
+    writeArchive( name );
+    readArchive( name );
+    return 0;
+}
@@ -0,0 +1,176 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/AbcMaterial/MaterialFlattenCache.h>
+#include <Alembic/AbcMaterial/MaterialAssignment.h>
+#include <Alembic/Util/Thread.h>
+
+namespace Alembic {
+namespace AbcMaterial {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+class FlattenRange
+{
+public:
+    FlattenRange( MaterialFlattenCache & iCache,
+                  const std::vector<Abc::IObject> & iObjects,
+                  std::vector<MaterialFlattenPtr> & oResults )
+    : m_cache( iCache )
+    , m_objects( iObjects )
+    , m_results( oResults )
+    {
+    }
+
+    void operator()( size_t iBegin, size_t iEnd )
+    {
+        for ( size_t i = iBegin; i < iEnd; ++i )
+        {
+            m_results[i] = m_cache.get( m_objects[i] );
+        }
+    }
+
+private:
+    MaterialFlattenCache & m_cache;
+    const std::vector<Abc::IObject> & m_objects;
+    std::vector<MaterialFlattenPtr> & m_results;
+};
+
+}
+
+MaterialFlattenCache::MaterialFlattenCache(
+    Abc::IArchive iAlternateSearchArchive )
+: m_alternateSearchArchive( iAlternateSearchArchive )
+{
+}
+
+std::string MaterialFlattenCache::getKey( Abc::IObject & iObject,
+                                          const std::string & iAssignedPath )
+{
+    std::string key;
+
+    // without an alternate archive the same path may name a different
+    // material in each archive
+    if ( !m_alternateSearchArchive.valid() )
+    {
+        key = iObject.getArchive().getName();
+    }
+
+    key.push_back( '\n' );
+
+    // MaterialFlatten skips empty path components, so collapse them here
+    size_t lastPos = 0;
+    while ( lastPos < iAssignedPath.size() )
+    {
+        size_t curPos = iAssignedPath.find( '/', lastPos );
+        if ( curPos == std::string::npos )
+        {
+            curPos = iAssignedPath.size();
+        }
+
+        if ( curPos != lastPos )
+        {
+            key.push_back( '/' );
+            key.append( iAssignedPath, lastPos, curPos - lastPos );
+        }
+
+        lastPos = curPos + 1;
+    }
+
+    return key;
+}
+
+MaterialFlattenPtr MaterialFlattenCache::get( Abc::IObject iObject )
+{
+    IMaterialSchema localMaterial;
+    if ( hasMaterial( iObject, localMaterial ) )
+    {
+        MaterialFlattenPtr flatten( new MaterialFlatten( iObject,
+            m_alternateSearchArchive ) );
+        flatten->getNumNetworkNodes();
+        return flatten;
+    }
+
+    std::string assignedPath;
+    getMaterialAssignmentPath( iObject, assignedPath );
+    std::string key = getKey( iObject, assignedPath );
+
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        FlattenMap::iterator it = m_flattened.find( key );
+        if ( it != m_flattened.end() )
+        {
+            return it->second;
+        }
+    }
+
+    // walk the chain and flatten the network outside of the lock, so that
+    // other materials can be resolved at the same time, this also means
+    // two threads may race on the same key, the first one stored wins
+    MaterialFlattenPtr flatten( new MaterialFlatten( iObject,
+        m_alternateSearchArchive ) );
+    flatten->getNumNetworkNodes();
+
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_flattened.insert( std::make_pair( key, flatten ) ).first->second;
+}
+
+void MaterialFlattenCache::get( const std::vector<Abc::IObject> & iObjects,
+                                std::vector<MaterialFlattenPtr> & oResults,
+                                size_t iMaxThreads )
+{
+    oResults.clear();
+    oResults.resize( iObjects.size() );
+
+    FlattenRange range( *this, iObjects, oResults );
+    Alembic::Util::parallel_for( iObjects.size(), 64, range, iMaxThreads );
+}
+
+size_t MaterialFlattenCache::size()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_flattened.size();
+}
+
+void MaterialFlattenCache::clear()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_flattened.clear();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcMaterial
+} // End namespace Alembic
@@ -0,0 +1,104 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_AbcMaterial_MaterialFlattenCache_h
+#define Alembic_AbcMaterial_MaterialFlattenCache_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcMaterial/MaterialFlatten.h>
+
+namespace Alembic {
+namespace AbcMaterial {
+namespace ALEMBIC_VERSION_NS {
+
+typedef Alembic::Util::shared_ptr<MaterialFlatten> MaterialFlattenPtr;
+
+//! Shares flattened materials between the objects of a scene.
+//!
+//! Objects that are assigned the same material path (and which don't carry a
+//! local material of their own) resolve to the same inheritance chain, so
+//! the chain is walked and its network flattened once, and the resulting
+//! MaterialFlatten is handed out to every one of those objects.  Objects
+//! with a local material get their own, uncached, MaterialFlatten.
+//!
+//! The cache may be used from several threads at once.  The MaterialFlatten
+//! instances it returns are shared, callers must only query them and never
+//! append to them.
+class ALEMBIC_EXPORT MaterialFlattenCache : Alembic::Util::noncopyable
+{
+public:
+
+    //! If iAlternateSearchArchive is valid, assigned material paths are
+    //! looked up within it, as with the MaterialFlatten IObject constructor.
+    MaterialFlattenCache(
+        Abc::IArchive iAlternateSearchArchive=Abc::IArchive() );
+
+    //! Returns the flattened material of iObject, never NULL.  Check
+    //! empty() on the result to find out whether anything was assigned.
+    MaterialFlattenPtr get( Abc::IObject iObject );
+
+    //! Resolves the flattened materials of all of iObjects into oResults,
+    //! spreading the work over at most iMaxThreads threads (0 means the
+    //! number of hardware threads).
+    void get( const std::vector<Abc::IObject> & iObjects,
+              std::vector<MaterialFlattenPtr> & oResults,
+              size_t iMaxThreads=0 );
+
+    //! Number of distinct cached materials.
+    size_t size();
+
+    void clear();
+
+private:
+
+    std::string getKey( Abc::IObject & iObject,
+                        const std::string & iAssignedPath );
+
+    Abc::IArchive m_alternateSearchArchive;
+
+    typedef std::map<std::string, MaterialFlattenPtr> FlattenMap;
+    FlattenMap m_flattened;
+
+    Alembic::Util::mutex m_lock;
+};
+
+}
+
+using namespace ALEMBIC_VERSION_NS;
+
+}
+}
+
+#endif
@@ -0,0 +1,152 @@
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcMaterial/MaterialAssignment.h>
+#include <Alembic/AbcMaterial/MaterialFlattenCache.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <sstream>
+
+namespace Abc =  Alembic::Abc;
+namespace Mat = Alembic::AbcMaterial;
+
+void setFloatParameter(
+        Mat::OMaterialSchema & schema,
+        const std::string & target,
+        const std::string & shaderType,
+        const std::string & paramName, float value)
+{
+    Abc::OFloatProperty prop(
+                schema.getShaderParameters(target, shaderType),
+                        paramName);
+    prop.set(value);
+}
+
+float getRoughness(Mat::MaterialFlatten & mafla)
+{
+    Mat::MaterialFlatten::ParameterEntryVector params;
+    mafla.getShaderParameters("prman", "surface", params);
+
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+        if (params[i].name == "roughness")
+        {
+            Abc::IFloatProperty prop(params[i].parent, params[i].name);
+            return prop.getValue();
+        }
+    }
+
+    return -1.0f;
+}
+
+void write()
+{
+    Abc::OArchive archive(
+            Alembic::AbcCoreOgawa::WriteArchive(), "MaterialFlattenCache.abc" );
+
+    Abc::OObject root(archive, Abc::kTop);
+    Abc::OObject materials(root, "materials");
+    Abc::OObject geometry(root, "geometry");
+
+    Mat::OMaterial materialA(materials, "materialA");
+    materialA.getSchema().setShader("prman", "surface", "paintedplastic");
+    setFloatParameter(materialA.getSchema(),
+            "prman", "surface", "roughness", 0.1);
+
+    Mat::OMaterial materialB(materialA, "materialB");
+    materialB.getSchema().setShader("prman", "displacement", "knobby");
+    setFloatParameter(materialB.getSchema(),
+            "prman", "surface", "roughness", 0.2);
+
+    for (size_t i = 0; i < 300; ++i)
+    {
+        std::ostringstream strm;
+        strm << "geo" << i;
+        Abc::OObject geo(geometry, strm.str());
+
+        // the doubled slash must resolve to the same cached material
+        if (i % 3 == 0)
+        {
+            Mat::addMaterialAssignment(geo, "/materials/materialA");
+        }
+        else if (i % 3 == 1)
+        {
+            Mat::addMaterialAssignment(geo, "/materials/materialA/materialB");
+        }
+        else
+        {
+            Mat::addMaterialAssignment(geo, "//materials/materialA//materialB");
+        }
+    }
+
+    Abc::OObject geoLocal(geometry, "geoLocal");
+    Mat::addMaterialAssignment(geoLocal, "/materials/materialA/materialB");
+    Mat::OMaterialSchema localMat = Mat::addMaterial(geoLocal);
+    setFloatParameter(localMat, "prman", "surface", "roughness", 0.3);
+
+    Abc::OObject geoNone(geometry, "geoNone");
+}
+
+void read()
+{
+    Abc::IArchive archive(Alembic::AbcCoreOgawa::ReadArchive(),
+            "MaterialFlattenCache.abc");
+
+    Abc::IObject geometry = archive.getTop().getChild("geometry");
+    std::vector<Abc::IObject> objects;
+    for (size_t i = 0; i < geometry.getNumChildren(); ++i)
+    {
+        objects.push_back(geometry.getChild(i));
+    }
+
+    Mat::MaterialFlattenCache cache;
+    std::vector<Mat::MaterialFlattenPtr> results;
+    cache.get(objects, results, 4);
+
+    TESTING_ASSERT(results.size() == 302);
+
+    // materialA, materialB and nothing at all
+    TESTING_ASSERT(cache.size() == 3);
+
+    for (size_t i = 0; i < 300; ++i)
+    {
+        TESTING_ASSERT(results[i]);
+        TESTING_ASSERT(results[i] == results[i % 3 == 0 ? 0 : 1]);
+    }
+
+    TESTING_ASSERT(results[0] != results[1]);
+
+    std::string shader;
+    TESTING_ASSERT(results[0]->getShader("prman", "surface", shader));
+    TESTING_ASSERT(shader == "paintedplastic");
+    TESTING_ASSERT(!results[0]->getShader("prman", "displacement", shader));
+    TESTING_ASSERT(getRoughness(*results[0]) == 0.1f);
+
+    TESTING_ASSERT(results[1]->getShader("prman", "displacement", shader));
+    TESTING_ASSERT(shader == "knobby");
+    TESTING_ASSERT(getRoughness(*results[1]) == 0.2f);
+
+    // local materials are never shared
+    Mat::MaterialFlattenPtr local = results[300];
+    TESTING_ASSERT(local != results[1]);
+    TESTING_ASSERT(getRoughness(*local) == 0.3f);
+    TESTING_ASSERT(local != cache.get(objects[300]));
+
+    TESTING_ASSERT(results[301]->empty());
+
+    // single queries hit the same entries
+    TESTING_ASSERT(cache.get(objects[5]) == results[1]);
+    TESTING_ASSERT(cache.size() == 3);
+
+    cache.clear();
+    TESTING_ASSERT(cache.size() == 0);
+    TESTING_ASSERT(cache.get(objects[5]) != results[1]);
+    TESTING_ASSERT(cache.size() == 1);
+}
+
+int main( int argc, char *argv[] )
+{
+    write();
+    read();
+    return 0;
+}
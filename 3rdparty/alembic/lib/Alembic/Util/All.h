@@ -45,6 +45,7 @@
 #include <Alembic/Util/Naming.h>
 #include <Alembic/Util/OperatorBool.h>
 #include <Alembic/Util/PlainOldDataType.h>
+#include <Alembic/Util/Thread.h>
 #include <Alembic/Util/TokenMap.h>
 #include <Alembic/Util/SpookyV2.h>
 
@@ -44,88 +44,145 @@ namespace Util {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
+// Nearly every sample is rank 1, and the rest are almost all rank 2, so up to
+// kInlineRank values are kept inside the object itself. Only higher ranks
+// allocate.
 template <class T>
 class BaseDimensions
 {
 private:
-    typedef std::vector<T> SizeVec;
-    SizeVec m_vector;
+    enum { kInlineRank = 2 };
+
+    size_t m_rank;
+
+    // kInlineRank until a higher rank moves the values to m_heap
+    size_t m_capacity;
+    T *m_heap;
+    T m_inline[kInlineRank];
+
+    T *data() { return m_heap ? m_heap : m_inline; }
+    const T *data() const { return m_heap ? m_heap : m_inline; }
+
+    // grows the storage, keeping the values below the current rank
+    void reserve( size_t r )
+    {
+        if ( r <= m_capacity ) { return; }
+
+        T *heap = new T[r];
+        const T *old = data();
+        for ( size_t i = 0; i < m_rank; ++i )
+        {
+            heap[i] = old[i];
+        }
+
+        delete [] m_heap;
+        m_heap = heap;
+        m_capacity = r;
+    }
+
+    template <class Y>
+    void assign( const BaseDimensions<Y> &copy )
+    {
+        size_t r = copy.rank();
+        reserve( r );
+        m_rank = r;
+
+        T *vals = data();
+        for ( size_t i = 0; i < r; ++i )
+        {
+            Y val = copy[i];
+            vals[i] = static_cast<T>( val );
+        }
+    }
 
 public:
     // Default is for a rank-0 dimension.
     BaseDimensions()
-      : m_vector()
+      : m_rank( 0 )
+      , m_capacity( kInlineRank )
+      , m_heap( NULL )
     {}
 
     // When you specify a single thing, you're specifying a rank-1
     // dimension of a certain size.
     explicit BaseDimensions( const T& t )
-      : m_vector( 1, t )
-    {}
+      : m_rank( 1 )
+      , m_capacity( kInlineRank )
+      , m_heap( NULL )
+    {
+        m_inline[0] = t;
+    }
 
     BaseDimensions( const BaseDimensions &copy )
-      : m_vector( copy.m_vector )
-    {}
+      : m_rank( 0 )
+      , m_capacity( kInlineRank )
+      , m_heap( NULL )
+    {
+        assign( copy );
+    }
 
     template <class Y>
     BaseDimensions( const BaseDimensions<Y> &copy )
+      : m_rank( 0 )
+      , m_capacity( kInlineRank )
+      , m_heap( NULL )
     {
-        m_vector.resize( copy.rank() );
-        for ( size_t i = 0; i < copy.rank(); ++i )
-        {
-            Y val = copy[i];
-            m_vector[i] = static_cast<T>( val );
-        }
+        assign( copy );
+    }
+
+    ~BaseDimensions()
+    {
+        delete [] m_heap;
     }
 
     BaseDimensions& operator=( const BaseDimensions &copy )
     {
-        m_vector = copy.m_vector;
+        if ( this != &copy )
+        {
+            assign( copy );
+        }
         return *this;
     }
 
     template <class Y>
     BaseDimensions& operator=( const BaseDimensions<Y> &copy )
     {
-        m_vector.resize( copy.rank() );
-        for ( size_t i = 0; i < copy.rank(); ++i )
-        {
-            Y val = copy[i];
-            m_vector[i] = static_cast<T>( val );
-        }
+        assign( copy );
         return *this;
     }
 
-    size_t rank() const { return m_vector.size(); }
+    size_t rank() const { return m_rank; }
     void setRank( size_t r )
     {
-        size_t oldSize = m_vector.size();
-        m_vector.resize( r );
-        for ( size_t s = oldSize; s < r; ++s )
+        reserve( r );
+
+        T *vals = data();
+        for ( size_t s = m_rank; s < r; ++s )
         {
-            m_vector[s] = ( T )0;
+            vals[s] = ( T )0;
         }
+        m_rank = r;
     }
 
     T &operator[]( size_t i )
-    { return m_vector[i]; }
+    { return data()[i]; }
 
     const T &operator[]( size_t i ) const
-    { return m_vector[i]; }
+    { return data()[i]; }
 
-    T *rootPtr() { return ( T * )( &( m_vector.front() ) ); }
-    const T *rootPtr() const
-    { return ( const T * )( &( m_vector.front() ) ); }
+    T *rootPtr() { return data(); }
+    const T *rootPtr() const { return data(); }
 
     size_t numPoints() const
     {
-        if ( m_vector.size() == 0 ) { return 0; }
+        if ( m_rank == 0 ) { return 0; }
         else
         {
+            const T *vals = data();
             size_t npoints = 1;
-            for ( size_t i = 0 ; i < m_vector.size() ; i++ )
+            for ( size_t i = 0 ; i < m_rank ; i++ )
             {
-                npoints *= (size_t)m_vector[i];
+                npoints *= (size_t)vals[i];
             }
             return npoints;
         }
@@ -39,6 +39,9 @@
 #include <Alembic/Util/Murmur3.h>
 #include <Alembic/Util/PlainOldDataType.h>
 
+#include <algorithm>
+#include <cstring>
+
 #ifdef __APPLE__
 #include <machine/endian.h>
 #elif !defined(_MSC_VER)
@@ -49,27 +52,68 @@ namespace Alembic {
 namespace Util {
 namespace ALEMBIC_VERSION_NS {
 
-//-*****************************************************************************
-void MurmurHash3_x64_128 ( const void * key, const size_t len,
-                           const size_t podSize, void * out )
-{
-    const uint8_t * data = (const uint8_t*)key;
-    const size_t nblocks = len / 16;
+#ifdef _MSC_VER
+#define MURMUR3_C1 0x87c37b91114253d5LL
+#define MURMUR3_C2 0x4cf5ad432745937fLL
+#else
+#define MURMUR3_C1 0x87c37b91114253d5ULL
+#define MURMUR3_C2 0x4cf5ad432745937fULL
+#endif
 
-    uint64_t h1 = 0;
-    uint64_t h2 = 0;
+#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
+#define MURMUR3_BIG_ENDIAN
+#endif
 
+namespace {
 
-#ifdef _MSC_VER
-    uint64_t c1 = 0x87c37b91114253d5LL;
-    uint64_t c2 = 0x4cf5ad432745937fLL;
-#else
-    uint64_t c1 = 0x87c37b91114253d5ULL;
-    uint64_t c2 = 0x4cf5ad432745937fULL;
+#ifdef MURMUR3_BIG_ENDIAN
+//-*****************************************************************************
+// the hash is defined on little endian pods
+inline uint64_t swapPods( uint64_t k, size_t podSize )
+{
+    if (podSize == 8)
+    {
+        k = (k>>56) |
+            ((k<<40) & 0x00FF000000000000ULL) |
+            ((k<<24) & 0x0000FF0000000000ULL) |
+            ((k<<8)  & 0x000000FF00000000ULL) |
+            ((k>>8)  & 0x00000000FF000000ULL) |
+            ((k>>24) & 0x0000000000FF0000ULL) |
+            ((k>>40) & 0x000000000000FF00ULL) |
+            (k<<56);
+    }
+    else if (podSize == 4)
+    {
+        k = ((k<<24) & 0xFF00000000000000ULL) |
+            ((k<<8)  & 0x00FF000000000000ULL) |
+            ((k>>8)  & 0x0000FF0000000000ULL) |
+            ((k>>24) & 0x000000FF00000000ULL) |
+            ((k<<24) & 0x00000000FF000000ULL) |
+            ((k<<8)  & 0x0000000000FF0000ULL) |
+            ((k>>8)  & 0x000000000000FF00ULL) |
+            ((k>>24) & 0x00000000000000FFULL);
+    }
+    else if (podSize == 2)
+    {
+        k = ((k<<8) & 0xFF00000000000000ULL) |
+            ((k>>8) & 0x00FF000000000000ULL) |
+            ((k<<8) & 0x0000FF0000000000ULL) |
+            ((k>>8) & 0x000000FF00000000ULL) |
+            ((k<<8) & 0x00000000FF000000ULL) |
+            ((k>>8) & 0x0000000000FF0000ULL) |
+            ((k<<8) & 0x000000000000FF00ULL) |
+            ((k>>8) & 0x00000000000000FFULL);
+    }
+    return k;
+}
 #endif
 
-    //----------
-    // body
+//-*****************************************************************************
+inline void hashBlocks( const uint8_t * data, size_t nblocks, size_t podSize,
+                        uint64_t & h1, uint64_t & h2 )
+{
+    const uint64_t c1 = MURMUR3_C1;
+    const uint64_t c2 = MURMUR3_C2;
 
     const uint64_t * blocks = (const uint64_t *)(data);
 
@@ -79,68 +123,9 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
         uint64_t k1 = blocks[i*2];
         uint64_t k2 = blocks[i*2+1];
 
-
-#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-        if (podSize == 8)
-        {
-            k1 = (k1>>56) |
-                ((k1<<40) & 0x00FF000000000000ULL) |
-                ((k1<<24) & 0x0000FF0000000000ULL) |
-                ((k1<<8)  & 0x000000FF00000000ULL) |
-                ((k1>>8)  & 0x00000000FF000000ULL) |
-                ((k1>>24) & 0x0000000000FF0000ULL) |
-                ((k1>>40) & 0x000000000000FF00ULL) |
-                (k1<<56);
-
-            k2 = (k2>>56) |
-                ((k2<<40) & 0x00FF000000000000ULL) |
-                ((k2<<24) & 0x0000FF0000000000ULL) |
-                ((k2<<8)  & 0x000000FF00000000ULL) |
-                ((k2>>8)  & 0x00000000FF000000ULL) |
-                ((k2>>24) & 0x0000000000FF0000ULL) |
-                ((k2>>40) & 0x000000000000FF00ULL) |
-                 (k2<<56);
-        }
-        else if (podSize == 4)
-        {
-            k1 =((k1<<24) & 0xFF00000000000000ULL) |
-                ((k1<<8)  & 0x00FF000000000000ULL) |
-                ((k1>>8)  & 0x0000FF0000000000ULL) |
-                ((k1>>24) & 0x000000FF00000000ULL) |
-                ((k1<<24) & 0x00000000FF000000ULL) |
-                ((k1<<8)  & 0x0000000000FF0000ULL) |
-                ((k1>>8)  & 0x000000000000FF00ULL) |
-                ((k1>>24) & 0x00000000000000FFULL);
-
-            k2 =((k2<<24) & 0xFF00000000000000ULL) |
-                ((k2<<8)  & 0x00FF000000000000ULL) |
-                ((k2>>8)  & 0x0000FF0000000000ULL) |
-                ((k2>>24) & 0x000000FF00000000ULL) |
-                ((k2<<24) & 0x00000000FF000000ULL) |
-                ((k2<<8)  & 0x0000000000FF0000ULL) |
-                ((k2>>8)  & 0x000000000000FF00ULL) |
-                ((k2>>24) & 0x00000000000000FFULL);
-        }
-        else if (podSize == 2)
-        {
-            k1 =((k1<<8) & 0xFF00000000000000ULL) |
-                ((k1>>8) & 0x00FF000000000000ULL) |
-                ((k1<<8) & 0x0000FF0000000000ULL) |
-                ((k1>>8) & 0x000000FF00000000ULL) |
-                ((k1<<8) & 0x00000000FF000000ULL) |
-                ((k1>>8) & 0x0000000000FF0000ULL) |
-                ((k1<<8) & 0x000000000000FF00ULL) |
-                ((k1>>8) & 0x00000000000000FFULL);
-
-            k2 =((k2<<8) & 0xFF00000000000000ULL) |
-                ((k2>>8) & 0x00FF000000000000ULL) |
-                ((k2<<8) & 0x0000FF0000000000ULL) |
-                ((k2>>8) & 0x000000FF00000000ULL) |
-                ((k2<<8) & 0x00000000FF000000ULL) |
-                ((k2>>8) & 0x0000000000FF0000ULL) |
-                ((k2<<8) & 0x000000000000FF00ULL) |
-                ((k2>>8) & 0x00000000000000FFULL);
-        }
+#ifdef MURMUR3_BIG_ENDIAN
+        k1 = swapPods(k1, podSize);
+        k2 = swapPods(k2, podSize);
 #endif
 
         k1 *= c1;
@@ -161,12 +146,17 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
         h2 += h1;
         h2 = h2*5+0x38495ab5;
     }
+}
 
-    //----------
-    // tail
+//-*****************************************************************************
+// hashes the last len & 15 bytes and finalizes the digest
+inline void hashTail( const uint8_t * unswappedTail, size_t len,
+                      size_t podSize, uint64_t h1, uint64_t h2, void * out )
+{
+    const uint64_t c1 = MURMUR3_C1;
+    const uint64_t c2 = MURMUR3_C2;
 
-#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-    const uint8_t * unswappedTail = (const uint8_t*)(data + nblocks*16);
+#ifdef MURMUR3_BIG_ENDIAN
     uint8_t tail[16];
     size_t tailSize = len & 15;
 
@@ -183,7 +173,7 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
         }
     }
 #else
-    const uint8_t * tail = (const uint8_t*)(data + nblocks*16);
+    const uint8_t * tail = unswappedTail;
 #endif
 
     uint64_t k1 = 0;
@@ -262,6 +252,69 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
     ((uint64_t*)out)[1] = h2;
 }
 
+} // End anonymous namespace
+
+//-*****************************************************************************
+void MurmurHash3_x64_128 ( const void * key, const size_t len,
+                           const size_t podSize, void * out )
+{
+    const uint8_t * data = (const uint8_t*)key;
+    const size_t nblocks = len / 16;
+
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+
+    hashBlocks(data, nblocks, podSize, h1, h2);
+    hashTail(data + nblocks*16, len, podSize, h1, h2, out);
+}
+
+//-*****************************************************************************
+void Murmur3Hash::Init( size_t podSize )
+{
+    m_h1 = 0;
+    m_h2 = 0;
+    m_length = 0;
+    m_remainder = 0;
+    m_podSize = podSize;
+}
+
+//-*****************************************************************************
+void Murmur3Hash::Update( const void * message, size_t length )
+{
+    const uint8_t * data = (const uint8_t*)message;
+    m_length += length;
+
+    // finish off a partial block first
+    if (m_remainder > 0)
+    {
+        size_t num = std::min(length, 16 - m_remainder);
+        memcpy((uint8_t *) m_buffer + m_remainder, data, num);
+        m_remainder += num;
+        data += num;
+        length -= num;
+
+        if (m_remainder < 16)
+        {
+            return;
+        }
+
+        hashBlocks((uint8_t *) m_buffer, 1, m_podSize, m_h1, m_h2);
+        m_remainder = 0;
+    }
+
+    size_t nblocks = length / 16;
+    hashBlocks(data, nblocks, m_podSize, m_h1, m_h2);
+
+    m_remainder = length & 15;
+    memcpy((uint8_t *) m_buffer, data + nblocks*16, m_remainder);
+}
+
+//-*****************************************************************************
+void Murmur3Hash::Final( void * out ) const
+{
+    hashTail((const uint8_t *) m_buffer, m_length, m_podSize, m_h1, m_h2, out);
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Util
 } // End namespace Alembic
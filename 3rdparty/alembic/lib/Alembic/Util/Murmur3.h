@@ -41,6 +41,7 @@
 
 #include <Alembic/Util/Export.h>
 #include <Alembic/Util/Foundation.h>
+#include <Alembic/Util/PlainOldDataType.h>
 
 namespace Alembic {
 namespace Util {
@@ -50,6 +51,33 @@ ALEMBIC_EXPORT void
 MurmurHash3_x64_128 ( const void * key, const size_t len,
                       const size_t podSize, void * out );
 
+//-*****************************************************************************
+//! MurmurHash3_x64_128 over a message that is handed over in pieces, the
+//! digest is the same as hashing all of the pieces back to back in one call,
+//! without having to put them together first.
+class ALEMBIC_EXPORT Murmur3Hash
+{
+public:
+    Murmur3Hash( size_t podSize = 1 ) { Init( podSize ); }
+
+    //! Starts a new message, podSize is as for MurmurHash3_x64_128
+    void Init( size_t podSize );
+
+    //! Adds the next piece of the message
+    void Update( const void * message, size_t length );
+
+    //! Writes the 16 byte digest of everything added so far to out
+    void Final( void * out ) const;
+
+private:
+    uint64_t m_h1;
+    uint64_t m_h2;
+    uint64_t m_buffer[2];
+    size_t m_length;
+    size_t m_remainder;
+    size_t m_podSize;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -92,6 +92,45 @@ int main( int, char** )
 
         rank2_copy = rank3;
         assert( rank2_copy == rank3 );
+
+        // growing past the inline storage keeps the existing values
+        rank2.setRank(4);
+        assert( rank2.rank() == 4 );
+        assert( rank2[0] == 11 );
+        assert( rank2[1] == 12 );
+        assert( rank2[2] == 0 );
+        assert( rank2[3] == 0 );
+
+        // and shrinking back down keeps them too
+        rank2_copy.setRank(1);
+        assert( rank2_copy.rank() == 1 );
+        assert( rank2_copy[0] == 20 );
+
+        rank2_copy = rank2_copy;
+        assert( rank2_copy.rank() == 1 );
+        assert( rank2_copy[0] == 20 );
+
+        rank3 = Dimensions( 5 );
+        assert( rank3.rank() == 1 );
+        assert( rank3 != rank2 );
+    }
+    {
+        Dimensions rank4;
+        rank4.setRank(4);
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            rank4[i] = i + 2;
+        }
+        assert( rank4.numPoints() == 2 * 3 * 4 * 5 );
+
+        BaseDimensions<int> intDims( rank4 );
+        assert( intDims.rank() == 4 );
+        assert( intDims[3] == 5 );
+        assert( intDims == rank4 );
+
+        BaseDimensions<int> intRank1( 3 );
+        intRank1 = rank4;
+        assert( intRank1 == rank4 );
     }
 
     std::cout << "Success!" << std::endl;
@@ -0,0 +1,127 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <Alembic/Util/Thread.h>
+#include <Alembic/Util/Exception.h>
+
+#ifdef _MSC_VER
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+thread::thread( function_type iFunc, void * iArg )
+    : m_func( iFunc )
+    , m_arg( iArg )
+    , m_joinable( false )
+{
+#ifdef _MSC_VER
+    m_handle = ( HANDLE ) _beginthreadex( NULL, 0, &thread::run, this, 0,
+                                          NULL );
+    if ( m_handle == 0 )
+    {
+        ABC_THROW( "Could not create thread." );
+    }
+#else
+    int err = pthread_create( &m_handle, NULL, &thread::run, this );
+    if ( err != 0 )
+    {
+        ABC_THROW( "Could not create thread, error: " << err );
+    }
+#endif
+    m_joinable = true;
+}
+
+//-*****************************************************************************
+thread::~thread()
+{
+    join();
+}
+
+//-*****************************************************************************
+void thread::join()
+{
+    if ( !m_joinable )
+    {
+        return;
+    }
+
+#ifdef _MSC_VER
+    WaitForSingleObject( m_handle, INFINITE );
+    CloseHandle( m_handle );
+#else
+    pthread_join( m_handle, NULL );
+#endif
+    m_joinable = false;
+}
+
+//-*****************************************************************************
+std::size_t thread::hardware_concurrency()
+{
+#ifdef _MSC_VER
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    long numProcs = ( long ) info.dwNumberOfProcessors;
+#else
+    long numProcs = sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+    return numProcs > 0 ? ( std::size_t ) numProcs : 1;
+}
+
+//-*****************************************************************************
+#ifdef _MSC_VER
+unsigned __stdcall thread::run( void * iThread )
+{
+    thread * t = static_cast< thread * >( iThread );
+    t->m_func( t->m_arg );
+    return 0;
+}
+#else
+void * thread::run( void * iThread )
+{
+    thread * t = static_cast< thread * >( iThread );
+    t->m_func( t->m_arg );
+    return NULL;
+}
+#endif
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,190 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks, Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef Alembic_Util_Thread_h
+#define Alembic_Util_Thread_h
+
+#include <Alembic/Util/Foundation.h>
+#include <Alembic/Util/Exception.h>
+
+#ifndef _MSC_VER
+#include <pthread.h>
+#endif
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+// inspired by boost::thread
+// A very small wrapper around the native threads, since std::thread isn't
+// available when building against boost or tr1.  The thread starts running
+// iFunc( iArg ) as soon as it is constructed and is joined on destruction
+// if the caller hasn't already done so.
+class ALEMBIC_EXPORT thread : noncopyable
+{
+public:
+    typedef void ( *function_type )( void * );
+
+    thread( function_type iFunc, void * iArg );
+
+    ~thread();
+
+    // blocks until the thread function has returned, safe to call more
+    // than once
+    void join();
+
+    // number of concurrent threads the hardware supports, never less than 1
+    static std::size_t hardware_concurrency();
+
+private:
+    function_type m_func;
+    void * m_arg;
+    bool m_joinable;
+
+#ifdef _MSC_VER
+    HANDLE m_handle;
+    static unsigned __stdcall run( void * iThread );
+#else
+    pthread_t m_handle;
+    static void * run( void * iThread );
+#endif
+};
+
+//-*****************************************************************************
+// one contiguous chunk of a parallel_for, see below
+template < class FUNC >
+class parallel_for_chunk
+{
+public:
+    parallel_for_chunk() : func( NULL ), begin( 0 ), end( 0 ), failed( false )
+    {}
+
+    FUNC * func;
+    std::size_t begin;
+    std::size_t end;
+    bool failed;
+    std::string error;
+
+    static void run( void * iChunk )
+    {
+        parallel_for_chunk * chunk = static_cast< parallel_for_chunk * >(
+            iChunk );
+        try
+        {
+            ( *chunk->func )( chunk->begin, chunk->end );
+        }
+        catch ( std::exception & e )
+        {
+            chunk->failed = true;
+            chunk->error = e.what();
+        }
+        catch ( ... )
+        {
+            chunk->failed = true;
+            chunk->error = "unknown exception";
+        }
+    }
+};
+
+//-*****************************************************************************
+// Calls iFunc( begin, end ) on contiguous chunks covering [0, iSize), each
+// chunk being at least iGrain long, spread over at most iMaxThreads threads
+// (0 means thread::hardware_concurrency()).  The calling thread runs the
+// first chunk itself.  Chunks don't overlap so iFunc can write to its own
+// range of an output without locking.  If any chunk throws, the first error
+// is rethrown as an Alembic::Util::Exception once every chunk has finished.
+template < class FUNC >
+void parallel_for( std::size_t iSize, std::size_t iGrain, FUNC & iFunc,
+                   std::size_t iMaxThreads = 0 )
+{
+    if ( iSize == 0 )
+    {
+        return;
+    }
+
+    std::size_t numThreads = iMaxThreads > 0 ? iMaxThreads :
+        thread::hardware_concurrency();
+    std::size_t maxChunks = ( iSize + iGrain - 1 ) / std::max( iGrain,
+        ( std::size_t ) 1 );
+    std::size_t numChunks = std::min( numThreads, maxChunks );
+
+    if ( numChunks <= 1 )
+    {
+        iFunc( 0, iSize );
+        return;
+    }
+
+    std::vector< parallel_for_chunk< FUNC > > chunks( numChunks );
+    std::size_t chunkSize = iSize / numChunks;
+    std::size_t remainder = iSize % numChunks;
+    std::size_t begin = 0;
+    for ( std::size_t i = 0; i < numChunks; ++i )
+    {
+        chunks[i].func = &iFunc;
+        chunks[i].begin = begin;
+        begin += chunkSize + ( i < remainder ? 1 : 0 );
+        chunks[i].end = begin;
+    }
+
+    {
+        std::vector< shared_ptr< thread > > threads( numChunks - 1 );
+        for ( std::size_t i = 1; i < numChunks; ++i )
+        {
+            threads[i - 1].reset( new thread(
+                &parallel_for_chunk< FUNC >::run, &chunks[i] ) );
+        }
+
+        parallel_for_chunk< FUNC >::run( &chunks[0] );
+
+        // the thread destructors join
+    }
+
+    for ( std::size_t i = 0; i < numChunks; ++i )
+    {
+        if ( chunks[i].failed )
+        {
+            ABC_THROW( chunks[i].error );
+        }
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
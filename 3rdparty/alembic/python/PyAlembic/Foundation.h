@@ -101,4 +101,30 @@ inline void throwPythonIndexException( const char* iMessage )
     throw boost::python::error_already_set();
 }
 
+//-*****************************************************************************
+// Releases the GIL for as long as it is in scope, so other Python threads can
+// run while we read from the archive. Nothing in that scope may touch Python
+// objects.
+class ReleaseGIL
+{
+public:
+    ReleaseGIL() : m_state( PyEval_SaveThread() ) {}
+    ~ReleaseGIL() { PyEval_RestoreThread( m_state ); }
+
+private:
+    ReleaseGIL( const ReleaseGIL & );
+    ReleaseGIL & operator=( const ReleaseGIL & );
+
+    PyThreadState *m_state;
+};
+
+//-*****************************************************************************
+// Binds SCHEMA::getValue with the GIL released during the read.
+template <class SCHEMA, class SAMPLE>
+SAMPLE getValueWithoutGIL( SCHEMA &iSchema, const Abc::ISampleSelector &iSS )
+{
+    ReleaseGIL gil;
+    return iSchema.getValue( iSS );
+}
+
 #endif
@@ -0,0 +1,284 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Foundation.h>
+#include <PyArraySampleBuffer.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace boost::python;
+
+namespace {
+
+//-*****************************************************************************
+struct ArraySampleBufferObject
+{
+    PyObject_HEAD
+
+    // heap allocated since Python allocates the object itself
+    AbcA::ArraySamplePtr *sample;
+
+    // shape followed by strides, ndim entries each
+    std::vector<Py_ssize_t> *layout;
+
+    int ndim;
+    const char *format;
+};
+
+//-*****************************************************************************
+const char * getFormat( AbcU::PlainOldDataType iPod )
+{
+    switch ( iPod )
+    {
+        case AbcU::kBooleanPOD: return "?";
+        case AbcU::kUint8POD:   return "B";
+        case AbcU::kInt8POD:    return "b";
+        case AbcU::kUint16POD:  return "H";
+        case AbcU::kInt16POD:   return "h";
+        case AbcU::kUint32POD:  return "I";
+        case AbcU::kInt32POD:   return "i";
+        case AbcU::kUint64POD:  return "Q";
+        case AbcU::kInt64POD:   return "q";
+        case AbcU::kFloat16POD: return "e";
+        case AbcU::kFloat32POD: return "f";
+        case AbcU::kFloat64POD: return "d";
+        default: return NULL;
+    }
+}
+
+//-*****************************************************************************
+void dealloc( PyObject *iSelf )
+{
+    ArraySampleBufferObject *self = ( ArraySampleBufferObject * )iSelf;
+    delete self->sample;
+    delete self->layout;
+    Py_TYPE( iSelf )->tp_free( iSelf );
+}
+
+//-*****************************************************************************
+int getBuffer( PyObject *iSelf, Py_buffer *oView, int iFlags )
+{
+    if ( ( iFlags & PyBUF_WRITABLE ) == PyBUF_WRITABLE )
+    {
+        PyErr_SetString( PyExc_BufferError,
+                         "Alembic array samples are read only" );
+        oView->obj = NULL;
+        return -1;
+    }
+
+    ArraySampleBufferObject *self = ( ArraySampleBufferObject * )iSelf;
+    const AbcA::ArraySample &samp = **( self->sample );
+    std::vector<Py_ssize_t> &layout = *( self->layout );
+
+    oView->buf = const_cast<void *>( samp.getData() );
+    oView->obj = iSelf;
+    Py_INCREF( iSelf );
+    oView->itemsize = AbcU::PODNumBytes( samp.getDataType().getPod() );
+    oView->len = samp.size() * samp.getDataType().getExtent() *
+        oView->itemsize;
+    oView->readonly = 1;
+    oView->format = NULL;
+    if ( ( iFlags & PyBUF_FORMAT ) == PyBUF_FORMAT )
+    {
+        oView->format = const_cast<char *>( self->format );
+    }
+
+    // the data is C contiguous, so shape and strides can always be given
+    oView->ndim = self->ndim;
+    oView->shape = &layout[0];
+    oView->strides = &layout[self->ndim];
+    oView->suboffsets = NULL;
+    oView->internal = NULL;
+
+    return 0;
+}
+
+//-*****************************************************************************
+PyBufferProcs bufferProcs;
+
+PyTypeObject ArraySampleBufferType = {
+    PyVarObject_HEAD_INIT( NULL, 0 )
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+object ArraySampleBuffer( const AbcA::ArraySamplePtr &iSample )
+{
+    if ( !iSample )
+    {
+        return object();
+    }
+
+    const AbcA::DataType &dtype = iSample->getDataType();
+    const char *format = getFormat( dtype.getPod() );
+    if ( !format )
+    {
+        PyErr_SetString( PyExc_TypeError, "ArraySampleBuffer does not "
+                         "support string and wstring samples" );
+        throw_error_already_set();
+    }
+
+    // One axis per dimension, and one more for the extent of compound
+    // types like V3f, so P comes out as ( numPoints, 3 ).
+    const AbcU::Dimensions &dims = iSample->getDimensions();
+    std::vector<Py_ssize_t> shape;
+    for ( size_t i = 0; i < dims.rank(); ++i )
+    {
+        shape.push_back( dims[i] );
+    }
+
+    if ( shape.empty() )
+    {
+        shape.push_back( 0 );
+    }
+
+    if ( dtype.getExtent() > 1 )
+    {
+        shape.push_back( dtype.getExtent() );
+    }
+
+    int ndim = shape.size();
+    std::vector<Py_ssize_t> *layout =
+        new std::vector<Py_ssize_t>( ndim * 2 );
+    Py_ssize_t stride = AbcU::PODNumBytes( dtype.getPod() );
+    for ( int i = ndim - 1; i >= 0; --i )
+    {
+        ( *layout )[i] = shape[i];
+        ( *layout )[ndim + i] = stride;
+        stride *= shape[i];
+    }
+
+    ArraySampleBufferObject *self = PyObject_New( ArraySampleBufferObject,
+                                                  &ArraySampleBufferType );
+    if ( !self )
+    {
+        delete layout;
+        throw_error_already_set();
+    }
+
+    self->sample = new AbcA::ArraySamplePtr( iSample );
+    self->layout = layout;
+    self->ndim = ndim;
+    self->format = format;
+
+    return object( handle<>( ( PyObject * )self ) );
+}
+
+//-*****************************************************************************
+object ArraySampleRangeBuffer(
+    const std::vector<AbcA::ArraySamplePtr> &iSamples )
+{
+    bool sameDims = !iSamples.empty();
+    for ( size_t i = 0; i < iSamples.size() && sameDims; ++i )
+    {
+        sameDims = iSamples[i] &&
+            iSamples[i]->getDimensions() == iSamples[0]->getDimensions();
+    }
+
+    if ( !sameDims )
+    {
+        list ret;
+        for ( size_t i = 0; i < iSamples.size(); ++i )
+        {
+            ret.append( ArraySampleBuffer( iSamples[i] ) );
+        }
+        return ret;
+    }
+
+    const AbcA::DataType &dtype = iSamples[0]->getDataType();
+    if ( !getFormat( dtype.getPod() ) )
+    {
+        PyErr_SetString( PyExc_TypeError, "ArraySampleBuffer does not "
+                         "support string and wstring samples" );
+        throw_error_already_set();
+    }
+
+    const AbcU::Dimensions &sampDims = iSamples[0]->getDimensions();
+    AbcU::Dimensions dims;
+    dims.setRank( sampDims.rank() + 1 );
+    dims[0] = iSamples.size();
+    for ( size_t i = 0; i < sampDims.rank(); ++i )
+    {
+        dims[i + 1] = sampDims[i];
+    }
+
+    AbcA::ArraySamplePtr stacked;
+    {
+        ReleaseGIL gil;
+
+        stacked = AbcA::AllocateArraySample( dtype, dims );
+
+        size_t numBytes = sampDims.numPoints() * dtype.getNumBytes();
+        char *dst = static_cast<char *>(
+            const_cast<void *>( stacked->getData() ) );
+        for ( size_t i = 0; i < iSamples.size(); ++i, dst += numBytes )
+        {
+            memcpy( dst, iSamples[i]->getData(), numBytes );
+        }
+    }
+
+    return ArraySampleBuffer( stacked );
+}
+
+//-*****************************************************************************
+void register_arraysamplebuffer()
+{
+    bufferProcs.bf_getbuffer = getBuffer;
+    bufferProcs.bf_releasebuffer = NULL;
+
+    ArraySampleBufferType.tp_name = "alembic.Abc.ArraySampleBuffer";
+    ArraySampleBufferType.tp_basicsize = sizeof( ArraySampleBufferObject );
+    ArraySampleBufferType.tp_dealloc = dealloc;
+    ArraySampleBufferType.tp_as_buffer = &bufferProcs;
+    ArraySampleBufferType.tp_flags = Py_TPFLAGS_DEFAULT;
+#if PY_MAJOR_VERSION < 3
+    ArraySampleBufferType.tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+    ArraySampleBufferType.tp_doc =
+        "Read only view of an array sample's data, pass it to "
+        "numpy.asarray() or memoryview() to use it without copying";
+
+    if ( PyType_Ready( &ArraySampleBufferType ) < 0 )
+    {
+        throw_error_already_set();
+    }
+
+    Py_INCREF( &ArraySampleBufferType );
+    scope().attr( "ArraySampleBuffer" ) = object( handle<>(
+        ( PyObject * )&ArraySampleBufferType ) );
+}
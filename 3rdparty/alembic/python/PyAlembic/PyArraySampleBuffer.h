@@ -0,0 +1,59 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic, nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef PyAlembic_PyArraySampleBuffer_h
+#define PyAlembic_PyArraySampleBuffer_h
+
+#include <Foundation.h>
+
+//-*****************************************************************************
+// Wraps an array sample in a read only object that exposes its data through
+// the buffer protocol, so numpy.asarray() and memoryview() see the sample's
+// own memory. The object keeps the sample alive for as long as it, or any
+// view onto it, exists. Numeric and boolean samples only; string samples
+// raise a TypeError. An empty sample pointer yields None.
+boost::python::object
+ArraySampleBuffer( const AbcA::ArraySamplePtr &iSample );
+
+//-*****************************************************************************
+// Packs a run of samples, e.g. every frame of P, for Python. When they all
+// have the same dimensions they are copied into one contiguous buffer with a
+// leading sample axis, so 1000 frames of P come out as ( 1000, numPoints, 3 ).
+// Otherwise a list with an ArraySampleBuffer per sample is returned.
+boost::python::object
+ArraySampleRangeBuffer( const std::vector<AbcA::ArraySamplePtr> &iSamples );
+
+#endif
@@ -38,6 +38,7 @@
 #include <PyIBaseProperty.h>
 #include <PyIPropertyUtil.h>
 #include <PyTypeBindingUtil.h>
+#include <PyArraySampleBuffer.h>
 
 using namespace boost::python;
 
@@ -73,7 +74,12 @@ object getValue ( Abc::IArrayProperty &p,
     AbcU::PlainOldDataType pod = dt.getPod();
     const AbcU::uint8_t extent = dt.getExtent();
     AbcU::Dimensions dims;
-    p.getDimensions( dims, iSS );
+    AbcA::ArraySamplePtr ptr;
+    {
+        ReleaseGIL gil;
+        p.getDimensions( dims, iSS );
+        p.get( ptr, iSS );
+    }
 
     // POD data types
     if( pod < 0 || pod >= AbcU::kNumPlainOldDataTypes )
@@ -85,9 +91,6 @@ object getValue ( Abc::IArrayProperty &p,
         return object(); // Returns None object
     }
 
-    AbcA::ArraySamplePtr ptr;
-    p.get( ptr, iSS );
-
     if (extent == 1)
     {
         switch ( pod )
@@ -220,19 +223,73 @@ static object getDimension( Abc::IArrayProperty& p,
                             const Abc::ISampleSelector& iSS )
 {
     AbcU::Dimensions oDim;
-    p.getDimensions( oDim, iSS );
+    {
+        ReleaseGIL gil;
+        p.getDimensions( oDim, iSS );
+    }
 
     return_by_value::apply<AbcU::Dimensions>::type converter;
 
     return object( handle<>( converter( oDim ) ) );
 }
 
+//-*****************************************************************************
+static object getBuffer( Abc::IArrayProperty &p,
+                         const Abc::ISampleSelector &iSS )
+{
+    AbcA::ArraySamplePtr ptr;
+    {
+        ReleaseGIL gil;
+        p.get( ptr, iSS );
+    }
+
+    return ArraySampleBuffer( ptr );
+}
+
+//-*****************************************************************************
+static object getSampleRange( Abc::IArrayProperty &p,
+                              AbcA::index_t iStart,
+                              AbcA::index_t iEnd )
+{
+    AbcA::index_t numSamples = p.getNumSamples();
+    if ( iEnd < 0 )
+    {
+        iEnd = numSamples;
+    }
+
+    if ( iStart < 0 || iStart > iEnd || iEnd > numSamples )
+    {
+        std::stringstream stream;
+        stream << "ERROR: Sample range [" << iStart << ", " << iEnd
+               << ") is outside of the " << numSamples << " samples";
+        throwPythonIndexException( stream.str().c_str() );
+    }
+
+    std::vector<AbcA::ArraySamplePtr> samples( iEnd - iStart );
+    {
+        ReleaseGIL gil;
+        for ( size_t i = 0; i < samples.size(); ++i )
+        {
+            p.get( samples[i],
+                   Abc::ISampleSelector( ( AbcA::index_t )( iStart + i ) ) );
+        }
+    }
+
+    return ArraySampleRangeBuffer( samples );
+}
+
 //-*****************************************************************************
 static std::string getKey( Abc::IArrayProperty &p, 
                            const Abc::ISampleSelector &iSS )
 {
     AbcA::ArraySampleKey oKey;
-    if ( p.getKey( oKey, iSS ) ) {
+    bool found = false;
+    {
+        ReleaseGIL gil;
+        found = p.getKey( oKey, iSS );
+    }
+
+    if ( found ) {
         return oKey.digest.str();
     };
     return std::string();
@@ -310,9 +367,20 @@ void register_iarrayproperty()
               ( arg( "iSS" ) = Abc::ISampleSelector() ),
               "Return the sample with the given ISampleSelector" )
         .def( "getDimension", &getDimension )
+        .def( "getBuffer",
+              &getBuffer,
+              ( arg( "iSS" ) = Abc::ISampleSelector() ),
+              "Return the sample with the given ISampleSelector as a read "
+              "only ArraySampleBuffer that numpy can use without copying" )
         .def( "getParent",
               &Abc::IArrayProperty::getParent,
               "Return the parent ICompoundProperty" )
+        .def( "getSampleRange",
+              &getSampleRange,
+              ( arg( "iStart" ) = 0, arg( "iEnd" ) = -1 ),
+              "Read the samples in [iStart, iEnd) as one stacked "
+              "ArraySampleBuffer, or as a list of them if their dimensions "
+              "differ. iEnd of -1 reads through the last sample" )
         .def( "getKey", &getKey )
         .def( "serialize",
               Overloads::serialize,
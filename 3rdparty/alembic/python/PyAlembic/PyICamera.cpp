@@ -81,8 +81,9 @@ void register_icamera()
         .def( "getUserProperties", &AbcG::ICameraSchema::getUserProperties )
         .def( "getChildBoundsProperty",
               &AbcG::ICameraSchema::getChildBoundsProperty )
-        .def( "getValue", 
-              &AbcG::ICameraSchema::getValue,
+        .def( "getValue",
+              &getValueWithoutGIL<AbcG::ICameraSchema,
+                                  AbcG::CameraSample>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "valid", &AbcG::ICameraSchema::valid )
         .def( "reset", &AbcG::ICameraSchema::reset )
@@ -86,7 +86,8 @@ void register_icurves()
               &AbcG::ICurvesSchema::get,
               ( arg( "sample" ), arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getValue",
-              &AbcG::ICurvesSchema::getValue,
+              &getValueWithoutGIL<AbcG::ICurvesSchema,
+                                  AbcG::ICurvesSchema::Sample>,
               ( arg( "iSampSelector" ) = Abc::ISampleSelector() ) )
         .def( "getVelocitiesProperty",
               &AbcG::ICurvesSchema::getVelocitiesProperty )
@@ -78,7 +78,8 @@ void register_ifaceset()
         .def( "getNumSamples",
               &AbcG::IFaceSetSchema::getNumSamples )
         .def( "getValue",
-              &AbcG::IFaceSetSchema::getValue,
+              &getValueWithoutGIL<AbcG::IFaceSetSchema,
+                                  AbcG::IFaceSetSchema::Sample>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getFaceExclusivity",
               &AbcG::IFaceSetSchema::getFaceExclusivity )
@@ -97,7 +97,8 @@ void register_igeombase()
               &AbcG::IGeomBase::get,
               ( arg( "oSample" ), arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getValue",
-              &AbcG::IGeomBase::getValue,
+              &getValueWithoutGIL<AbcG::IGeomBase,
+                                  AbcG::IGeomBase::Sample>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getArbGeomParams",
               &AbcG::IGeomBase::getArbGeomParams )
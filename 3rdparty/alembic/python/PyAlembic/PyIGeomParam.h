@@ -44,6 +44,25 @@ static void register_( const char* iName )
 {
     using namespace boost::python;
 
+    // overloads
+    //
+    struct Overloads
+    {
+        static typename IGEOMPARAM::Sample
+        getIndexedValue( IGEOMPARAM &iParam, const Abc::ISampleSelector &iSS )
+        {
+            ReleaseGIL gil;
+            return iParam.getIndexedValue( iSS );
+        }
+
+        static typename IGEOMPARAM::Sample
+        getExpandedValue( IGEOMPARAM &iParam, const Abc::ISampleSelector &iSS )
+        {
+            ReleaseGIL gil;
+            return iParam.getExpandedValue( iSS );
+        }
+    };
+
     // ITypedGeomParam
     //
     class_<IGEOMPARAM>(
@@ -67,10 +86,10 @@ static void register_( const char* iName )
                      arg( "argument" ), arg( "argument" ) ),
                    "doc") )
         .def( "getIndexedValue",
-              &IGEOMPARAM::getIndexedValue,
+              &Overloads::getIndexedValue,
               ( arg( "iSampleSelector" ) = Abc::ISampleSelector() ) )
         .def( "getExpandedValue",
-              &IGEOMPARAM::getExpandedValue,
+              &Overloads::getExpandedValue,
               ( arg( "iSampleSelector" ) = Abc::ISampleSelector() ) )
         .def( "getNumSamples",
               &IGEOMPARAM::getNumSamples )
@@ -86,7 +86,8 @@ void register_inupatch()
               &AbcG::INuPatchSchema::get,
               ( arg( "sample" ), arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getValue",
-              &AbcG::INuPatchSchema::getValue,
+              &getValueWithoutGIL<AbcG::INuPatchSchema,
+                                  AbcG::INuPatchSchema::Sample>,
               ( arg( "iSampSelector" ) = Abc::ISampleSelector() ) )
         .def( "getPositionsProperty",
               &AbcG::INuPatchSchema::getPositionsProperty )
@@ -85,7 +85,8 @@ void register_ipoints()
         .def( "getWidthsParam",
               &AbcG::IPointsSchema::getWidthsParam )
         .def( "getValue",
-              &AbcG::IPointsSchema::getValue,
+              &getValueWithoutGIL<AbcG::IPointsSchema,
+                                  AbcG::IPointsSchema::Sample>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getTimeSampling",
               &AbcG::IPointsSchema::getTimeSampling )
@@ -38,6 +38,7 @@
 #include <PyISchemaObject.h>
 #include <PyIGeomBaseSchema.h>
 #include <PyImathStringArray.h>
+#include <PyArraySampleBuffer.h>
 
 using namespace boost::python;
 
@@ -104,7 +105,8 @@ void register_ipolymesh()
         .def( "getTimeSampling",
               &AbcG::IPolyMeshSchema::getTimeSampling )
         .def( "getValue",
-              &AbcG::IPolyMeshSchema::getValue,
+              &getValueWithoutGIL<AbcG::IPolyMeshSchema,
+                                  AbcG::IPolyMeshSchema::Sample>,
               ( arg( "iSampSelector" ) = Abc::ISampleSelector() ) )
         .def( "getUVsParam",
               &AbcG::IPolyMeshSchema::getUVsParam )
@@ -133,6 +135,34 @@ void register_ipolymesh()
               ( arg( "iFaceSetName" ) ) )
         ;
 
+    // buffer accessors for IPolyMeshSchema::Sample
+    //
+    struct SampleOverloads
+    {
+        static object getPositionsBuffer( AbcG::IPolyMeshSchema::Sample &iSamp )
+        {
+            return ArraySampleBuffer( iSamp.getPositions() );
+        }
+
+        static object getVelocitiesBuffer(
+            AbcG::IPolyMeshSchema::Sample &iSamp )
+        {
+            return ArraySampleBuffer( iSamp.getVelocities() );
+        }
+
+        static object getFaceIndicesBuffer(
+            AbcG::IPolyMeshSchema::Sample &iSamp )
+        {
+            return ArraySampleBuffer( iSamp.getFaceIndices() );
+        }
+
+        static object getFaceCountsBuffer(
+            AbcG::IPolyMeshSchema::Sample &iSamp )
+        {
+            return ArraySampleBuffer( iSamp.getFaceCounts() );
+        }
+    };
+
     // IPolyMeshSchema::Sample
     //
     class_<AbcG::IPolyMeshSchema::Sample>( "IPolyMeshSchemaSample", init<>() )
@@ -148,6 +178,14 @@ void register_ipolymesh()
          .def( "getFaceCounts",
               &AbcG::IPolyMeshSchema::Sample::getFaceCounts,
               with_custodian_and_ward_postcall<0,1>() )
+         .def( "getPositionsBuffer",
+              &SampleOverloads::getPositionsBuffer )
+         .def( "getVelocitiesBuffer",
+              &SampleOverloads::getVelocitiesBuffer )
+         .def( "getFaceIndicesBuffer",
+              &SampleOverloads::getFaceIndicesBuffer )
+         .def( "getFaceCountsBuffer",
+              &SampleOverloads::getFaceCountsBuffer )
          .def( "getSelfBounds",
               &AbcG::IPolyMeshSchema::Sample::getSelfBounds )
          .def( "valid",
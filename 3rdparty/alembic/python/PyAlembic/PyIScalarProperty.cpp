@@ -52,7 +52,10 @@ static object getPODValue( Abc::IScalarProperty &p,
 
     // Return the scalar property's value of type T.
     U val;
-    p.get( reinterpret_cast<void*>( &val ), iSS );
+    {
+        ReleaseGIL gil;
+        p.get( reinterpret_cast<void*>( &val ), iSS );
+    }
 
     typename return_by_value::apply<T>::type converter;
 
@@ -73,7 +76,10 @@ static object getSmallArrayValue( Abc::IScalarProperty &p,
     AbcU::Dimensions dims( iExtent );
     AbcA::ArraySamplePtr sampPtr =
         AbcA::AllocateArraySample( TPTraits::dataType(), dims );
-    p.get( const_cast<void*>( sampPtr->getData() ), iSS );
+    {
+        ReleaseGIL gil;
+        p.get( const_cast<void*>( sampPtr->getData() ), iSS );
+    }
 
     samp_ptr_type typedSampPtr =
         AbcU::static_pointer_cast<samp_type>( sampPtr ); 
@@ -102,7 +102,8 @@ void register_isubd()
         .def( "getTimeSampling",
               &AbcG::ISubDSchema::getTimeSampling )
         .def( "getValue",
-              &AbcG::ISubDSchema::getValue,
+              &getValueWithoutGIL<AbcG::ISubDSchema,
+                                  AbcG::ISubDSchema::Sample>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getFaceCountsProperty",
               &AbcG::ISubDSchema::getFaceCountsProperty )
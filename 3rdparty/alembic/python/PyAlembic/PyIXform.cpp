@@ -81,7 +81,8 @@ void register_ixform()
         .def( "getNumSamples",
               &AbcG::IXformSchema::getNumSamples )
         .def( "getValue",
-              &AbcG::IXformSchema::getValue,
+              &getValueWithoutGIL<AbcG::IXformSchema,
+                                  AbcG::XformSample>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getChildBoundsProperty",
               &AbcG::IXformSchema::getChildBoundsProperty )
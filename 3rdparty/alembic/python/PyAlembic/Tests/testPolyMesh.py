@@ -110,6 +110,26 @@ def meshIn():
     for i in range( len( positions ) ):
         assert positions[i] == verts[i]
 
+    # the buffers share memory with the samples instead of copying them
+    pbuf = memoryview( meshSamp.getPositionsBuffer() )
+    assert pbuf.readonly
+    assert pbuf.format == 'f'
+    assert pbuf.shape == ( len( verts ), 3 )
+
+    P = mesh.getPositionsProperty()
+    pbuf = memoryview( P.getBuffer() )
+    assert pbuf.shape == ( len( verts ), 3 )
+    assert pbuf.tobytes() == memoryview( meshSamp.getPositionsBuffer() ).tobytes()
+
+    ibuf = memoryview( meshSamp.getFaceIndicesBuffer() )
+    assert ibuf.format == 'i'
+    assert ibuf.shape == ( len( indices ), )
+
+    # both samples of P, stacked along a leading sample axis
+    prange = memoryview( P.getSampleRange() )
+    assert prange.shape == ( 2, len( verts ), 3 )
+    assert memoryview( P.getSampleRange( 1, 2 ) ).shape == ( 1, len( verts ), 3 )
+
 def meshLayerOut():
     """write a boring oarchive with a mesh and an oarchive with just uvs"""
 
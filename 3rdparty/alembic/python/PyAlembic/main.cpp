@@ -39,6 +39,7 @@ using namespace boost::python;
 
 // forwards
 void register_typedarraysampleconverters();
+void register_arraysamplebuffer();
 void register_abctypes();
 void register_abcgeomtypes();
 void register_coreabstracttypes();
@@ -171,6 +172,7 @@ BOOST_PYTHON_MODULE( alembic )
         register_isampleselector();
         register_iscalarproperty();
         register_iarrayproperty();
+        register_arraysamplebuffer();
         register_oscalarproperty();
         register_oarrayproperty();
         register_itypedscalarproperty();